@@ -235,6 +235,9 @@ SELECT a FROM id_int_int_int_100 WHERE a IN (SELECT 11) AND b > (SELECT 11);
 
 -- Correlated parameter in WHERE statement
 SELECT * FROM id_int_int_int_100 WHERE a < (SELECT MAX(b) FROM mixed WHERE mixed.b > id_int_int_int_100.b)
+SELECT * FROM id_int_int_int_100 WHERE a < (SELECT MAX(b) FROM mixed WHERE mixed.id = id_int_int_int_100.id)
+SELECT * FROM id_int_int_int_100 WHERE (SELECT MAX(b) FROM mixed WHERE mixed.id = id_int_int_int_100.c) > a
+SELECT id, a FROM id_int_int_int_100 WHERE a IN (SELECT b FROM mixed WHERE mixed.id = id_int_int_int_100.c)
 
 -- Subqueries in FROM statement
 SELECT * FROM (SELECT t1.id FROM id_int_int_int_100 t1 JOIN id_int_int_int_100 t2 ON t1.id + 1 = t2.id) AS s1, id_int_int_int_100 t3 WHERE s1.id + 5 = t3.id;
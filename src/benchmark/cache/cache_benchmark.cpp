@@ -0,0 +1,63 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "cache/cache.hpp"
+#include "cache/gdfs_cache.hpp"
+#include "cache/sharded_cache.hpp"
+
+namespace opossum {
+
+/**
+ * Concurrent lookups in a plan cache, as they happen when many clients send the same queries. Each lookup that misses
+ * inserts its key, like the SQLPipelineStatement does after optimizing a query. The keys are skewed so that the cache
+ * (which holds about a tenth of them) serves most lookups. Compares the default GDFSCache, whose accesses are
+ * serialized by the Cache's mutex, with the ShardedCache.
+ */
+template <typename CacheImpl>
+void BM_CacheConcurrentLookups(benchmark::State& state) {  // NOLINT
+  constexpr auto CAPACITY = size_t{1'024};
+  constexpr auto KEY_COUNT = size_t{10'240};
+
+  static auto cache = std::unique_ptr<Cache<std::shared_ptr<int>, std::string>>{};
+  static auto keys = std::vector<std::string>{};
+
+  if (state.thread_index == 0) {
+    cache = std::make_unique<Cache<std::shared_ptr<int>, std::string>>();
+    cache->template replace_cache_impl<CacheImpl>(CAPACITY);
+
+    keys.clear();
+    for (auto key_idx = size_t{0}; key_idx < KEY_COUNT; ++key_idx) {
+      keys.emplace_back("SELECT * FROM table_a WHERE a = " + std::to_string(key_idx));
+    }
+  }
+
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+  auto value = std::make_shared<int>(0);
+
+  for (auto _ : state) {
+    // Squaring a uniformly distributed value skews the keys towards the lower indices
+    const auto& key = keys[static_cast<size_t>(std::pow(distribution(generator), 2.0) * (KEY_COUNT - 1))];
+    auto cached_value = cache->try_get(key);
+    if (!cached_value) cache->set(key, value);
+    benchmark::DoNotOptimize(cached_value);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+
+  if (state.thread_index == 0) {
+    cache.reset();
+  }
+}
+
+using PlanGDFSCache = GDFSCache<std::string, std::shared_ptr<int>>;
+using PlanShardedCache = ShardedCache<std::string, std::shared_ptr<int>>;
+
+BENCHMARK_TEMPLATE(BM_CacheConcurrentLookups, PlanGDFSCache)->ThreadRange(1, 64)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CacheConcurrentLookups, PlanShardedCache)->ThreadRange(1, 64)->UseRealTime();
+
+}  // namespace opossum
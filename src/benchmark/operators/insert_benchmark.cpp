@@ -0,0 +1,66 @@
+#include <memory>
+
+#include "../micro_benchmark_basic_fixture.hpp"
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+// Copies all rows of @param values_to_insert into an empty table. The Update operator does the same for the new
+// versions of the rows it changes, whose unchanged columns are ReferenceSegments into the old rows.
+void benchmark_insert_impl(benchmark::State& state, const std::shared_ptr<const AbstractOperator>& values_to_insert) {
+  const auto& column_definitions = values_to_insert->get_output()->column_definitions();
+
+  for (auto _ : state) {
+    state.PauseTiming();
+    if (StorageManager::get().has_table("insert_target")) StorageManager::get().drop_table("insert_target");
+    StorageManager::get().add_table("insert_target", std::make_shared<Table>(column_definitions, TableType::Data,
+                                                                             Chunk::MAX_SIZE, UseMvcc::Yes));
+    auto insert = std::make_shared<Insert>("insert_target", values_to_insert);
+    const auto transaction_context = TransactionManager::get().new_transaction_context();
+    insert->set_transaction_context(transaction_context);
+    state.ResumeTiming();
+
+    insert->execute();
+
+    state.PauseTiming();
+    transaction_context->commit();
+    state.ResumeTiming();
+  }
+}
+
+// A scan that selects all rows of @param table_wrapper, so that its output consists of ReferenceSegments
+std::shared_ptr<TableScan> reference_all_rows(const std::shared_ptr<TableWrapper>& table_wrapper) {
+  const auto& column_definition = table_wrapper->get_output()->column_definitions().at(0);
+  const auto column = pqp_column_(ColumnID{0}, column_definition.data_type, column_definition.nullable, "");
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column, 0));
+  table_scan->execute();
+  return table_scan;
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_InsertFromValueSegments)(benchmark::State& state) {
+  _clear_cache();
+  benchmark_insert_impl(state, _table_wrapper_a);
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_InsertFromReferenceSegments)(benchmark::State& state) {
+  _clear_cache();
+  benchmark_insert_impl(state, reference_all_rows(_table_wrapper_a));
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_InsertFromReferenceSegments_OnDict)(benchmark::State& state) {
+  _clear_cache();
+  benchmark_insert_impl(state, reference_all_rows(_table_dict_wrapper));
+}
+
+}  // namespace opossum
@@ -71,6 +71,30 @@ class SQLBenchmark : public MicroBenchmarkBasicFixture {
     }
   }
 
+  // Run a benchmark that executes a short query whose physical plan is cached. With @param copy_plan, another statement
+  // holds the cached plan, so that it is copied as on concurrent cache hits. Otherwise, the cached plan is reused.
+  void BM_CachedPointQuery(benchmark::State& state, const bool copy_plan) {
+    SQLPhysicalPlanCache::get().clear();
+    SQLPhysicalPlanCache::get().resize(16);
+
+    const auto execute_point_query = [&]() {
+      auto pipeline_statement = SQLPipelineBuilder{point_query}.disable_mvcc().create_pipeline_statement();
+      pipeline_statement.get_result_table();
+    };
+
+    // Cache the plan
+    execute_point_query();
+
+    auto plan_holder = SQLPipelineBuilder{point_query}.disable_mvcc().create_pipeline_statement();
+    if (copy_plan) plan_holder.get_physical_plan();
+
+    for (auto _ : state) {
+      execute_point_query();
+    }
+  }
+
+  const std::string point_query = "SELECT c_name FROM customer WHERE c_custkey = 42;";
+
   const std::string query =
       R"(SELECT customer.c_custkey, customer.c_name, COUNT(orderitems.o_orderkey)
         FROM customer
@@ -86,5 +110,7 @@ BENCHMARK_F(SQLBenchmark, BM_CompileQuery)(benchmark::State& st) { BM_CompileQue
 BENCHMARK_F(SQLBenchmark, BM_ParseQuery)(benchmark::State& st) { BM_ParseQuery(st); }
 BENCHMARK_F(SQLBenchmark, BM_PlanQuery)(benchmark::State& st) { BM_PlanQuery(st); }
 BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQuery)(benchmark::State& st) { BM_QueryPlanCache(st); }
+BENCHMARK_F(SQLBenchmark, BM_CachedPointQueryCopiedPlan)(benchmark::State& st) { BM_CachedPointQuery(st, true); }
+BENCHMARK_F(SQLBenchmark, BM_CachedPointQueryReusedPlan)(benchmark::State& st) { BM_CachedPointQuery(st, false); }
 
 }  // namespace opossum
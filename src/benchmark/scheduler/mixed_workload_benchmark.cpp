@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+#include "table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Executes point lookups on a small table while several clients continuously send aggregations over a large table.
+ * Reports the p50 and p99 latencies of both kinds of queries.
+ *
+ * Arg 0 selects the scheduling configuration:
+ *  0 - all queries are Analytical, i.e., they are scheduled like before the introduction of QueryClasses
+ *  1 - the point lookups are Transactional, with the default weights of the ResourceGroups
+ *  2 - as 1, but at most two aggregations are executed concurrently
+ */
+class MixedWorkloadBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    const auto distributions = std::vector<ColumnDataDistribution>(
+        2, ColumnDataDistribution::make_uniform_config(0.0, 1'000.0));
+    auto& storage_manager = StorageManager::get();
+    storage_manager.add_table("analytical_table", TableGenerator{}.generate_table(distributions, 4'000'000, 100'000));
+    storage_manager.add_table("transactional_table", TableGenerator{}.generate_table(distributions, 1'000, 1'000));
+
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+    _transactional_query_class = state.range(0) == 0 ? QueryClass::Analytical : QueryClass::Transactional;
+    if (state.range(0) == 2) ResourceGroup::get(QueryClass::Analytical).set_max_concurrent_queries(2);
+  }
+
+  void TearDown(::benchmark::State&) override {
+    CurrentScheduler::set(nullptr);
+    ResourceGroup::reset();
+    SQLPhysicalPlanCache::get().clear();
+    SQLLogicalPlanCache::get().clear();
+    StorageManager::get().reset();
+  }
+
+ protected:
+  static std::chrono::microseconds _execute(const std::string& sql, const QueryClass query_class) {
+    const auto begin = std::chrono::steady_clock::now();
+    auto pipeline = SQLPipelineBuilder{sql}.with_query_class(query_class).create_pipeline();
+    benchmark::DoNotOptimize(pipeline.get_result_table());
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+  }
+
+  // @return the @param percentile of the @param latencies in milliseconds
+  static double _percentile(std::vector<std::chrono::microseconds>& latencies, const double percentile) {
+    if (latencies.empty()) return 0.0;
+
+    const auto idx = static_cast<size_t>(percentile * static_cast<double>(latencies.size() - 1));
+    std::nth_element(latencies.begin(), latencies.begin() + idx, latencies.end());
+    return static_cast<double>(latencies[idx].count()) / 1'000.0;
+  }
+
+  QueryClass _transactional_query_class{QueryClass::Transactional};
+};
+
+BENCHMARK_DEFINE_F(MixedWorkloadBenchmarkFixture, BM_MixedWorkload)(benchmark::State& state) {
+  const auto analytical_sql =
+      std::string{"SELECT column_1, SUM(column_2) FROM analytical_table WHERE column_2 > 10 GROUP BY column_1"};
+  constexpr auto ANALYTICAL_CLIENT_COUNT = size_t{8};
+  constexpr auto POINT_LOOKUP_COUNT = size_t{200};
+
+  auto analytical_latencies = std::vector<std::chrono::microseconds>{};
+  auto transactional_latencies = std::vector<std::chrono::microseconds>{};
+
+  for (auto _ : state) {
+    auto stop = std::atomic_bool{false};
+    auto analytical_latencies_mutex = std::mutex{};
+
+    auto analytical_clients = std::vector<std::thread>{};
+    for (auto client_idx = size_t{0}; client_idx < ANALYTICAL_CLIENT_COUNT; ++client_idx) {
+      analytical_clients.emplace_back([&]() {
+        while (!stop) {
+          const auto latency = _execute(analytical_sql, QueryClass::Analytical);
+          std::lock_guard<std::mutex> lock(analytical_latencies_mutex);
+          analytical_latencies.emplace_back(latency);
+        }
+      });
+    }
+
+    for (auto lookup_idx = size_t{0}; lookup_idx < POINT_LOOKUP_COUNT; ++lookup_idx) {
+      const auto sql = "SELECT * FROM transactional_table WHERE column_1 = " + std::to_string(lookup_idx);
+      transactional_latencies.emplace_back(_execute(sql, _transactional_query_class));
+    }
+
+    stop = true;
+    for (auto& analytical_client : analytical_clients) {
+      analytical_client.join();
+    }
+  }
+
+  state.counters["transactional_p50_ms"] = _percentile(transactional_latencies, 0.5);
+  state.counters["transactional_p99_ms"] = _percentile(transactional_latencies, 0.99);
+  state.counters["analytical_p50_ms"] = _percentile(analytical_latencies, 0.5);
+  state.counters["analytical_p99_ms"] = _percentile(analytical_latencies, 0.99);
+}
+
+BENCHMARK_REGISTER_F(MixedWorkloadBenchmarkFixture, BM_MixedWorkload)
+    ->DenseRange(0, 2)
+    ->Iterations(1)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
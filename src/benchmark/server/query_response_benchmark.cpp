@@ -0,0 +1,63 @@
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+#include "../micro_benchmark_basic_fixture.hpp"
+#include "benchmark/benchmark.h"
+#include "operators/table_wrapper.hpp"
+#include "server/data_row_serializer.hpp"
+#include "server/query_response_builder.hpp"
+
+namespace opossum {
+
+// Serializes the dictionary-encoded table (10 int columns, 40'000 rows) into batches of DataRow messages, as they are
+// sent to the client. Arg is the ResultFormat (0 = text, 1 = binary).
+BENCHMARK_DEFINE_F(MicroBenchmarkBasicFixture, BM_DataRowSerializer)(benchmark::State& state) {
+  const auto& table = *_table_dict_wrapper->get_output();
+  const auto result_format = static_cast<ResultFormat>(state.range(0));
+
+  auto serialized_bytes = size_t{0};
+  for (auto _ : state) {
+    auto data_row_serializer = DataRowSerializer{table, {result_format}};
+    while (true) {
+      const auto& batch = data_row_serializer.serialize_next_batch(QueryResponseBuilder::DATA_ROWS_BATCH_SIZE);
+      if (batch.empty()) break;
+
+      benchmark::DoNotOptimize(batch.data());
+      serialized_bytes += batch.size();
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(serialized_bytes));
+}
+
+BENCHMARK_REGISTER_F(MicroBenchmarkBasicFixture, BM_DataRowSerializer)->Arg(0)->Arg(1);
+
+// Upper bound for BM_DataRowSerializer: copying the same amount of (binary) data in batches of the same size
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_DataRowSerializerMemcpyBaseline)(benchmark::State& state) {
+  const auto& table = *_table_dict_wrapper->get_output();
+
+  auto result_size = size_t{0};
+  auto data_row_serializer = DataRowSerializer{table, {ResultFormat::Binary}};
+  while (const auto batch_size =
+             data_row_serializer.serialize_next_batch(QueryResponseBuilder::DATA_ROWS_BATCH_SIZE).size()) {
+    result_size += batch_size;
+  }
+
+  const auto source = ByteBuffer(result_size, 'x');
+  auto batch = ByteBuffer(QueryResponseBuilder::DATA_ROWS_BATCH_SIZE);
+
+  auto copied_bytes = size_t{0};
+  for (auto _ : state) {
+    for (auto offset = size_t{0}; offset < source.size(); offset += batch.size()) {
+      const auto batch_size = std::min(batch.size(), source.size() - offset);
+      std::memcpy(batch.data(), source.data() + offset, batch_size);
+      benchmark::DoNotOptimize(batch.data());
+      copied_bytes += batch_size;
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(copied_bytes));
+}
+
+}  // namespace opossum
@@ -0,0 +1,115 @@
+#include <pqxx/pqxx>
+
+#include <boost/asio/io_service.hpp>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "server/io_service_pool.hpp"
+#include "server/server.hpp"
+#include "sql/sql_plan_cache.hpp"
+#include "storage/storage_manager.hpp"
+#include "table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Drives a server with many concurrent client connections, each of which sends small queries in a loop (as, e.g.,
+ * dashboards do). The server runs in the same process and listens on a free port.
+ *
+ * Arg 0 is the number of connections, Arg 1 the number of network threads (0 = all sessions on a single io_service,
+ * i.e., without an IoServicePool).
+ */
+class ServerLoadBenchmarkFixture : public benchmark::Fixture {
+ public:
+  void SetUp(::benchmark::State& state) override {
+    StorageManager::get().add_table("load_table", TableGenerator{}.generate_table(ChunkID{2'000}));
+    CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+    const auto io_thread_count = static_cast<size_t>(state.range(1));
+    if (io_thread_count > 0) _io_service_pool = std::make_shared<IoServicePool>(io_thread_count);
+
+    _io_service = std::make_unique<boost::asio::io_service>();
+    _server = std::make_unique<Server>(*_io_service, /* port = */ 0, _io_service_pool);
+    _server_thread = std::thread{[&]() { _io_service->run(); }};
+
+    const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(_server->get_port_number());
+    const auto connection_count = static_cast<size_t>(state.range(0));
+    for (auto connection_idx = size_t{0}; connection_idx < connection_count; ++connection_idx) {
+      _connections.emplace_back(std::make_unique<pqxx::connection>(connection_string));
+    }
+  }
+
+  void TearDown(::benchmark::State&) override {
+    _connections.clear();
+
+    // Give the sessions time to terminate before stopping the io_services
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    _io_service->stop();
+    _server_thread.join();
+    _server.reset();
+    _io_service.reset();
+    _io_service_pool.reset();
+
+    CurrentScheduler::set(nullptr);
+    SQLPhysicalPlanCache::get().clear();
+    StorageManager::get().reset();
+  }
+
+ protected:
+  std::shared_ptr<IoServicePool> _io_service_pool;
+  std::unique_ptr<boost::asio::io_service> _io_service;
+  std::unique_ptr<Server> _server;
+  std::thread _server_thread;
+
+  std::vector<std::unique_ptr<pqxx::connection>> _connections;
+};
+
+BENCHMARK_DEFINE_F(ServerLoadBenchmarkFixture, BM_ServerClientLoad)(benchmark::State& state) {
+  // About 400 rows per query
+  const auto sql = std::string{"SELECT a, b, c FROM load_table WHERE a < 100;"};
+  constexpr auto QUERIES_PER_CONNECTION = size_t{10};
+
+  for (auto _ : state) {
+    auto client_threads = std::vector<std::thread>{};
+    client_threads.reserve(_connections.size());
+
+    for (const auto& connection : _connections) {
+      client_threads.emplace_back([&]() {
+        // We use nontransactions because the regular transactions use SQL that we don't support
+        pqxx::nontransaction transaction{*connection};
+        for (auto query_idx = size_t{0}; query_idx < QUERIES_PER_CONNECTION; ++query_idx) {
+          benchmark::DoNotOptimize(transaction.exec(sql).size());
+        }
+      });
+    }
+
+    for (auto& client_thread : client_threads) {
+      client_thread.join();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * _connections.size() * QUERIES_PER_CONNECTION));
+}
+
+static void ServerLoadArguments(benchmark::internal::Benchmark* benchmark) {
+  for (const auto connection_count : {1, 50, 500}) {
+    for (const auto io_thread_count : {0, 1, 4, 16}) {
+      benchmark->Args({connection_count, io_thread_count});
+    }
+  }
+}
+
+BENCHMARK_REGISTER_F(ServerLoadBenchmarkFixture, BM_ServerClientLoad)
+    ->Apply(ServerLoadArguments)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace opossum
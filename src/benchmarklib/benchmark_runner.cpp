@@ -1,7 +1,9 @@
 #include <json.hpp>
 
 #include <boost/range/adaptors.hpp>
+#include <algorithm>
 #include <random>
+#include <unordered_set>
 
 #include "cxxopts.hpp"
 
@@ -9,9 +11,12 @@
 #include "benchmark_runner.hpp"
 #include "benchmark_state.hpp"
 #include "constant_mappings.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "sql/create_sql_parser_error_message.hpp"
 #include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/table_statistics.hpp"
 #include "storage/chunk.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
@@ -26,6 +31,39 @@
 
 namespace opossum {
 
+namespace {
+
+// Collects the estimated and the actual output row count of all operators in a PQP that were translated from one of
+// the LQP nodes whose estimations are relevant for the optimizer
+void collect_q_errors(const std::shared_ptr<const AbstractOperator>& op,
+                      std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_ops,
+                      nlohmann::json& q_errors) {
+  if (!op || !visited_ops.emplace(op).second) return;
+
+  collect_q_errors(op->input_left(), visited_ops, q_errors);
+  collect_q_errors(op->input_right(), visited_ops, q_errors);
+
+  if (!op->lqp_node()) return;
+
+  const auto node_type = op->lqp_node()->type;
+  if (node_type != LQPNodeType::StoredTable && node_type != LQPNodeType::Validate &&
+      node_type != LQPNodeType::Predicate && node_type != LQPNodeType::Join && node_type != LQPNodeType::Aggregate &&
+      node_type != LQPNodeType::Union) {
+    return;
+  }
+
+  const auto estimated_row_count = std::max(op->lqp_node()->get_statistics()->row_count(), 1.0f);
+  const auto actual_row_count = std::max(static_cast<float>(op->performance_data().output_row_count), 1.0f);
+  const auto q_error = std::max(estimated_row_count / actual_row_count, actual_row_count / estimated_row_count);
+
+  q_errors.push_back({{"operator", op->description()},
+                      {"estimated_row_count", estimated_row_count},
+                      {"actual_row_count", op->performance_data().output_row_count},
+                      {"q_error", q_error}});
+}
+
+}  // namespace
+
 BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<AbstractQueryGenerator> query_generator,
                                  std::unique_ptr<AbstractTableGenerator> table_generator, const nlohmann::json& context)
     : _config(config),
@@ -51,6 +89,10 @@ BenchmarkRunner::BenchmarkRunner(const BenchmarkConfig& config, std::unique_ptr<
     const auto scheduler = std::make_shared<NodeQueueScheduler>();
     CurrentScheduler::set(scheduler);
   }
+
+  if (config.enable_cardinality_feedback) {
+    CardinalityFeedback::get().set_enabled(true);
+  }
 }
 
 BenchmarkRunner::~BenchmarkRunner() {
@@ -406,7 +448,7 @@ void BenchmarkRunner::_execute_query(const QueryID query_id, const std::function
 }
 
 void BenchmarkRunner::_store_plan(const QueryID query_id, SQLPipeline& pipeline) {
-  if (_config.enable_visualization) {
+  if (_config.enable_visualization || _config.report_q_errors) {
     if (_query_plans[query_id].lqps.empty()) {
       QueryPlans plans{pipeline.get_optimized_logical_plans(), pipeline.get_physical_plans()};
       _query_plans[query_id] = plans;
@@ -449,6 +491,23 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
       benchmark["verification_passed"] = *query_result.verification_passed;
     }
 
+    // The q-error (max(estimated / actual, actual / estimated)) of the cardinality estimations in the first execution
+    if (_config.report_q_errors) {
+      auto q_errors = nlohmann::json::array();
+      auto visited_ops = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+      for (const auto& pqp : _query_plans[query_id].pqps) {
+        collect_q_errors(pqp, visited_ops, q_errors);
+      }
+
+      auto max_q_error = 1.0f;
+      for (const auto& q_error : q_errors) {
+        max_q_error = std::max(max_q_error, q_error["q_error"].get<float>());
+      }
+
+      benchmark["cardinality_estimations"] = q_errors;
+      benchmark["max_q_error"] = max_q_error;
+    }
+
     benchmarks.push_back(benchmark);
   }
 
@@ -496,7 +555,9 @@ cxxopts::Options BenchmarkRunner::get_basic_cli_options(const std::string& bench
     ("mvcc", "Enable MVCC", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("visualize", "Create a visualization image of one LQP and PQP for each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
     ("verify", "Verify each query by comparing it with the SQLite result", cxxopts::value<bool>()->default_value("false")) // NOLINT
-    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("cache_binary_tables", "Cache tables as binary files for faster loading on subsequent runs", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("q_errors", "Report the q-errors of the cardinality estimations of each query", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("cardinality_feedback", "Re-optimize queries using the cardinalities observed when executing them", cxxopts::value<bool>()->default_value("false")); // NOLINT
   // clang-format on
 
   return cli_options;
@@ -537,6 +598,8 @@ nlohmann::json BenchmarkRunner::create_context(const BenchmarkConfig& config) {
       {"cores", config.cores},
       {"clients", config.clients},
       {"verify", config.verify},
+      {"q_errors", config.report_q_errors},
+      {"cardinality_feedback", config.enable_cardinality_feedback},
       {"GIT-HASH", GIT_HEAD_SHA1 + std::string(GIT_IS_DIRTY ? "-dirty" : "")}};
 }
 
@@ -60,7 +60,7 @@ class BenchmarkRunner {
   // Execute named_query
   void _execute_query(const QueryID query_id, const std::function<void()>& done_callback);
 
-  // If visualization is enabled, stores an executed plan
+  // If visualization or q-error reports are enabled, stores an executed plan
   void _store_plan(const QueryID query_id, SQLPipeline& pipeline);
 
   // Create a report in roughly the same format as google benchmarks do when run with --benchmark_format=json
@@ -72,8 +72,8 @@ class BenchmarkRunner {
     std::vector<std::shared_ptr<AbstractOperator>> pqps;
   };
 
-  // If visualization is enabled, this stores the LQP and PQP for each query. Its length is defined by the number of
-  // available queries.
+  // If visualization or q-error reports are enabled, this stores the LQP and PQP for each query. Its length is defined
+  // by the number of available queries.
   std::vector<QueryPlans> _query_plans;
 
   const BenchmarkConfig _config;
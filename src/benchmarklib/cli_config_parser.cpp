@@ -130,10 +130,21 @@ BenchmarkConfig CLIConfigParser::parse_basic_options_json_config(const nlohmann:
     std::cout << "- Not caching tables as binary files" << std::endl;
   }
 
+  const auto report_q_errors = json_config.value("q_errors", default_config.report_q_errors);
+  if (report_q_errors) {
+    std::cout << "- Reporting the q-errors of the cardinality estimations" << std::endl;
+  }
+
+  const auto enable_cardinality_feedback =
+      json_config.value("cardinality_feedback", default_config.enable_cardinality_feedback);
+  if (enable_cardinality_feedback) {
+    std::cout << "- Re-optimizing queries based on the observed cardinalities" << std::endl;
+  }
+
   return BenchmarkConfig{
-      benchmark_mode, chunk_size,         *encoding_config, max_runs, timeout_duration, warmup_duration,
-      use_mvcc,       output_file_path,   enable_scheduler, cores,    clients,          enable_visualization,
-      verify,         cache_binary_tables};
+      benchmark_mode, chunk_size,         *encoding_config, max_runs,       timeout_duration, warmup_duration,
+      use_mvcc,       output_file_path,   enable_scheduler, cores,          clients,          enable_visualization,
+      verify,         cache_binary_tables, report_q_errors, enable_cardinality_feedback};
 }
 
 BenchmarkConfig CLIConfigParser::parse_basic_cli_options(const cxxopts::ParseResult& parse_result) {
@@ -158,6 +169,8 @@ nlohmann::json CLIConfigParser::basic_cli_options_to_json(const cxxopts::ParseRe
   json_config.emplace("output", parse_result["output"].as<std::string>());
   json_config.emplace("verify", parse_result["verify"].as<bool>());
   json_config.emplace("cache_binary_tables", parse_result["cache_binary_tables"].as<bool>());
+  json_config.emplace("q_errors", parse_result["q_errors"].as<bool>());
+  json_config.emplace("cardinality_feedback", parse_result["cardinality_feedback"].as<bool>());
 
   return json_config;
 }
@@ -0,0 +1,323 @@
+#include "cost_model_calibration.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+#include "constant_mappings.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/pqp_column_expression.hpp"
+#include "operators/aggregate.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/join_sort_merge.hpp"
+#include "operators/product.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/chunk.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+#include "utils/assert.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+// Quadratic operators (JoinNestedLoop, Product, and JoinIndex, which reserves its worst case output) are only
+// calibrated on inputs whose product of row counts does not exceed this
+constexpr auto MAX_QUADRATIC_ROW_COUNT_PRODUCT = size_t{100'000'000};
+
+constexpr auto CALIBRATION_CHUNK_SIZE = size_t{100'000};
+
+// Number of distinct values of the column that is used for grouping
+constexpr auto GROUP_COUNT = 100;
+
+}  // namespace
+
+namespace opossum {
+
+CostModelCalibration::CostModelCalibration(const std::vector<size_t>& row_counts, const size_t repetitions)
+    : _row_counts(row_counts), _repetitions(repetitions) {
+  Assert(!_row_counts.empty(), "Need at least one row count to calibrate");
+  Assert(_repetitions > 0, "Need at least one repetition to calibrate");
+}
+
+CostModelCoefficients CostModelCalibration::calibrate() const {
+  // Start with the defaults, so that operators that are not calibrated still have sensible coefficients
+  auto coefficients = CostModelCoefficients::defaults();
+
+  _calibrate_table_scans(coefficients);
+  _calibrate_joins(coefficients);
+  _calibrate_other_operators(coefficients);
+
+  return coefficients;
+}
+
+CostFunctionCoefficients CostModelCalibration::fit_cost_function(const std::vector<Measurement>& measurements,
+                                                                 std::vector<CostFeature> features) {
+  auto coefficients = CostFunctionCoefficients{};
+
+  while (!features.empty()) {
+    const auto feature_count = features.size();
+
+    // The features span many orders of magnitude (e.g., the constant and the product of the input row counts). Scale
+    // them to [0, 1] to keep the normal equations well-conditioned.
+    auto scales = std::vector<double>(feature_count, 0.0);
+    for (const auto& measurement : measurements) {
+      for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+        const auto value = static_cast<double>(measurement.features[static_cast<size_t>(features[feature_idx])]);
+        scales[feature_idx] = std::max(scales[feature_idx], std::abs(value));
+      }
+    }
+
+    // Set up the normal equations (X^T * X) * b = X^T * y as an augmented matrix
+    auto matrix = std::vector<std::vector<double>>(feature_count, std::vector<double>(feature_count + 1, 0.0));
+    for (const auto& measurement : measurements) {
+      auto scaled_features = std::vector<double>(feature_count);
+      for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+        const auto value = static_cast<double>(measurement.features[static_cast<size_t>(features[feature_idx])]);
+        scaled_features[feature_idx] = scales[feature_idx] > 0.0 ? value / scales[feature_idx] : 0.0;
+      }
+
+      for (auto row = size_t{0}; row < feature_count; ++row) {
+        for (auto column = size_t{0}; column < feature_count; ++column) {
+          matrix[row][column] += scaled_features[row] * scaled_features[column];
+        }
+        matrix[row][feature_count] += scaled_features[row] * measurement.runtime;
+      }
+    }
+
+    // Gauss-Jordan elimination with partial pivoting. Linearly dependent features get a coefficient of 0.
+    for (auto pivot = size_t{0}; pivot < feature_count; ++pivot) {
+      auto max_row = pivot;
+      for (auto row = pivot + 1; row < feature_count; ++row) {
+        if (std::abs(matrix[row][pivot]) > std::abs(matrix[max_row][pivot])) max_row = row;
+      }
+      std::swap(matrix[pivot], matrix[max_row]);
+
+      if (std::abs(matrix[pivot][pivot]) < 1e-12) continue;
+
+      for (auto row = size_t{0}; row < feature_count; ++row) {
+        if (row == pivot) continue;
+        const auto factor = matrix[row][pivot] / matrix[pivot][pivot];
+        for (auto column = pivot; column <= feature_count; ++column) {
+          matrix[row][column] -= factor * matrix[pivot][column];
+        }
+      }
+    }
+
+    auto solution = std::vector<double>(feature_count, 0.0);
+    for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+      if (std::abs(matrix[feature_idx][feature_idx]) < 1e-12 || scales[feature_idx] == 0.0) continue;
+      solution[feature_idx] =
+          matrix[feature_idx][feature_count] / matrix[feature_idx][feature_idx] / scales[feature_idx];
+    }
+
+    // Drop the feature with the most negative coefficient and fit again
+    const auto min_iter = std::min_element(solution.begin(), solution.end());
+    if (*min_iter < 0.0) {
+      features.erase(features.begin() + std::distance(solution.begin(), min_iter));
+      continue;
+    }
+
+    for (auto feature_idx = size_t{0}; feature_idx < feature_count; ++feature_idx) {
+      coefficients[static_cast<size_t>(features[feature_idx])] = static_cast<float>(solution[feature_idx]);
+    }
+    break;
+  }
+
+  return coefficients;
+}
+
+void CostModelCalibration::_calibrate_table_scans(CostModelCoefficients& coefficients) const {
+  for (const auto encoding_type : encoding_type_enum_values) {
+    if (!encoding_supports_data_type(encoding_type, DataType::Int)) continue;
+
+    auto measurements = std::vector<Measurement>{};
+
+    for (const auto row_count : _row_counts) {
+      const auto table = _generate_table(row_count, encoding_type);
+      const auto table_wrapper = std::make_shared<TableWrapper>(table);
+      table_wrapper->execute();
+
+      const auto column = PQPColumnExpression::from_table(*table, ColumnID{0});
+
+      for (const auto selectivity : {0.01, 0.1, 0.5, 0.9}) {
+        const auto value = static_cast<int32_t>(static_cast<double>(row_count) * selectivity);
+        measurements.emplace_back(
+            _measure([&]() { return std::make_shared<TableScan>(table_wrapper, less_than_(column, value)); }));
+      }
+    }
+
+    coefficients.table_scan[encoding_type] = fit_cost_function(
+        measurements, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::OutputRowCount});
+    std::cout << "- Calibrated TableScan on " << encoding_type_to_string.left.at(encoding_type) << " segments"
+              << std::endl;
+  }
+}
+
+void CostModelCalibration::_calibrate_joins(CostModelCoefficients& coefficients) const {
+  auto table_wrappers = std::vector<std::shared_ptr<TableWrapper>>{};
+  auto indexed_table_wrappers = std::vector<std::shared_ptr<TableWrapper>>{};
+
+  for (const auto row_count : _row_counts) {
+    const auto table = _generate_table(row_count, EncodingType::Dictionary);
+    table_wrappers.emplace_back(std::make_shared<TableWrapper>(table));
+    table_wrappers.back()->execute();
+
+    const auto indexed_table = _generate_table(row_count, EncodingType::Dictionary);
+    for (auto chunk_id = ChunkID{0}; chunk_id < indexed_table->chunk_count(); ++chunk_id) {
+      indexed_table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+    indexed_table_wrappers.emplace_back(std::make_shared<TableWrapper>(indexed_table));
+    indexed_table_wrappers.back()->execute();
+  }
+
+  const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+
+  const auto calibrate_join = [&](const OperatorType operator_type, const auto& make_join,
+                                  const std::vector<CostFeature>& features, const bool is_quadratic,
+                                  const bool needs_index) {
+    auto measurements = std::vector<Measurement>{};
+
+    for (auto left_idx = size_t{0}; left_idx < _row_counts.size(); ++left_idx) {
+      for (auto right_idx = size_t{0}; right_idx < _row_counts.size(); ++right_idx) {
+        if (is_quadratic && _row_counts[left_idx] * _row_counts[right_idx] > MAX_QUADRATIC_ROW_COUNT_PRODUCT) continue;
+
+        const auto& left = table_wrappers[left_idx];
+        const auto& right = needs_index ? indexed_table_wrappers[right_idx] : table_wrappers[right_idx];
+        measurements.emplace_back(_measure([&]() { return make_join(left, right); }));
+      }
+    }
+
+    if (measurements.empty()) return;
+    coefficients.operators[operator_type] = fit_cost_function(measurements, features);
+  };
+
+  // clang-format off
+  calibrate_join(OperatorType::JoinHash, [&](const auto& left, const auto& right) {
+    return std::make_shared<JoinHash>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  }, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::RightInputRowCount,
+      CostFeature::OutputRowCount}, false, false);
+  std::cout << "- Calibrated JoinHash" << std::endl;
+
+  calibrate_join(OperatorType::JoinSortMerge, [&](const auto& left, const auto& right) {
+    return std::make_shared<JoinSortMerge>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  }, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::LeftInputRowCountLog,
+      CostFeature::RightInputRowCount, CostFeature::RightInputRowCountLog, CostFeature::OutputRowCount}, false, false);
+  std::cout << "- Calibrated JoinSortMerge" << std::endl;
+
+  calibrate_join(OperatorType::JoinMPSM, [&](const auto& left, const auto& right) {
+    return std::make_shared<JoinMPSM>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  }, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::RightInputRowCount,
+      CostFeature::OutputRowCount}, false, false);
+  std::cout << "- Calibrated JoinMPSM" << std::endl;
+
+  calibrate_join(OperatorType::JoinNestedLoop, [&](const auto& left, const auto& right) {
+    return std::make_shared<JoinNestedLoop>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  }, {CostFeature::Constant, CostFeature::InputRowCountProduct, CostFeature::OutputRowCount}, true, false);
+  std::cout << "- Calibrated JoinNestedLoop" << std::endl;
+
+  calibrate_join(OperatorType::JoinIndex, [&](const auto& left, const auto& right) {
+    return std::make_shared<JoinIndex>(left, right, JoinMode::Inner, column_ids, PredicateCondition::Equals);
+  }, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::OutputRowCount}, true, true);
+  std::cout << "- Calibrated JoinIndex" << std::endl;
+
+  calibrate_join(OperatorType::Product, [&](const auto& left, const auto& right) {
+    return std::make_shared<Product>(left, right);
+  }, {CostFeature::Constant, CostFeature::OutputRowCount}, true, false);
+  std::cout << "- Calibrated Product" << std::endl;
+  // clang-format on
+}
+
+void CostModelCalibration::_calibrate_other_operators(CostModelCoefficients& coefficients) const {
+  auto aggregate_measurements = std::vector<Measurement>{};
+  auto sort_measurements = std::vector<Measurement>{};
+  auto union_positions_measurements = std::vector<Measurement>{};
+
+  for (const auto row_count : _row_counts) {
+    const auto table = _generate_table(row_count, EncodingType::Dictionary);
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+
+    aggregate_measurements.emplace_back(_measure([&]() {
+      return std::make_shared<Aggregate>(table_wrapper,
+                                         std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Sum}},
+                                         std::vector<ColumnID>{ColumnID{1}});
+    }));
+
+    sort_measurements.emplace_back(_measure([&]() { return std::make_shared<Sort>(table_wrapper, ColumnID{0}); }));
+
+    // UnionPositions is used for disjunctions, i.e., it unites two scans on the same table
+    const auto column = PQPColumnExpression::from_table(*table, ColumnID{0});
+    const auto value = static_cast<int32_t>(row_count / 2);
+    const auto left_scan = std::make_shared<TableScan>(table_wrapper, less_than_(column, value));
+    const auto right_scan = std::make_shared<TableScan>(table_wrapper, greater_than_equals_(column, value / 2));
+    left_scan->execute();
+    right_scan->execute();
+
+    union_positions_measurements.emplace_back(
+        _measure([&]() { return std::make_shared<UnionPositions>(left_scan, right_scan); }));
+  }
+
+  coefficients.operators[OperatorType::Aggregate] = fit_cost_function(
+      aggregate_measurements, {CostFeature::Constant, CostFeature::LeftInputRowCount, CostFeature::OutputRowCount});
+  std::cout << "- Calibrated Aggregate" << std::endl;
+
+  coefficients.operators[OperatorType::Sort] = fit_cost_function(
+      sort_measurements, {CostFeature::Constant, CostFeature::LeftInputRowCountLog, CostFeature::OutputRowCount});
+  std::cout << "- Calibrated Sort" << std::endl;
+
+  coefficients.operators[OperatorType::UnionPositions] =
+      fit_cost_function(union_positions_measurements,
+                        {CostFeature::Constant, CostFeature::LeftInputRowCountLog, CostFeature::RightInputRowCountLog,
+                         CostFeature::OutputRowCount});
+  std::cout << "- Calibrated UnionPositions" << std::endl;
+}
+
+CostModelCalibration::Measurement CostModelCalibration::_measure(
+    const std::function<std::shared_ptr<AbstractOperator>()>& make_operator) const {
+  auto runtimes = std::vector<double>{};
+  runtimes.reserve(_repetitions);
+
+  auto features = CostFeatureVector{};
+
+  for (auto repetition = size_t{0}; repetition < _repetitions; ++repetition) {
+    const auto op = make_operator();
+    op->execute();
+
+    runtimes.emplace_back(static_cast<double>(op->performance_data().walltime.count()));
+
+    const auto left_input_row_count = static_cast<float>(op->input_table_left()->row_count());
+    const auto right_input_row_count =
+        op->input_table_right() ? static_cast<float>(op->input_table_right()->row_count()) : 0.0f;
+    features = make_cost_features(left_input_row_count, right_input_row_count,
+                                  static_cast<float>(op->get_output()->row_count()));
+  }
+
+  std::nth_element(runtimes.begin(), runtimes.begin() + runtimes.size() / 2, runtimes.end());
+  return {features, runtimes[runtimes.size() / 2]};
+}
+
+std::shared_ptr<Table> CostModelCalibration::_generate_table(const size_t row_count,
+                                                             const EncodingType encoding_type) {
+  // The first column has (about) one match per row in a join with a table of the same size, the second column is used
+  // for grouping
+  const auto column_data_distributions = std::vector<ColumnDataDistribution>{
+      ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(row_count)),
+      ColumnDataDistribution::make_uniform_config(0.0, static_cast<double>(GROUP_COUNT))};
+
+  const auto chunk_size = std::min(row_count, CALIBRATION_CHUNK_SIZE);
+  const auto optional_encoding_type =
+      encoding_type == EncodingType::Unencoded ? std::nullopt : std::optional<EncodingType>{encoding_type};
+
+  return TableGenerator{}.generate_table(column_data_distributions, row_count, chunk_size, optional_encoding_type);
+}
+
+}  // namespace opossum
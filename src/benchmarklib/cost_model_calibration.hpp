@@ -0,0 +1,56 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "cost_model/cost_model_coefficients.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Obtains the coefficients of CostModelCalibrated for the machine it runs on. For this, the costed operators (TableScan
+ * for each encoding, the join implementations, Aggregate, Sort, UnionPositions) are executed on generated tables of
+ * different sizes. The measured runtimes are then fitted to the CostFeatures of each operator with a non-negative
+ * least squares fit.
+ */
+class CostModelCalibration {
+ public:
+  explicit CostModelCalibration(const std::vector<size_t>& row_counts = {1'000, 10'000, 100'000, 1'000'000},
+                                const size_t repetitions = 3);
+
+  CostModelCoefficients calibrate() const;
+
+  // Sample of the runtime of an operator, in nanoseconds
+  struct Measurement {
+    CostFeatureVector features;
+    double runtime;
+  };
+
+  /**
+   * Fits the coefficients of the given features so that the squared error on the measurements is minimal. Features
+   * whose coefficients would be negative are dropped, as they would make the cost negative for some inputs. The
+   * coefficients of all other features are zero.
+   */
+  static CostFunctionCoefficients fit_cost_function(const std::vector<Measurement>& measurements,
+                                                    std::vector<CostFeature> features);
+
+ protected:
+  void _calibrate_table_scans(CostModelCoefficients& coefficients) const;
+  void _calibrate_joins(CostModelCoefficients& coefficients) const;
+  void _calibrate_other_operators(CostModelCoefficients& coefficients) const;
+
+  // Executes operators created by @param make_operator _repetitions times and records the median runtime. The inputs of
+  // the operators need to be executed already.
+  Measurement _measure(const std::function<std::shared_ptr<AbstractOperator>()>& make_operator) const;
+
+  static std::shared_ptr<Table> _generate_table(const size_t row_count, const EncodingType encoding_type);
+
+  const std::vector<size_t> _row_counts;
+  const size_t _repetitions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#include <iostream>
+
+#include "cost_model/cost_model_coefficients.hpp"
+#include "cost_model_calibration.hpp"
+
+/**
+ * Calibrates the physical cost model on this machine and writes the coefficients as json, either to the file passed as
+ * the first argument or to stdout. The file can be loaded with import_cost_model_coefficients().
+ */
+int main(int argc, char* argv[]) {
+  if (argc > 2) {
+    std::cerr << "Usage: " << argv[0] << " [output_file.json]" << std::endl;
+    return 1;
+  }
+
+  std::cout << "Calibrating the cost model" << std::endl;
+  const auto coefficients = opossum::CostModelCalibration{}.calibrate();
+
+  if (argc == 2) {
+    opossum::export_cost_model_coefficients(coefficients, std::string{argv[1]});
+    std::cout << " > Wrote coefficients to " << argv[1] << std::endl;
+  } else {
+    opossum::export_cost_model_coefficients(coefficients, std::cout);
+    std::cout << std::endl;
+  }
+
+  return 0;
+}
@@ -1,13 +1,17 @@
 #include <boost/asio/io_service.hpp>
 
+#include <chrono>
 #include <cstdio>
 #include <cstdlib>
 #include <iostream>
 
+#include "concurrency/transaction_manager.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
+#include "server/io_service_pool.hpp"
 #include "server/server.hpp"
+#include "sql/result_chunk_stream.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
 
@@ -23,15 +27,51 @@ int main(int argc, char* argv[]) {
       port = static_cast<uint16_t>(port_long);
     }
 
+    // Optionally, read-only queries may share a snapshot that is up to the given number of milliseconds old. This
+    // reduces the contention on the TransactionManager for read-heavy workloads at the cost of slightly stale reads.
+    if (argc >= 3) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto staleness_ms = std::strtol(argv[2], &endptr, 10);
+      Assert(errno == 0 && staleness_ms >= 0 && *endptr == 0, "invalid snapshot staleness");
+      opossum::TransactionManager::get().set_max_read_only_snapshot_staleness(
+          std::chrono::milliseconds{staleness_ms});
+    }
+
+    // Optionally, the number of network threads can be given. By default, one thread per core is used.
+    auto io_thread_count = size_t{0};
+    if (argc >= 4) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto io_thread_count_long = std::strtol(argv[3], &endptr, 10);
+      Assert(errno == 0 && io_thread_count_long > 0 && *endptr == 0, "invalid number of network threads");
+      io_thread_count = static_cast<size_t>(io_thread_count_long);
+    }
+
+    // Optionally, the number of result chunks that each session produces ahead of its client can be given. Results are
+    // streamed, so this bounds the memory held for results that were not sent yet.
+    auto max_in_flight_chunks = opossum::ResultChunkStream::DEFAULT_MAX_IN_FLIGHT_CHUNKS;
+    if (argc >= 5) {
+      char* endptr{nullptr};
+      errno = 0;
+      auto max_in_flight_chunks_long = std::strtol(argv[4], &endptr, 10);
+      Assert(errno == 0 && max_in_flight_chunks_long > 0 && *endptr == 0, "invalid number of in-flight chunks");
+      max_in_flight_chunks = static_cast<size_t>(max_in_flight_chunks_long);
+    }
+
     // Set scheduler so that the server can execute the tasks on separate threads.
     opossum::CurrentScheduler::set(std::make_shared<opossum::NodeQueueScheduler>());
 
     boost::asio::io_service io_service;
 
+    // The sessions are distributed across a pool of io_services, each of which is run by its own thread. This way, the
+    // network I/O of different connections happens in parallel.
+    auto io_service_pool = std::make_shared<opossum::IoServicePool>(io_thread_count);
+
     // The server registers itself to the boost io_service. The io_service is the main IO control unit here and it lives
     // until the server doesn't request any IO any more, i.e. is has terminated. The server requests IO in its
-    // constructor and then runs forever.
-    opossum::Server server{io_service, port};
+    // constructor and then runs forever. The main io_service only accepts new connections.
+    opossum::Server server{io_service, port, io_service_pool, max_in_flight_chunks};
 
     io_service.run();
   } catch (std::exception& e) {
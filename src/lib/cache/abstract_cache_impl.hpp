@@ -2,6 +2,8 @@
 
 #include <boost/iterator/iterator_facade.hpp>
 
+#include <memory>
+#include <optional>
 #include <utility>
 
 namespace opossum {
@@ -52,6 +54,20 @@ class AbstractCacheImpl {
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
+  // Returns a copy of the item at the given key, or nothing if the cache does not hold it. Implementations that are
+  // thread-safe (see is_thread_safe()) override this so that the lookup is atomic.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
+  // Returns true if the implementation synchronizes concurrent calls of set(), try_get(), has(), and erase() itself,
+  // so that Cache does not need to serialize them.
+  virtual bool is_thread_safe() const { return false; }
+
+  // Removes the item at the given key, if any. Returns true if an item was removed.
+  virtual bool erase(const Key& key) = 0;
+
   // Returns the number of elements currently held in the cache.
   virtual size_t size() const = 0;
 
@@ -30,7 +30,7 @@ class Cache : public Singleton<Cache<Value, Key>> {
   void set(const Key& query, const Value& value) {
     if (_impl->capacity() == 0) return;
 
-    std::lock_guard<std::mutex> lock(_mutex);
+    const auto lock = _lock();
     _impl->set(query, value);
   }
 
@@ -39,20 +39,25 @@ class Cache : public Singleton<Cache<Value, Key>> {
   std::optional<Value> try_get(const Key& query) {
     if (_impl->capacity() == 0) return {};
 
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (!_impl->has(query)) {
-      return {};
-    }
-    return _impl->get(query);
+    const auto lock = _lock();
+    return _impl->try_get(query);
   }
 
   // Checks whether an entry for the query exists.
   bool has(const Key& query) const { return _impl->has(query); }
 
+  // Removes the entry for the query, e.g., because it became invalid. Returns true if an entry was removed.
+  bool erase(const Key& query) {
+    const auto lock = _lock();
+    return _impl->erase(query);
+  }
+
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get_entry(const Key& query) {
-    std::lock_guard<std::mutex> lock(_mutex);
+    const auto lock = _lock();
+    // The reference returned by get() is only stable while no other thread modifies the entry
+    if (_impl->is_thread_safe()) return *_impl->try_get(query);
     return _impl->get(query);
   }
 
@@ -79,6 +84,13 @@ class Cache : public Singleton<Cache<Value, Key>> {
   Iterator end() { return _impl->end(); }
 
  protected:
+  // Serializes the accesses to implementations that are not thread-safe themselves (e.g., because each lookup updates
+  // the eviction bookkeeping). Thread-safe implementations, such as the ShardedCache, are accessed without the mutex.
+  std::unique_lock<std::mutex> _lock() {
+    if (_impl->is_thread_safe()) return std::unique_lock<std::mutex>{};
+    return std::unique_lock<std::mutex>{_mutex};
+  }
+
   // Underlying cache eviction strategy.
   std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
 
@@ -100,6 +100,15 @@ class GDSCache : public AbstractCacheImpl<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  bool erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return false;
+
+    _queue.erase(it->second);
+    _map.erase(it);
+    return true;
+  }
+
   size_t size() const { return _map.size(); }
 
   void clear() {
@@ -67,6 +67,15 @@ class LRUCache : public AbstractCacheImpl<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  bool erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return false;
+
+    _list.erase(it->second);
+    _map.erase(it);
+    return true;
+  }
+
   // Returns the underlying list of all elements in the cache.
   std::list<KeyValuePair>& list() { return _list; }
 
@@ -76,6 +76,21 @@ class RandomCache : public AbstractCacheImpl<Key, Value> {
 
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
+  bool erase(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return false;
+
+    // Move the last element into the gap, so that the indices of all other elements stay valid
+    const auto index = it->second;
+    _map.erase(it);
+    if (index != _list.size() - 1) {
+      _list[index] = std::move(_list.back());
+      _map[_list[index].first] = index;
+    }
+    _list.pop_back();
+    return true;
+  }
+
   size_t size() const { return _map.size(); }
 
   void clear() {
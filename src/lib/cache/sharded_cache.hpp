@@ -0,0 +1,300 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "abstract_cache_impl.hpp"
+
+namespace opossum {
+
+// Approximate access frequencies of keys (a count-min sketch with 4-bit counters), as used by the TinyLFU admission
+// policy. Counters are incremented concurrently without locks. Once the number of recorded accesses reaches ten times
+// the capacity of the cache, all counters are halved, so that the frequencies reflect the recent workload.
+// Note: resize() must not run concurrently with increment() or estimate().
+class FrequencySketch {
+ public:
+  explicit FrequencySketch(const size_t capacity) { resize(capacity); }
+
+  void increment(const size_t hash) {
+    for (auto row = size_t{0}; row < ROW_COUNT; ++row) {
+      auto& counter = _counters[_index(hash, row)];
+      auto count = counter.load(std::memory_order_relaxed);
+      while (count < MAX_COUNT && !counter.compare_exchange_weak(count, count + 1, std::memory_order_relaxed)) {
+      }
+    }
+
+    if (_sample_count.fetch_add(1, std::memory_order_relaxed) + 1 == _sample_limit) _age();
+  }
+
+  uint8_t estimate(const size_t hash) const {
+    auto min_count = MAX_COUNT;
+    for (auto row = size_t{0}; row < ROW_COUNT; ++row) {
+      min_count = std::min(min_count, _counters[_index(hash, row)].load(std::memory_order_relaxed));
+    }
+    return min_count;
+  }
+
+  // Discards all recorded accesses and sizes the sketch for a cache of @param capacity entries
+  void resize(const size_t capacity) {
+    _width = 16;
+    while (_width < capacity) _width *= 2;
+
+    _counters = std::make_unique<std::atomic<uint8_t>[]>(ROW_COUNT * _width);
+    for (auto counter_idx = size_t{0}; counter_idx < ROW_COUNT * _width; ++counter_idx) {
+      _counters[counter_idx].store(0, std::memory_order_relaxed);
+    }
+    _sample_count = 0;
+    _sample_limit = std::max(size_t{10} * capacity, size_t{10});
+  }
+
+ private:
+  static constexpr auto ROW_COUNT = size_t{4};
+  static constexpr auto MAX_COUNT = uint8_t{15};
+
+  // Each row uses a different hash function, derived from the key's hash by a row-specific seed and a 64-bit finalizer
+  size_t _index(const size_t hash, const size_t row) const {
+    auto mixed = static_cast<uint64_t>(hash) + (row + 1) * uint64_t{0x9E3779B97F4A7C15};
+    mixed = (mixed ^ (mixed >> 33)) * uint64_t{0xFF51AFD7ED558CCD};
+    mixed = (mixed ^ (mixed >> 33)) * uint64_t{0xC4CEB9FE1A85EC53};
+    mixed ^= mixed >> 33;
+    return row * _width + static_cast<size_t>(mixed & (_width - 1));
+  }
+
+  void _age() {
+    for (auto counter_idx = size_t{0}; counter_idx < ROW_COUNT * _width; ++counter_idx) {
+      auto& counter = _counters[counter_idx];
+      counter.store(counter.load(std::memory_order_relaxed) / 2, std::memory_order_relaxed);
+    }
+    _sample_count = 0;
+  }
+
+  size_t _width{0};
+  std::unique_ptr<std::atomic<uint8_t>[]> _counters;
+  std::atomic<size_t> _sample_count{0};
+  size_t _sample_limit{0};
+};
+
+// Generic cache implementation for concurrent lookups. The keys are distributed over a fixed number of shards, each
+// with its own reader-writer lock, so that lookups only contend for the shard of their key and never block each other.
+// Lookups do not reorder entries (which would require exclusive access), but record the access in a FrequencySketch.
+// Each shard keeps its entries in insertion order. When a full shard receives a new key, the key is admitted only if
+// it was accessed more frequently than the oldest entry of the shard, which is evicted then (TinyLFU admission).
+// Otherwise, the new key is not cached and the oldest entry moves to the end of the order.
+// Note: All operations but the iterators are thread-safe.
+template <typename Key, typename Value>
+class ShardedCache : public AbstractCacheImpl<Key, Value> {
+ public:
+  using typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+  using typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+  using typename AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+  // Shards hold at least MIN_SHARD_CAPACITY entries (unless the entire cache is smaller), so that the admission
+  // decisions within a shard remain meaningful.
+  static constexpr auto MAX_SHARD_COUNT = size_t{64};
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{16};
+
+  struct alignas(64) Shard {
+    mutable std::shared_mutex mutex;
+    std::list<KeyValuePair> entries;
+    std::unordered_map<Key, typename std::list<KeyValuePair>::iterator> map;
+    size_t capacity{0};
+  };
+
+  class Iterator : public AbstractIterator {
+   public:
+    Iterator(const std::vector<std::unique_ptr<Shard>>& shards, size_t shard_idx)
+        : _shards(shards), _shard_idx(shard_idx) {
+      if (_shard_idx < _shards.size()) {
+        _wrapped_iterator = _shards[_shard_idx]->entries.begin();
+        _skip_empty_shards();
+      }
+    }
+
+   private:
+    friend class boost::iterator_core_access;
+    friend class AbstractCacheImpl<Key, Value>::ErasedIterator;
+
+    void increment() {
+      ++_wrapped_iterator;
+      _skip_empty_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const {
+      const auto& other_iterator = static_cast<const Iterator&>(other);
+      if (_shard_idx != other_iterator._shard_idx) return false;
+      return _shard_idx == _shards.size() || _wrapped_iterator == other_iterator._wrapped_iterator;
+    }
+
+    const KeyValuePair& dereference() const { return *_wrapped_iterator; }
+
+    void _skip_empty_shards() {
+      while (_wrapped_iterator == _shards[_shard_idx]->entries.end()) {
+        ++_shard_idx;
+        if (_shard_idx == _shards.size()) return;
+        _wrapped_iterator = _shards[_shard_idx]->entries.begin();
+      }
+    }
+
+    const std::vector<std::unique_ptr<Shard>>& _shards;
+    size_t _shard_idx;
+    typename std::list<KeyValuePair>::iterator _wrapped_iterator;
+  };
+
+  explicit ShardedCache(size_t capacity) : AbstractCacheImpl<Key, Value>(capacity), _sketch(capacity) {
+    auto shard_count = size_t{1};
+    while (shard_count * 2 <= MAX_SHARD_COUNT && shard_count * 2 * MIN_SHARD_CAPACITY <= capacity) shard_count *= 2;
+
+    _shards.reserve(shard_count);
+    for (auto shard_idx = size_t{0}; shard_idx < shard_count; ++shard_idx) {
+      _shards.emplace_back(std::make_unique<Shard>());
+    }
+    _distribute_capacity(capacity);
+  }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    _sketch.increment(hash);
+
+    auto it = shard.map.find(key);
+    if (it != shard.map.end()) {
+      it->second->second = value;
+      return;
+    }
+
+    if (shard.capacity == 0) return;
+
+    if (shard.map.size() >= shard.capacity) {
+      auto victim = shard.entries.begin();
+      if (_sketch.estimate(hash) <= _sketch.estimate(_hash(victim->first))) {
+        // Rejected. Give the next entry the chance to be evicted.
+        shard.entries.splice(shard.entries.end(), shard.entries, victim);
+        return;
+      }
+      shard.map.erase(victim->first);
+      shard.entries.erase(victim);
+    }
+
+    shard.entries.emplace_back(key, value);
+    shard.map.emplace(key, std::prev(shard.entries.end()));
+  }
+
+  // The returned reference is only valid as long as no other thread modifies or evicts the entry. Use try_get() for
+  // concurrent accesses.
+  Value& get(const Key& key) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    _sketch.increment(hash);
+    return shard.map.find(key)->second->second;
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    const auto hash = _hash(key);
+    auto& shard = _shard(hash);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+    // Misses are recorded as well, so that a key that is requested repeatedly is admitted eventually
+    _sketch.increment(hash);
+
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return std::nullopt;
+    return it->second->second;
+  }
+
+  bool has(const Key& key) const {
+    const auto& shard = _shard(_hash(key));
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.map.find(key) != shard.map.end();
+  }
+
+  bool erase(const Key& key) {
+    auto& shard = _shard(_hash(key));
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+    auto it = shard.map.find(key);
+    if (it == shard.map.end()) return false;
+
+    shard.entries.erase(it->second);
+    shard.map.erase(it);
+    return true;
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard->mutex);
+      size += shard->map.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    const auto locks = _lock_all_shards();
+    for (const auto& shard : _shards) {
+      shard->entries.clear();
+      shard->map.clear();
+    }
+  }
+
+  // The number of shards remains the same
+  void resize(size_t capacity) {
+    const auto locks = _lock_all_shards();
+    _distribute_capacity(capacity);
+    for (const auto& shard : _shards) {
+      while (shard->map.size() > shard->capacity) _evict(*shard);
+    }
+    _sketch.resize(capacity);
+    this->_capacity = capacity;
+  }
+
+  bool is_thread_safe() const { return true; }
+
+  size_t shard_count() const { return _shards.size(); }
+
+  ErasedIterator begin() { return ErasedIterator{std::make_unique<Iterator>(_shards, 0)}; }
+
+  ErasedIterator end() { return ErasedIterator{std::make_unique<Iterator>(_shards, _shards.size())}; }
+
+ protected:
+  std::vector<std::unique_ptr<Shard>> _shards;
+  FrequencySketch _sketch;
+
+  size_t _hash(const Key& key) const { return std::hash<Key>{}(key); }
+
+  Shard& _shard(const size_t hash) const { return *_shards[hash & (_shards.size() - 1)]; }
+
+  void _distribute_capacity(const size_t capacity) {
+    for (auto shard_idx = size_t{0}; shard_idx < _shards.size(); ++shard_idx) {
+      _shards[shard_idx]->capacity = capacity / _shards.size() + (shard_idx < capacity % _shards.size() ? 1 : 0);
+    }
+  }
+
+  std::vector<std::unique_lock<std::shared_mutex>> _lock_all_shards() {
+    auto locks = std::vector<std::unique_lock<std::shared_mutex>>{};
+    locks.reserve(_shards.size());
+    for (const auto& shard : _shards) locks.emplace_back(shard->mutex);
+    return locks;
+  }
+
+  // Evicts the oldest entry of @param shard, whose lock is held by the caller
+  void _evict(Shard& shard) {
+    shard.map.erase(shard.entries.front().first);
+    shard.entries.pop_front();
+  }
+};
+
+}  // namespace opossum
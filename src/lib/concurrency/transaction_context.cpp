@@ -39,11 +39,17 @@ TransactionContext::~TransactionContext() {
                 return !has_registered_operators || committed_or_rolled_back;
               }()),
               "Has registered operators but has neither been committed nor rolled back.");
+
+  if (_is_waitable) TransactionManager::get()._unregister_waitable_transaction(_transaction_id);
 }
 
 TransactionID TransactionContext::transaction_id() const { return _transaction_id; }
 CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commit_id; }
 
+bool TransactionContext::is_read_only() const {
+  return _transaction_id == TransactionManager::READ_ONLY_TRANSACTION_ID;
+}
+
 CommitID TransactionContext::commit_id() const {
   Assert((_commit_context != nullptr), "TransactionContext cid only available after commit context has been created.");
 
@@ -58,6 +64,8 @@ bool TransactionContext::aborted() const {
 }
 
 bool TransactionContext::rollback() {
+  if (is_read_only()) return true;
+
   const auto success = _abort();
 
   if (!success) return false;
@@ -72,6 +80,11 @@ bool TransactionContext::rollback() {
 }
 
 bool TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
+  if (is_read_only()) {
+    if (callback) callback(_transaction_id);
+    return true;
+  }
+
   const auto success = _prepare_commit();
 
   if (!success) return false;
@@ -97,6 +110,11 @@ bool TransactionContext::commit() {
   return true;
 }
 
+void TransactionContext::register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) {
+  Assert(!is_read_only(), "Read-only transactions cannot execute read-write operators.");
+  _rw_operators.push_back(op);
+}
+
 bool TransactionContext::_abort() {
   const auto from_phase = TransactionPhase::Active;
   const auto to_phase = TransactionPhase::Aborted;
@@ -119,6 +137,7 @@ void TransactionContext::_mark_as_rolled_back() {
               "All read/write operators need to have been rolled back.");
 
   _phase = TransactionPhase::RolledBack;
+  _on_completed();
 }
 
 bool TransactionContext::_prepare_commit() {
@@ -157,6 +176,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(std::function<void(Tran
     // If the transaction context still exists, set its phase to Committed.
     if (auto context_ptr = context_weak_ptr.lock()) {
       context_ptr->_phase = TransactionPhase::Committed;
+      context_ptr->_on_completed();
     }
 
     if (callback) callback(transaction_id);
@@ -182,6 +202,24 @@ void TransactionContext::_wait_for_active_operators_to_finish() const {
   _active_operators_cv.wait(lock, [&] { return _num_active_operators != 0; });
 }
 
+bool TransactionContext::_wait_for_completion(const std::chrono::microseconds timeout) const {
+  std::unique_lock<std::mutex> lock(_completion_mutex);
+  return _completion_cv.wait_for(lock, timeout, [&] {
+    const auto phase = _phase.load();
+    return phase == TransactionPhase::Committed || phase == TransactionPhase::RolledBack;
+  });
+}
+
+void TransactionContext::_on_completed() {
+  if (!_is_waitable) return;
+
+  TransactionManager::get()._unregister_waitable_transaction(_transaction_id);
+
+  // Acquiring the mutex makes sure that no waiter misses the phase change between checking it and going to sleep
+  { std::lock_guard<std::mutex> lock(_completion_mutex); }
+  _completion_cv.notify_all();
+}
+
 bool TransactionContext::_transition(TransactionPhase from_phase, TransactionPhase to_phase,
                                      TransactionPhase end_phase) {
   auto expected = from_phase;
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <vector>
 
 #include "types.hpp"
@@ -46,6 +48,10 @@ enum class TransactionPhase {
 
 /**
  * @brief Representation of a transaction
+ *
+ * Read-only transactions (see TransactionManager::new_read_only_transaction_context()) never lock, insert, or delete
+ * rows. They have nothing to commit or roll back, so they stay in the Active phase forever and can be shared among
+ * statements that use the same snapshot.
  */
 class TransactionContext : public std::enable_shared_from_this<TransactionContext> {
   friend class TransactionManager;
@@ -65,6 +71,11 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    */
   CommitID snapshot_commit_id() const;
 
+  /**
+   * Returns true if the transaction cannot modify data, i.e., its transaction id is READ_ONLY_TRANSACTION_ID.
+   */
+  bool is_read_only() const;
+
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
@@ -84,6 +95,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Aborts and rolls back the transaction.
+   * For read-only transactions, this is a no-op.
    *
    * @returns false if called a second time
    */
@@ -91,6 +103,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Commits the transaction.
+   * For read-only transactions, no commit id is assigned and the callback is called right away.
    *
    * @param callback called when transaction is actually committed
    * @return false if called a second time
@@ -110,7 +123,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
    * Add an operator to the list of read-write operators.
    * Update must not call this because it consists of a Delete and an Insert, which call this themselves.
    */
-  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op) { _rw_operators.push_back(op); }
+  void register_read_write_operator(std::shared_ptr<AbstractReadWriteOperator> op);
 
   /**
    * @defgroup Update the counter of active operators
@@ -165,6 +178,15 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   void _wait_for_active_operators_to_finish() const;
 
+  /**
+   * Used by TransactionManager::wait_for_lock_holder(). Returns true if the transaction has been committed or
+   * rolled back within the timeout.
+   */
+  bool _wait_for_completion(const std::chrono::microseconds timeout) const;
+
+  // Wakes up all transactions waiting for this transaction's completion
+  void _on_completed();
+
   /**
    * Throws an exception if the transition fails and
    * has not been already in phase to_phase or end_phase.
@@ -183,5 +205,12 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   mutable std::condition_variable _active_operators_cv;
   mutable std::mutex _active_operators_mutex;
+
+  // Lock waiting (see TransactionManager::wait_for_lock_holder()). _waiting_for is the transaction whose lock this
+  // transaction currently waits for, i.e., the edge of this transaction in the wait-for graph.
+  bool _is_waitable{false};
+  std::atomic<TransactionID> _waiting_for{0};
+  mutable std::condition_variable _completion_cv;
+  mutable std::mutex _completion_mutex;
 };
 }  // namespace opossum
@@ -1,6 +1,7 @@
 #include "transaction_manager.hpp"
 
 #include <memory>
+#include <unordered_set>
 
 #include "commit_context.hpp"
 #include "transaction_context.hpp"
@@ -13,6 +14,11 @@ void TransactionManager::reset() {
   manager._next_transaction_id = INITIAL_TRANSACTION_ID;
   manager._last_commit_id = INITIAL_COMMIT_ID;
   manager._last_commit_context = std::make_shared<CommitContext>(INITIAL_COMMIT_ID);
+  std::atomic_store(&manager._shared_read_only_transaction_context, {});
+  manager._max_read_only_snapshot_staleness = std::chrono::microseconds{0};
+  manager._lock_wait_timeout = std::chrono::microseconds{0};
+  std::lock_guard<std::mutex> lock(manager._waitable_transactions_mutex);
+  manager._waitable_transactions.clear();
 }
 
 TransactionManager::TransactionManager()
@@ -23,7 +29,92 @@ TransactionManager::TransactionManager()
 CommitID TransactionManager::last_commit_id() const { return _last_commit_id; }
 
 std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context() {
-  return std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+  auto transaction_context = std::make_shared<TransactionContext>(_next_transaction_id++, _last_commit_id);
+
+  if (_lock_wait_timeout.load() > std::chrono::microseconds{0}) {
+    std::lock_guard<std::mutex> lock(_waitable_transactions_mutex);
+    _waitable_transactions.emplace(transaction_context->transaction_id(), transaction_context);
+    transaction_context->_is_waitable = true;
+  }
+
+  return transaction_context;
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::new_read_only_transaction_context() {
+  const auto now = std::chrono::steady_clock::now();
+  const auto last_commit_id = _last_commit_id.load();
+
+  const auto shared_context = std::atomic_load(&_shared_read_only_transaction_context);
+  if (shared_context && (shared_context->transaction_context->snapshot_commit_id() == last_commit_id ||
+                         now - shared_context->creation_time <= _max_read_only_snapshot_staleness)) {
+    return shared_context->transaction_context;
+  }
+
+  // If multiple threads get here at the same time, each of them creates a new context and the last one wins. This
+  // does not hurt, as all of them are valid.
+  auto transaction_context = std::make_shared<TransactionContext>(READ_ONLY_TRANSACTION_ID, last_commit_id);
+  auto new_shared_context = std::make_shared<const SharedReadOnlyTransactionContext>(
+      SharedReadOnlyTransactionContext{transaction_context, now});
+  std::atomic_store(&_shared_read_only_transaction_context, new_shared_context);
+  return transaction_context;
+}
+
+void TransactionManager::set_max_read_only_snapshot_staleness(const std::chrono::microseconds max_staleness) {
+  _max_read_only_snapshot_staleness = max_staleness;
+}
+
+void TransactionManager::set_lock_wait_timeout(const std::chrono::microseconds timeout) {
+  _lock_wait_timeout = timeout;
+}
+
+std::chrono::microseconds TransactionManager::lock_wait_timeout() const { return _lock_wait_timeout; }
+
+bool TransactionManager::wait_for_lock_holder(TransactionContext& waiting_context,
+                                              const TransactionID lock_holder_id) {
+  const auto timeout = _lock_wait_timeout.load();
+  if (timeout == std::chrono::microseconds{0}) return false;
+
+  const auto lock_holder = _waitable_transaction(lock_holder_id);
+  if (!lock_holder) return true;
+
+  // Add the edge to the wait-for graph before looking for cycles. If two transactions add the closing edges of a
+  // cycle concurrently, at least one of them sees the other one's edge.
+  waiting_context._waiting_for = lock_holder_id;
+
+  // Follow the wait-for edges starting at the lock holder. If we end up at the waiting transaction, waiting would
+  // cause a deadlock, so we give up right away. The same goes for cycles among other transactions, as the lock holder
+  // would not finish before the timeout anyway.
+  auto visited_transaction_ids = std::unordered_set<TransactionID>{};
+  auto current_transaction = lock_holder;
+  while (current_transaction) {
+    const auto next_transaction_id = current_transaction->_waiting_for.load();
+    if (next_transaction_id == INVALID_TRANSACTION_ID) break;
+
+    if (next_transaction_id == waiting_context.transaction_id() ||
+        !visited_transaction_ids.emplace(next_transaction_id).second) {
+      waiting_context._waiting_for = INVALID_TRANSACTION_ID;
+      return false;
+    }
+
+    current_transaction = _waitable_transaction(next_transaction_id);
+  }
+
+  const auto lock_holder_finished = lock_holder->_wait_for_completion(timeout);
+  waiting_context._waiting_for = INVALID_TRANSACTION_ID;
+
+  return lock_holder_finished;
+}
+
+void TransactionManager::_unregister_waitable_transaction(const TransactionID transaction_id) {
+  std::lock_guard<std::mutex> lock(_waitable_transactions_mutex);
+  _waitable_transactions.erase(transaction_id);
+}
+
+std::shared_ptr<TransactionContext> TransactionManager::_waitable_transaction(const TransactionID transaction_id) {
+  std::lock_guard<std::mutex> lock(_waitable_transactions_mutex);
+  const auto iter = _waitable_transactions.find(transaction_id);
+  if (iter == _waitable_transactions.end()) return nullptr;
+  return iter->second.lock();
 }
 
 /**
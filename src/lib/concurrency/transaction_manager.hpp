@@ -1,8 +1,12 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "types.hpp"
 #include "utils/singleton.hpp"
@@ -33,6 +37,17 @@
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
  * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
  * a new commit ID that is used to make its changes visible to others.
+ *
+ * Transactions that only read data do not need their own transaction ID and never commit anything. They use a
+ * read-only TransactionContext, which only captures the snapshot commit ID (see new_read_only_transaction_context()).
+ *
+ * Row locks
+ * ---------
+ *
+ * Rows are locked by writing the transaction ID into the MVCC data. By default, a transaction that finds a row locked
+ * by another transaction fails immediately. If a lock wait timeout is set, it instead waits for the lock holder to
+ * finish (see wait_for_lock_holder()). Deadlocks are detected by following the wait-for edges between transactions;
+ * the timeout is the last resort for cycles that are not detected.
  */
 
 namespace opossum {
@@ -57,12 +72,45 @@ class TransactionManager : public Singleton<TransactionManager> {
    */
   std::shared_ptr<TransactionContext> new_transaction_context();
 
+  /**
+   * Returns a transaction context for a transaction that does not modify any data. It does not consume a transaction
+   * ID and committing it is free (see TransactionContext::is_read_only()).
+   * Read-only contexts are shared: As long as no other transaction has committed since the shared context was created,
+   * or the shared context is younger than the configured maximum staleness, the same context (and thus the same
+   * snapshot) is returned to all callers.
+   */
+  std::shared_ptr<TransactionContext> new_read_only_transaction_context();
+
+  /**
+   * Allows read-only transactions to run on a snapshot that is up to @param max_staleness old instead of the most
+   * recent one (default: 0, i.e., read-only transactions always see all committed changes).
+   */
+  void set_max_read_only_snapshot_staleness(const std::chrono::microseconds max_staleness);
+
+  /**
+   * Sets how long a transaction waits for another transaction that holds a lock on a row it wants to modify
+   * (default: 0, i.e., the transaction fails right away). Only affects transactions created after the call.
+   */
+  void set_lock_wait_timeout(const std::chrono::microseconds timeout);
+  std::chrono::microseconds lock_wait_timeout() const;
+
+  /**
+   * Blocks @param waiting_context until the transaction @param lock_holder_id has either been committed or rolled
+   * back. Returns true if the lock holder has finished (or is unknown, in which case it has finished before). Returns
+   * false if waiting is disabled, if waiting would cause a deadlock, or if the lock wait timeout has expired.
+   */
+  bool wait_for_lock_holder(TransactionContext& waiting_context, const TransactionID lock_holder_id);
+
   // TransactionID = 0 means "not set" in the MVCC data. This is the case if the row has (a) just been reserved, but
   // not yet filled with content, (b) been inserted, committed and not marked for deletion, or (c) inserted but
   // deleted in the same transaction (which has not yet committed)
   static constexpr auto INVALID_TRANSACTION_ID = TransactionID{0};
   static constexpr auto INITIAL_TRANSACTION_ID = TransactionID{1};
 
+  // Used by all read-only transactions. It is never handed out to a regular transaction and is thus never found in the
+  // MVCC data.
+  static constexpr auto READ_ONLY_TRANSACTION_ID = std::numeric_limits<TransactionID>::max();
+
  private:
   TransactionManager();
 
@@ -70,6 +118,10 @@ class TransactionManager : public Singleton<TransactionManager> {
   friend class TransactionContext;
 
   std::shared_ptr<CommitContext> _new_commit_context();
+
+  // Called by a TransactionContext once it has been committed or rolled back
+  void _unregister_waitable_transaction(const TransactionID transaction_id);
+  std::shared_ptr<TransactionContext> _waitable_transaction(const TransactionID transaction_id);
   void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
 
   std::atomic<TransactionID> _next_transaction_id;
@@ -80,5 +132,18 @@ class TransactionManager : public Singleton<TransactionManager> {
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
   std::shared_ptr<CommitContext> _last_commit_context;
+
+  struct SharedReadOnlyTransactionContext {
+    std::shared_ptr<TransactionContext> transaction_context;
+    std::chrono::steady_clock::time_point creation_time;
+  };
+
+  std::shared_ptr<const SharedReadOnlyTransactionContext> _shared_read_only_transaction_context;
+  std::chrono::microseconds _max_read_only_snapshot_staleness{0};
+
+  // Transactions that others can wait for. Only populated if the lock wait timeout is set.
+  std::atomic<std::chrono::microseconds> _lock_wait_timeout{std::chrono::microseconds{0}};
+  std::unordered_map<TransactionID, std::weak_ptr<TransactionContext>> _waitable_transactions;
+  std::mutex _waitable_transactions_mutex;
 };
 }  // namespace opossum
@@ -0,0 +1,254 @@
+#include "cost_model_calibrated.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "expression/abstract_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "operators/operator_join_predicate.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/base_encoded_segment.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+CostModelCalibrated::CostModelCalibrated(const CostModelCoefficients& coefficients) : _coefficients(coefficients) {}
+
+const CostModelCoefficients& CostModelCalibrated::coefficients() const { return _coefficients; }
+
+std::vector<OperatorType> CostModelCalibrated::applicable_join_implementations(
+    const std::shared_ptr<JoinNode>& join_node) const {
+  if (join_node->join_mode == JoinMode::Cross) return {};
+
+  const auto& left_input = *join_node->left_input();
+  const auto& right_input = *join_node->right_input();
+
+  const auto operator_join_predicate =
+      OperatorJoinPredicate::from_expression(*join_node->join_predicate(), left_input, right_input);
+  if (!operator_join_predicate) return {};
+
+  const auto join_mode = join_node->join_mode;
+  const auto predicate_condition = operator_join_predicate->predicate_condition;
+  const auto [left_column_id, right_column_id] = operator_join_predicate->column_ids;
+  const auto is_semi_or_anti_join = join_mode == JoinMode::Semi || join_mode == JoinMode::Anti;
+
+  auto join_implementations = applicable_join_implementations(
+      join_mode, predicate_condition, left_input.column_expressions().at(left_column_id)->data_type(),
+      right_input.column_expressions().at(right_column_id)->data_type(),
+      left_input.is_column_nullable(left_column_id) || right_input.is_column_nullable(right_column_id));
+
+  // JoinIndex looks up the values of the left input in the indexes of the right input. The right input needs to be a
+  // data table (i.e., no ReferenceSegments), with either a TableIndex on the join column or all chunks indexed, as
+  // JoinIndex falls back to a nested loop join for chunks without an index. Pruning chunks copies the table without
+  // its TableIndex (see GetTable), so the TableIndex is only used for tables without excluded chunks. With MVCC, the
+  // right input is a Validate of the stored table. JoinIndex then uses the TableIndex and validates the matching rows
+  // itself, except for right and outer joins (see JoinIndex::right_table_with_table_index()).
+  const auto index_supports_predicate_condition = predicate_condition == PredicateCondition::Equals ||
+                                                  predicate_condition == PredicateCondition::NotEquals ||
+                                                  predicate_condition == PredicateCondition::LessThan ||
+                                                  predicate_condition == PredicateCondition::LessThanEquals ||
+                                                  predicate_condition == PredicateCondition::GreaterThan ||
+                                                  predicate_condition == PredicateCondition::GreaterThanEquals;
+
+  const auto right_input_is_validated = right_input.type == LQPNodeType::Validate &&
+                                        right_input.left_input()->type == LQPNodeType::StoredTable &&
+                                        join_mode != JoinMode::Right && join_mode != JoinMode::Outer;
+  const auto& stored_table_input = right_input_is_validated ? *right_input.left_input() : right_input;
+
+  if (!is_semi_or_anti_join && index_supports_predicate_condition &&
+      stored_table_input.type == LQPNodeType::StoredTable) {
+    const auto& stored_table_node = static_cast<const StoredTableNode&>(stored_table_input);
+    const auto table = StorageManager::get().get_table(stored_table_node.table_name);
+    const auto& excluded_chunk_ids = stored_table_node.excluded_chunk_ids();
+
+    const auto table_index = table->get_table_index(right_column_id);
+    const auto table_index_usable =
+        table_index && excluded_chunk_ids.empty() &&
+        table_index->data_type() == left_input.column_expressions().at(left_column_id)->data_type() &&
+        table_index->is_applicable(flip_predicate_condition(predicate_condition), NullValue{});
+
+    // The Validate outputs ReferenceSegments, on which the indexes of the chunks cannot be used
+    auto all_chunks_indexed = !right_input_is_validated && table->chunk_count() > 0;
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count() && all_chunks_indexed; ++chunk_id) {
+      if (std::find(excluded_chunk_ids.begin(), excluded_chunk_ids.end(), chunk_id) != excluded_chunk_ids.end()) {
+        continue;
+      }
+      all_chunks_indexed = !table->get_chunk(chunk_id)->get_indices(std::vector<ColumnID>{right_column_id}).empty();
+    }
+
+    if (table_index_usable || all_chunks_indexed) join_implementations.emplace_back(OperatorType::JoinIndex);
+  }
+
+  return join_implementations;
+}
+
+std::vector<OperatorType> CostModelCalibrated::applicable_join_implementations(
+    const JoinMode join_mode, const PredicateCondition predicate_condition, const DataType left_data_type,
+    const DataType right_data_type, const bool join_columns_nullable) {
+  const auto is_semi_or_anti_join = join_mode == JoinMode::Semi || join_mode == JoinMode::Anti;
+
+  auto join_implementations = std::vector<OperatorType>{};
+
+  if (join_mode == JoinMode::Cross) return join_implementations;
+
+  if (predicate_condition == PredicateCondition::Equals) {
+    if (join_mode != JoinMode::Outer) join_implementations.emplace_back(OperatorType::JoinHash);
+
+    if (!is_semi_or_anti_join) {
+      join_implementations.emplace_back(OperatorType::JoinSortMerge);
+
+      // JoinMPSM only pays off if its partitions are spread across multiple NUMA nodes. It does not support NULLs.
+      if (Topology::get().nodes().size() > 1 && !join_columns_nullable) {
+        join_implementations.emplace_back(OperatorType::JoinMPSM);
+      }
+    }
+  } else if (!is_semi_or_anti_join) {
+    if (predicate_condition != PredicateCondition::NotEquals || join_mode == JoinMode::Inner) {
+      join_implementations.emplace_back(OperatorType::JoinSortMerge);
+    }
+
+    // The cost of the JoinNestedLoop is quadratic, so it is only considered if no hash join is possible. Otherwise, a
+    // cardinality underestimation could make us choose it for large inputs.
+    join_implementations.emplace_back(OperatorType::JoinNestedLoop);
+  }
+
+  // JoinSortMerge and JoinMPSM compare the values of both columns as the same type
+  if (left_data_type != right_data_type) {
+    join_implementations.erase(std::remove_if(join_implementations.begin(), join_implementations.end(),
+                                              [](const auto join_implementation) {
+                                                return join_implementation == OperatorType::JoinSortMerge ||
+                                                       join_implementation == OperatorType::JoinMPSM;
+                                              }),
+                               join_implementations.end());
+    if (join_implementations.empty() && !is_semi_or_anti_join) {
+      join_implementations.emplace_back(OperatorType::JoinNestedLoop);
+    }
+  }
+
+  return join_implementations;
+}
+
+OperatorType CostModelCalibrated::select_join_implementation(const std::shared_ptr<JoinNode>& join_node) const {
+  const auto join_implementations = applicable_join_implementations(join_node);
+  Assert(!join_implementations.empty(), "No join implementation supports " + join_node->description());
+
+  auto cheapest_join_implementation = join_implementations.front();
+  auto cheapest_cost = std::numeric_limits<Cost>::max();
+
+  for (const auto join_implementation : join_implementations) {
+    const auto cost = estimate_join_cost(join_node, join_implementation);
+    if (cost < cheapest_cost) {
+      cheapest_cost = cost;
+      cheapest_join_implementation = join_implementation;
+    }
+  }
+
+  return cheapest_join_implementation;
+}
+
+Cost CostModelCalibrated::estimate_join_cost(const std::shared_ptr<JoinNode>& join_node,
+                                             const OperatorType join_operator_type) const {
+  return _estimate_operator_cost(join_operator_type, join_node);
+}
+
+Cost CostModelCalibrated::estimate_join_cost(const OperatorType join_operator_type, const float left_input_row_count,
+                                             const float right_input_row_count, const float output_row_count) const {
+  const auto coefficients_iter = _coefficients.operators.find(join_operator_type);
+  const auto& coefficients =
+      coefficients_iter != _coefficients.operators.end() ? coefficients_iter->second : _coefficients.fallback;
+
+  return evaluate_cost_function(coefficients,
+                                make_cost_features(left_input_row_count, right_input_row_count, output_row_count));
+}
+
+Cost CostModelCalibrated::_estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const {
+  switch (node->type) {
+    case LQPNodeType::Join: {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode == JoinMode::Cross) return _estimate_operator_cost(OperatorType::Product, node);
+
+      // Predicates that no join operator supports (e.g., during join ordering) are costed as nested loop joins
+      if (applicable_join_implementations(join_node).empty()) {
+        return _estimate_operator_cost(OperatorType::JoinNestedLoop, node);
+      }
+
+      return estimate_join_cost(join_node, select_join_implementation(join_node));
+    }
+
+    case LQPNodeType::Predicate:
+      return _estimate_table_scan_cost(std::static_pointer_cast<PredicateNode>(node));
+
+    case LQPNodeType::Aggregate:
+      return _estimate_operator_cost(OperatorType::Aggregate, node);
+
+    case LQPNodeType::Sort: {
+      // The LQPTranslator creates one Sort operator per ORDER BY expression
+      const auto sort_node = std::static_pointer_cast<SortNode>(node);
+      return _estimate_operator_cost(OperatorType::Sort, node) * sort_node->node_expressions.size();
+    }
+
+    case LQPNodeType::Union:
+      return _estimate_operator_cost(OperatorType::UnionPositions, node);
+
+    default:
+      return evaluate_cost_function(_coefficients.fallback, _cost_features(node));
+  }
+}
+
+Cost CostModelCalibrated::_estimate_table_scan_cost(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  // Find the encoding of the first column that the predicate scans. If it is not a column of a stored table (e.g.,
+  // because it is the result of a projection), the scan operates on unencoded data.
+  auto encoding_type = EncodingType::Unencoded;
+
+  for (const auto& argument : predicate_node->predicate()->arguments) {
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(argument);
+    if (!column_expression) continue;
+
+    const auto& column_reference = column_expression->column_reference;
+    const auto stored_table_node =
+        std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+    if (stored_table_node) {
+      const auto table = StorageManager::get().get_table(stored_table_node->table_name);
+      if (table->chunk_count() > 0) {
+        const auto segment = table->get_chunk(ChunkID{0})->get_segment(column_reference.original_column_id());
+        if (const auto encoded_segment = std::dynamic_pointer_cast<const BaseEncodedSegment>(segment)) {
+          encoding_type = encoded_segment->encoding_type();
+        }
+      }
+    }
+    break;
+  }
+
+  const auto coefficients_iter = _coefficients.table_scan.find(encoding_type);
+  const auto& coefficients =
+      coefficients_iter != _coefficients.table_scan.end() ? coefficients_iter->second : _coefficients.fallback;
+
+  return evaluate_cost_function(coefficients, _cost_features(predicate_node));
+}
+
+Cost CostModelCalibrated::_estimate_operator_cost(const OperatorType operator_type,
+                                                  const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto coefficients_iter = _coefficients.operators.find(operator_type);
+  const auto& coefficients =
+      coefficients_iter != _coefficients.operators.end() ? coefficients_iter->second : _coefficients.fallback;
+
+  return evaluate_cost_function(coefficients, _cost_features(node));
+}
+
+CostFeatureVector CostModelCalibrated::_cost_features(const std::shared_ptr<AbstractLQPNode>& node) {
+  const auto left_input_row_count = node->left_input() ? node->left_input()->get_statistics()->row_count() : 0.0f;
+  const auto right_input_row_count = node->right_input() ? node->right_input()->get_statistics()->row_count() : 0.0f;
+  const auto output_row_count = node->get_statistics()->row_count();
+
+  return make_cost_features(left_input_row_count, right_input_row_count, output_row_count);
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_cost_estimator.hpp"
+#include "cost_model_coefficients.hpp"
+
+namespace opossum {
+
+class JoinNode;
+class PredicateNode;
+
+/**
+ * Physical cost model that estimates the runtime of the operators an LQP node will be translated into. Each operator
+ * has a cost function that is linear in the CostFeatures of its inputs and output. The coefficients of these functions
+ * are obtained by CostModelCalibration, which runs the operators on generated tables and fits the measured runtimes.
+ *
+ * Besides costing plans, the model is used by the LQPTranslator to select the cheapest join implementation.
+ */
+class CostModelCalibrated : public AbstractCostEstimator {
+ public:
+  explicit CostModelCalibrated(const CostModelCoefficients& coefficients = CostModelCoefficients::defaults());
+
+  const CostModelCoefficients& coefficients() const;
+
+  /**
+   * @return the join operators that are able to execute @param join_node, i.e., that support its JoinMode, its
+   *         predicate and its inputs (e.g., JoinIndex requires an index on all chunks of the right input). Empty for
+   *         cross joins and for predicates that cannot be executed by a join operator.
+   */
+  std::vector<OperatorType> applicable_join_implementations(const std::shared_ptr<JoinNode>& join_node) const;
+
+  /**
+   * Same as above, but without JoinIndex, whose applicability depends on the right input. Used by JoinAdaptive, which
+   * decides on the join implementation once its inputs are executed. @param join_columns_nullable is true if either
+   * join column may contain NULLs.
+   */
+  static std::vector<OperatorType> applicable_join_implementations(const JoinMode join_mode,
+                                                                   const PredicateCondition predicate_condition,
+                                                                   const DataType left_data_type,
+                                                                   const DataType right_data_type,
+                                                                   const bool join_columns_nullable);
+
+  // @return the applicable join implementation with the lowest estimated cost
+  OperatorType select_join_implementation(const std::shared_ptr<JoinNode>& join_node) const;
+
+  Cost estimate_join_cost(const std::shared_ptr<JoinNode>& join_node, const OperatorType join_operator_type) const;
+  Cost estimate_join_cost(const OperatorType join_operator_type, const float left_input_row_count,
+                          const float right_input_row_count, const float output_row_count) const;
+
+ protected:
+  Cost _estimate_node_cost(const std::shared_ptr<AbstractLQPNode>& node) const override;
+
+  Cost _estimate_table_scan_cost(const std::shared_ptr<PredicateNode>& predicate_node) const;
+  Cost _estimate_operator_cost(const OperatorType operator_type, const std::shared_ptr<AbstractLQPNode>& node) const;
+
+ private:
+  static CostFeatureVector _cost_features(const std::shared_ptr<AbstractLQPNode>& node);
+
+  const CostModelCoefficients _coefficients;
+};
+
+}  // namespace opossum
@@ -0,0 +1,159 @@
+#include "cost_model_coefficients.hpp"
+
+#include <cmath>
+#include <fstream>
+
+#include "constant_mappings.hpp"
+#include "utils/assert.hpp"
+#include "utils/make_bimap.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The operators that CostModelCalibrated has dedicated coefficients for, with their names in the exported json
+const boost::bimap<OperatorType, std::string> costed_operator_type_to_string =
+    make_bimap<OperatorType, std::string>({{OperatorType::Aggregate, "Aggregate"},
+                                           {OperatorType::JoinHash, "JoinHash"},
+                                           {OperatorType::JoinIndex, "JoinIndex"},
+                                           {OperatorType::JoinMPSM, "JoinMPSM"},
+                                           {OperatorType::JoinNestedLoop, "JoinNestedLoop"},
+                                           {OperatorType::JoinSortMerge, "JoinSortMerge"},
+                                           {OperatorType::Product, "Product"},
+                                           {OperatorType::Sort, "Sort"},
+                                           {OperatorType::UnionPositions, "UnionPositions"}});
+
+float row_count_log(const float row_count) { return row_count > 1.0f ? row_count * std::log2(row_count) : 0.0f; }
+
+CostFunctionCoefficients import_cost_function_coefficients(const nlohmann::json& json) {
+  Assert(json.is_array() && json.size() == COST_FEATURE_COUNT, "Expected one coefficient per CostFeature");
+
+  auto coefficients = CostFunctionCoefficients{};
+  for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+    coefficients[feature_idx] = json[feature_idx].get<float>();
+  }
+  return coefficients;
+}
+
+}  // namespace
+
+CostFeatureVector make_cost_features(const float left_input_row_count, const float right_input_row_count,
+                                     const float output_row_count) {
+  return {1.0f,
+          left_input_row_count,
+          row_count_log(left_input_row_count),
+          right_input_row_count,
+          row_count_log(right_input_row_count),
+          left_input_row_count * right_input_row_count,
+          output_row_count};
+}
+
+Cost evaluate_cost_function(const CostFunctionCoefficients& coefficients, const CostFeatureVector& features) {
+  auto cost = Cost{0};
+  for (auto feature_idx = size_t{0}; feature_idx < COST_FEATURE_COUNT; ++feature_idx) {
+    cost += coefficients[feature_idx] * features[feature_idx];
+  }
+  return cost;
+}
+
+CostModelCoefficients CostModelCoefficients::defaults() {
+  auto coefficients = CostModelCoefficients{};
+
+  // Order of the coefficients: Constant, Left, Left*log(Left), Right, Right*log(Right), Left*Right, Output
+  // clang-format off
+  coefficients.table_scan = {
+    {EncodingType::Unencoded,             {1'000.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}},
+    {EncodingType::Dictionary,            {1'000.0f, 0.8f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}},
+    {EncodingType::RunLength,             {1'000.0f, 0.4f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}},
+    {EncodingType::FixedStringDictionary, {1'000.0f, 1.5f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}},
+    {EncodingType::FrameOfReference,      {1'000.0f, 1.2f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f}}
+  };
+
+  coefficients.operators = {
+    {OperatorType::JoinHash,       {5'000.0f,      8.0f,  0.0f, 8.0f, 0.0f, 0.0f, 5.0f}},
+    {OperatorType::JoinSortMerge,  {20'000.0f,     2.0f,  2.0f, 2.0f, 2.0f, 0.0f, 5.0f}},
+    {OperatorType::JoinNestedLoop, {500.0f,        0.0f,  0.0f, 0.0f, 0.0f, 1.5f, 5.0f}},
+    {OperatorType::JoinIndex,      {500.0f,        50.0f, 0.0f, 0.0f, 0.0f, 0.0f, 8.0f}},
+    {OperatorType::JoinMPSM,       {10'000'000.0f, 2.0f,  0.0f, 2.0f, 0.0f, 0.0f, 5.0f}},
+    {OperatorType::Product,        {500.0f,        0.0f,  0.0f, 0.0f, 0.0f, 0.0f, 2.0f}},
+    {OperatorType::Aggregate,      {1'000.0f,      20.0f, 0.0f, 0.0f, 0.0f, 0.0f, 10.0f}},
+    {OperatorType::Sort,           {1'000.0f,      0.0f,  5.0f, 0.0f, 0.0f, 0.0f, 2.0f}},
+    {OperatorType::UnionPositions, {1'000.0f,      0.0f,  3.0f, 0.0f, 3.0f, 0.0f, 2.0f}}
+  };
+
+  coefficients.fallback = {0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+  // clang-format on
+
+  return coefficients;
+}
+
+CostModelCoefficients import_cost_model_coefficients(const std::string& path) {
+  std::ifstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+  return import_cost_model_coefficients(stream);
+}
+
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, const std::string& path) {
+  std::ofstream stream(path);
+  Assert(stream.good(), std::string("Couldn't open file '") + path + "'");
+  export_cost_model_coefficients(coefficients, stream);
+}
+
+CostModelCoefficients import_cost_model_coefficients(std::istream& stream) {
+  nlohmann::json json;
+  stream >> json;
+  return import_cost_model_coefficients(json);
+}
+
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, std::ostream& stream) {
+  const auto json = export_cost_model_coefficients(coefficients);
+  stream << json.dump(2);
+}
+
+CostModelCoefficients import_cost_model_coefficients(const nlohmann::json& json) {
+  // Start with the defaults so that files written by a partial calibration are still usable
+  auto coefficients = CostModelCoefficients::defaults();
+
+  if (json.count("table_scan")) {
+    const auto& table_scan_json = json.at("table_scan");
+    for (auto json_iter = table_scan_json.begin(); json_iter != table_scan_json.end(); ++json_iter) {
+      const auto encoding_type_iter = encoding_type_to_string.right.find(json_iter.key());
+      Assert(encoding_type_iter != encoding_type_to_string.right.end(), "No such EncodingType: " + json_iter.key());
+      coefficients.table_scan[encoding_type_iter->second] = import_cost_function_coefficients(json_iter.value());
+    }
+  }
+
+  if (json.count("operators")) {
+    const auto& operators_json = json.at("operators");
+    for (auto json_iter = operators_json.begin(); json_iter != operators_json.end(); ++json_iter) {
+      const auto operator_type_iter = costed_operator_type_to_string.right.find(json_iter.key());
+      Assert(operator_type_iter != costed_operator_type_to_string.right.end(),
+             "No coefficients for operator: " + json_iter.key());
+      coefficients.operators[operator_type_iter->second] = import_cost_function_coefficients(json_iter.value());
+    }
+  }
+
+  if (json.count("fallback")) {
+    coefficients.fallback = import_cost_function_coefficients(json.at("fallback"));
+  }
+
+  return coefficients;
+}
+
+nlohmann::json export_cost_model_coefficients(const CostModelCoefficients& coefficients) {
+  nlohmann::json json;
+
+  for (const auto& [encoding_type, function_coefficients] : coefficients.table_scan) {
+    json["table_scan"][encoding_type_to_string.left.at(encoding_type)] = function_coefficients;
+  }
+
+  for (const auto& [operator_type, function_coefficients] : coefficients.operators) {
+    json["operators"][costed_operator_type_to_string.left.at(operator_type)] = function_coefficients;
+  }
+
+  json["fallback"] = coefficients.fallback;
+
+  return json;
+}
+
+}  // namespace opossum
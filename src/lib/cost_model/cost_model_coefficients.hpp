@@ -0,0 +1,72 @@
+#pragma once
+
+#include <array>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+
+#include "json.hpp"
+
+#include "cost.hpp"
+#include "operators/abstract_operator.hpp"
+#include "storage/encoding_type.hpp"
+
+namespace opossum {
+
+/**
+ * The features that the cost functions of CostModelCalibrated are linear in. The log-features are n * log2(n) and
+ * model sorting-based operators, the product models nested-loop-style operators.
+ */
+enum class CostFeature {
+  Constant,
+  LeftInputRowCount,
+  LeftInputRowCountLog,
+  RightInputRowCount,
+  RightInputRowCountLog,
+  InputRowCountProduct,
+  OutputRowCount
+};
+
+constexpr size_t COST_FEATURE_COUNT = 7;
+
+using CostFeatureVector = std::array<float, COST_FEATURE_COUNT>;
+
+CostFeatureVector make_cost_features(const float left_input_row_count, const float right_input_row_count,
+                                     const float output_row_count);
+
+/**
+ * One coefficient per CostFeature. The cost (i.e., the estimated runtime in nanoseconds) of an operator is the dot
+ * product of its coefficients and its features.
+ */
+using CostFunctionCoefficients = CostFeatureVector;
+
+Cost evaluate_cost_function(const CostFunctionCoefficients& coefficients, const CostFeatureVector& features);
+
+struct CostModelCoefficients {
+  /**
+   * Coefficients that reproduce the relative performance of the operators as observed in calibration runs. Use
+   * CostModelCalibration (see hyriseCostModelCalibration) to obtain coefficients for a specific machine.
+   */
+  static CostModelCoefficients defaults();
+
+  // TableScans, by the encoding of the scanned column. Scans on ReferenceSegments are costed by the encoding of the
+  // referenced segments.
+  std::unordered_map<EncodingType, CostFunctionCoefficients> table_scan;
+
+  // All other operators, e.g., the join implementations, Aggregate and Sort
+  std::unordered_map<OperatorType, CostFunctionCoefficients> operators;
+
+  // Used for operators that have no coefficients of their own
+  CostFunctionCoefficients fallback{};
+};
+
+CostModelCoefficients import_cost_model_coefficients(const std::string& path);
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, const std::string& path);
+
+CostModelCoefficients import_cost_model_coefficients(std::istream& stream);
+void export_cost_model_coefficients(const CostModelCoefficients& coefficients, std::ostream& stream);
+
+CostModelCoefficients import_cost_model_coefficients(const nlohmann::json& json);
+nlohmann::json export_cost_model_coefficients(const CostModelCoefficients& coefficients);
+
+}  // namespace opossum
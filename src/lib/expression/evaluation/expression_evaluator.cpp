@@ -3,6 +3,7 @@
 #include <iterator>
 #include <type_traits>
 
+#include "boost/functional/hash.hpp"
 #include "boost/lexical_cast.hpp"
 #include "boost/variant/apply_visitor.hpp"
 
@@ -917,16 +918,21 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
   Assert(expression.parameters.empty() || _chunk,
          "Sub-SELECT references external Columns but Expression doesn't operate on a Table/Chunk");
 
-  std::unordered_map<ParameterID, AllTypeVariant> parameters;
-
+  auto parameter_values = std::vector<AllTypeVariant>(expression.parameters.size());
   for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
-    const auto& parameter_id_column_id = expression.parameters[parameter_idx];
-    const auto parameter_id = parameter_id_column_id.first;
-    const auto column_id = parameter_id_column_id.second;
+    const auto column_id = expression.parameters[parameter_idx].second;
+    parameter_values[parameter_idx] = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+  }
 
-    const auto value = _segment_materializations[column_id]->value_as_variant(chunk_offset);
+  // Rows with the same parameter values (e.g., the same join key in a correlated aggregate) produce the same result,
+  // so the subquery only needs to be executed for the first of them
+  auto& cached_results = _correlated_subquery_results[expression.pqp];
+  const auto cached_result_iter = cached_results.find(parameter_values);
+  if (cached_result_iter != cached_results.end()) return cached_result_iter->second;
 
-    parameters.emplace(parameter_id, value);
+  std::unordered_map<ParameterID, AllTypeVariant> parameters;
+  for (auto parameter_idx = size_t{0}; parameter_idx < expression.parameters.size(); ++parameter_idx) {
+    parameters.emplace(expression.parameters[parameter_idx].first, parameter_values[parameter_idx]);
   }
 
   // TODO(moritz) deep_copy() shouldn't be necessary for every row if we could re-execute PQPs...
@@ -936,7 +942,31 @@ std::shared_ptr<const Table> ExpressionEvaluator::_evaluate_subquery_expression_
   const auto tasks = OperatorTask::make_tasks_from_operator(row_pqp, CleanupTemporaries::Yes);
   CurrentScheduler::schedule_and_wait_for_tasks(tasks);
 
-  return row_pqp->get_output();
+  auto result = row_pqp->get_output();
+  if (cached_results.size() < MAX_CACHED_RESULTS_PER_SUBQUERY) {
+    cached_results.emplace(std::move(parameter_values), result);
+  }
+  return result;
+}
+
+size_t ExpressionEvaluator::ParameterValuesHash::operator()(const std::vector<AllTypeVariant>& parameter_values) const {
+  auto hash = size_t{0};
+  for (const auto& parameter_value : parameter_values) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(parameter_value));
+  }
+  return hash;
+}
+
+bool ExpressionEvaluator::ParameterValuesEqual::operator()(const std::vector<AllTypeVariant>& lhs,
+                                                           const std::vector<AllTypeVariant>& rhs) const {
+  if (lhs.size() != rhs.size()) return false;
+
+  for (auto value_idx = size_t{0}; value_idx < lhs.size(); ++value_idx) {
+    if (variant_is_null(lhs[value_idx]) && variant_is_null(rhs[value_idx])) continue;
+    if (!(lhs[value_idx] == rhs[value_idx])) return false;
+  }
+
+  return true;
 }
 
 std::shared_ptr<BaseValueSegment> ExpressionEvaluator::evaluate_expression_to_segment(
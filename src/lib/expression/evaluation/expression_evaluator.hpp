@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "boost/variant.hpp"
@@ -77,6 +78,23 @@ class ExpressionEvaluator final {
       const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
  private:
+  // Correlated subqueries are executed once per distinct combination of parameter values instead of once per row, see
+  // _evaluate_subquery_expression_for_row(). NULLs are considered equal here, as they lead to the same result.
+  struct ParameterValuesHash {
+    size_t operator()(const std::vector<AllTypeVariant>& parameter_values) const;
+  };
+
+  struct ParameterValuesEqual {
+    bool operator()(const std::vector<AllTypeVariant>& lhs, const std::vector<AllTypeVariant>& rhs) const;
+  };
+
+  // Each result is a table that stays in memory as long as the ExpressionEvaluator does. Once this many results of a
+  // subquery are cached, further results are not cached anymore.
+  static constexpr auto MAX_CACHED_RESULTS_PER_SUBQUERY = size_t{1'024};
+
+  using CorrelatedSubqueryResults = std::unordered_map<std::vector<AllTypeVariant>, std::shared_ptr<const Table>,
+                                                       ParameterValuesHash, ParameterValuesEqual>;
+
   template <typename Result>
   std::shared_ptr<ExpressionResult<Result>> _evaluate_arithmetic_expression(const ArithmeticExpression& expression);
 
@@ -198,6 +216,9 @@ class ExpressionEvaluator final {
   std::vector<std::shared_ptr<BaseExpressionResult>> _segment_materializations;
 
   const std::shared_ptr<const UncorrelatedSubqueryResults> _uncorrelated_subquery_results;
+
+  // Memoized results of correlated subqueries, by their PQP
+  std::unordered_map<std::shared_ptr<AbstractOperator>, CorrelatedSubqueryResults> _correlated_subquery_results;
 };
 
 }  // namespace opossum
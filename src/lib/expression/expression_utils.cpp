@@ -22,6 +22,30 @@ bool expressions_equal(const std::vector<std::shared_ptr<AbstractExpression>>& e
                     [&](const auto& expression_a, const auto& expression_b) { return *expression_a == *expression_b; });
 }
 
+bool expression_has_execution_state(const std::shared_ptr<AbstractExpression>& expression) {
+  auto has_execution_state = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    has_execution_state |= sub_expression->type == ExpressionType::CorrelatedParameter ||
+                           sub_expression->type == ExpressionType::PQPSubquery;
+    return has_execution_state ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return has_execution_state;
+}
+
+std::shared_ptr<AbstractExpression> expression_copy_for_pqp(const std::shared_ptr<AbstractExpression>& expression) {
+  return expression_has_execution_state(expression) ? expression->deep_copy() : expression;
+}
+
+std::vector<std::shared_ptr<AbstractExpression>> expressions_copy_for_pqp(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions) {
+  std::vector<std::shared_ptr<AbstractExpression>> copied_expressions;
+  copied_expressions.reserve(expressions.size());
+  for (const auto& expression : expressions) {
+    copied_expressions.emplace_back(expression_copy_for_pqp(expression));
+  }
+  return copied_expressions;
+}
+
 bool expressions_equal_to_expressions_in_different_lqp(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions_left,
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions_right, const LQPNodeMapping& node_mapping) {
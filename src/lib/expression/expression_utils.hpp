@@ -42,6 +42,22 @@ bool expression_equal_to_expression_in_different_lqp(const AbstractExpression& e
 std::vector<std::shared_ptr<AbstractExpression>> expressions_deep_copy(
     const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
 
+/**
+ * @return whether @param expression holds state that changes when its PQP is executed, i.e., whether it contains
+ *         CorrelatedParameterExpressions (set by AbstractOperator::set_parameters()) or PQPSubqueryExpressions (whose
+ *         PQPs are executed)
+ */
+bool expression_has_execution_state(const std::shared_ptr<AbstractExpression>& expression);
+
+/**
+ * Copy an expression of an operator for AbstractOperator::deep_copy(). Expressions without execution state are never
+ * modified, so instead of deep_copy()ing them, they are shared between the copies of a PQP. This makes copying cached
+ * PQPs (e.g., the common `<column> = <value>` predicates) cheaper.
+ */
+std::shared_ptr<AbstractExpression> expression_copy_for_pqp(const std::shared_ptr<AbstractExpression>& expression);
+std::vector<std::shared_ptr<AbstractExpression>> expressions_copy_for_pqp(
+    const std::vector<std::shared_ptr<AbstractExpression>>& expressions);
+
 /**
  * Utility to AbstractExpression::deep_copy() a vector of expressions while adjusting column references in
  * LQPColumnExpressions according to the node_mapping
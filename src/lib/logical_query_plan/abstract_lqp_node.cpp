@@ -3,12 +3,16 @@
 #include <algorithm>
 #include <unordered_map>
 
+#include "boost/functional/hash.hpp"
+
 #include "expression/abstract_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "join_node.hpp"
 #include "lqp_utils.hpp"
 #include "predicate_node.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "update_node.hpp"
 #include "utils/assert.hpp"
 #include "utils/print_directed_acyclic_graph.hpp"
@@ -217,7 +221,8 @@ bool AbstractLQPNode::is_column_nullable(const ColumnID column_id) const {
 }
 
 const std::shared_ptr<TableStatistics> AbstractLQPNode::get_statistics() {
-  return derive_statistics_from(left_input(), right_input());
+  // Prefer the cardinality observed when executing an equal subplan over the estimation
+  return CardinalityFeedback::get().apply(shared_from_this(), derive_statistics_from(left_input(), right_input()));
 }
 
 std::shared_ptr<TableStatistics> AbstractLQPNode::derive_statistics_from(
@@ -255,6 +260,34 @@ bool AbstractLQPNode::operator==(const AbstractLQPNode& rhs) const {
 
 bool AbstractLQPNode::operator!=(const AbstractLQPNode& rhs) const { return !operator==(rhs); }
 
+size_t AbstractLQPNode::hash() const {
+  auto hash = boost::hash_value(static_cast<size_t>(type));
+
+  // AbstractExpression::hash() can't be used for expressions referencing columns, since it hashes the address of the
+  // node the column originates from
+  for (const auto& node_expression : node_expressions) {
+    visit_expression(node_expression, [&](const auto& sub_expression) {
+      if (sub_expression->type == ExpressionType::LQPColumn) {
+        const auto& column_reference = static_cast<const LQPColumnExpression&>(*sub_expression).column_reference;
+        boost::hash_combine(hash, static_cast<size_t>(column_reference.original_column_id()));
+      } else if (sub_expression->arguments.empty() && sub_expression->type != ExpressionType::LQPSubquery) {
+        boost::hash_combine(hash, sub_expression->hash());
+      } else {
+        boost::hash_combine(hash, static_cast<size_t>(sub_expression->type));
+      }
+      return ExpressionVisitation::VisitArguments;
+    });
+  }
+
+  boost::hash_combine(hash, _on_shallow_hash());
+  if (left_input()) boost::hash_combine(hash, left_input()->hash());
+  if (right_input()) boost::hash_combine(hash, right_input()->hash());
+
+  return hash;
+}
+
+size_t AbstractLQPNode::_on_shallow_hash() const { return 0; }
+
 void AbstractLQPNode::_print_impl(std::ostream& out) const {
   const auto get_inputs_fn = [](const auto& node) {
     std::vector<std::shared_ptr<const AbstractLQPNode>> inputs;
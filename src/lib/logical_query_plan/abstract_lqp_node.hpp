@@ -151,6 +151,8 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
    * that shall be reordered with the same reference node.
    *
    * Inheriting nodes are free to override AbstractLQPNode::derive_statistics_from().
+   *
+   * If the CardinalityFeedback holds the actual row count of an equal subplan, get_statistics() uses it.
    */
   const std::shared_ptr<TableStatistics> get_statistics();
   virtual std::shared_ptr<TableStatistics> derive_statistics_from(
@@ -169,6 +171,12 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   bool operator==(const AbstractLQPNode& rhs) const;
   bool operator!=(const AbstractLQPNode& rhs) const;
 
+  /**
+   * Hash of this node and all its descendants, consistent with operator==. Columns are hashed by their ColumnID only,
+   * so that equal LQPs that were built independently (e.g., for two executions of the same query) hash equally.
+   */
+  size_t hash() const;
+
   const LQPNodeType type;
 
   /**
@@ -186,6 +194,9 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   virtual std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const = 0;
   virtual bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const = 0;
 
+  // Override to hash data fields in derived types that are not part of the node_expressions.
+  virtual size_t _on_shallow_hash() const;
+
  private:
   std::shared_ptr<AbstractLQPNode> _deep_copy_impl(LQPNodeMapping& node_mapping) const;
   std::shared_ptr<AbstractLQPNode> _shallow_copy(LQPNodeMapping& node_mapping) const;
@@ -203,4 +214,17 @@ class AbstractLQPNode : public std::enable_shared_from_this<AbstractLQPNode>, pu
   std::array<std::shared_ptr<AbstractLQPNode>, 2> _inputs;
 };
 
+// Wrapper around AbstractLQPNode::hash(), to enable hash based containers containing std::shared_ptr<AbstractLQPNode>
+struct LQPNodeSharedPtrHash final {
+  size_t operator()(const std::shared_ptr<AbstractLQPNode>& lqp) const { return lqp->hash(); }
+};
+
+// Wrapper around AbstractLQPNode::operator==(), to enable hash based containers containing
+// std::shared_ptr<AbstractLQPNode>
+struct LQPNodeSharedPtrEqual final {
+  bool operator()(const std::shared_ptr<AbstractLQPNode>& lqp_a, const std::shared_ptr<AbstractLQPNode>& lqp_b) const {
+    return *lqp_a == *lqp_b;
+  }
+};
+
 }  // namespace opossum
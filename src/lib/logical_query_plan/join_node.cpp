@@ -135,4 +135,6 @@ bool JoinNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMappi
   return expression_equal_to_expression_in_different_lqp(*join_predicate(), *join_node.join_predicate(), node_mapping);
 }
 
+size_t JoinNode::_on_shallow_hash() const { return static_cast<size_t>(join_mode); }
+
 }  // namespace opossum
@@ -2,12 +2,14 @@
 
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "aggregate_node.hpp"
 #include "alias_node.hpp"
+#include "cost_model/cost_model_calibrated.hpp"
 #include "create_prepared_plan_node.hpp"
 #include "create_table_node.hpp"
 #include "create_view_node.hpp"
@@ -36,7 +38,11 @@
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_mpsm.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -60,6 +66,8 @@
 #include "projection_node.hpp"
 #include "show_columns_node.hpp"
 #include "sort_node.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
@@ -68,8 +76,59 @@
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * @return whether rows of @param stored_table_node can be dropped without affecting the output of @param node other
+ * than removing rows from it, i.e., whether only nodes that pass rows through (or filter them) are in between and none
+ * of them is used by another node.
+ */
+bool is_prunable_path(const std::shared_ptr<AbstractLQPNode>& node,
+                      const std::shared_ptr<const AbstractLQPNode>& stored_table_node) {
+  if (!node || node->output_count() > 1) return false;
+  if (node == stored_table_node) return true;
+
+  switch (node->type) {
+    case LQPNodeType::Predicate:
+      // IndexScans rely on the chunk ids of the stored table
+      if (std::static_pointer_cast<PredicateNode>(node)->scan_type == ScanType::IndexScan) return false;
+      return is_prunable_path(node->left_input(), stored_table_node);
+
+    case LQPNodeType::Validate:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Alias:
+      return is_prunable_path(node->left_input(), stored_table_node);
+
+    case LQPNodeType::Join: {
+      const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode;
+      if (join_mode == JoinMode::Semi) return is_prunable_path(node->left_input(), stored_table_node);
+      if (join_mode != JoinMode::Inner && join_mode != JoinMode::Cross) return false;
+      return is_prunable_path(node->left_input(), stored_table_node) ||
+             is_prunable_path(node->right_input(), stored_table_node);
+    }
+
+    default:
+      return false;
+  }
+}
+
+bool pqp_contains_operator(const std::shared_ptr<const AbstractOperator>& pqp,
+                           const std::shared_ptr<const AbstractOperator>& op) {
+  if (!pqp) return false;
+  if (pqp == op) return true;
+  return pqp_contains_operator(pqp->input_left(), op) || pqp_contains_operator(pqp->input_right(), op);
+}
+
+}  // namespace
+
 namespace opossum {
 
+LQPTranslator::LQPTranslator(const std::shared_ptr<const CostModelCalibrated>& cost_model)
+    : _cost_model(cost_model ? cost_model : std::make_shared<CostModelCalibrated>()) {}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::shared_ptr<AbstractLQPNode>& node) const {
   /**
    * Translate a node (i.e. call `_translate_by_node_type`) only if it hasn't been translated before, otherwise just
@@ -94,6 +153,7 @@ std::shared_ptr<AbstractOperator> LQPTranslator::translate_node(const std::share
   }
 
   const auto pqp = _translate_by_node_type(node->type, node);
+  pqp->set_lqp_node(node);
   _operator_by_lqp_node.emplace(node, pqp);
   return pqp;
 }
@@ -196,6 +256,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = StorageManager::get().get_table(table_name);
+
+  // A TableIndex covers all chunks, so that no TableScan is needed. Its RowIDs refer to the stored table, which is why
+  // it cannot be used if chunks are pruned.
+  const auto table_index = table->get_table_index(column_id);
+  if (table_index && stored_table_node->excluded_chunk_ids().empty() &&
+      table_index->is_applicable(predicate->predicate_condition, value_variant,
+                                 value2_variant.value_or(AllTypeVariant{NullValue{}}))) {
+    return std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
+                                       predicate->predicate_condition, right_values, right_values2);
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   for (ChunkID chunk_id{0u}; chunk_id < table->chunk_count(); ++chunk_id) {
@@ -304,15 +375,104 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   Assert(operator_join_predicate,
          "Couldn't translate join predicate: "s + join_node->join_predicate()->as_column_name());
 
+  const auto join_mode = join_node->join_mode;
+  const auto& column_ids = operator_join_predicate->column_ids;
   const auto predicate_condition = operator_join_predicate->predicate_condition;
 
-  if (predicate_condition == PredicateCondition::Equals && join_node->join_mode != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode,
-                                      operator_join_predicate->column_ids, predicate_condition);
+  _add_runtime_filter(join_node, *operator_join_predicate, input_left_operator, input_right_operator);
+
+  /**
+   * If multiple join implementations are applicable, the decision depends on the input sizes. These are only
+   * estimated here, so JoinAdaptive picks the implementation once the inputs are executed. It uses the join's
+   * estimated selectivity, which is less affected by misestimations of the inputs than the output row count.
+   */
+  if (_cost_model->applicable_join_implementations(join_node).size() > 1) {
+    const auto input_row_count_product = join_node->left_input()->get_statistics()->row_count() *
+                                         join_node->right_input()->get_statistics()->row_count();
+    auto selectivity = std::optional<float>{};
+    if (input_row_count_product > 0.0f) {
+      selectivity = join_node->get_statistics()->row_count() / input_row_count_product;
+    }
+
+    return std::make_shared<JoinAdaptive>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                          predicate_condition, selectivity, _cost_model);
+  }
+
+  // Pick the join implementation that is the cheapest according to the physical cost model
+  switch (_cost_model->select_join_implementation(join_node)) {
+    case OperatorType::JoinHash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                        predicate_condition);
+    case OperatorType::JoinIndex:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                         predicate_condition);
+    case OperatorType::JoinMPSM:
+      return std::make_shared<JoinMPSM>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                        predicate_condition);
+    case OperatorType::JoinNestedLoop:
+      return std::make_shared<JoinNestedLoop>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                              predicate_condition);
+    case OperatorType::JoinSortMerge:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_mode, column_ids,
+                                             predicate_condition);
+    default:
+      Fail("Cost model selected an operator that is not a join implementation");
+  }
+}
+
+void LQPTranslator::_add_runtime_filter(const std::shared_ptr<JoinNode>& join_node,
+                                        const OperatorJoinPredicate& operator_join_predicate,
+                                        const std::shared_ptr<AbstractOperator>& input_left_operator,
+                                        const std::shared_ptr<AbstractOperator>& input_right_operator) const {
+  /**
+   * Rows of the probe side without a join partner on the build side do not contribute to the output of inner and
+   * semi joins. If the probe side's join column comes (unmodified) from a stored table, the GetTable for that table
+   * is passed a runtime filter on the build side's join column, so that it skips chunks without join partners.
+   */
+  const auto join_mode = join_node->join_mode;
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Semi) return;
+  if (operator_join_predicate.predicate_condition != PredicateCondition::Equals) return;
+
+  // Semi joins only emit the rows of their left input. For inner joins, skipping chunks of the larger input pays off.
+  auto probe_side_is_left = true;
+  if (join_mode == JoinMode::Inner) {
+    probe_side_is_left = join_node->left_input()->get_statistics()->row_count() >=
+                         join_node->right_input()->get_statistics()->row_count();
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode,
-                                         operator_join_predicate->column_ids, predicate_condition);
+  const auto& probe_node = probe_side_is_left ? join_node->left_input() : join_node->right_input();
+  const auto probe_column_id =
+      probe_side_is_left ? operator_join_predicate.column_ids.first : operator_join_predicate.column_ids.second;
+  const auto build_column_id =
+      probe_side_is_left ? operator_join_predicate.column_ids.second : operator_join_predicate.column_ids.first;
+  const auto& build_operator = probe_side_is_left ? input_right_operator : input_left_operator;
+
+  const auto probe_column_expression =
+      std::dynamic_pointer_cast<LQPColumnExpression>(probe_node->column_expressions().at(probe_column_id));
+  if (!probe_column_expression) return;
+
+  const auto& column_reference = probe_column_expression->column_reference;
+  const auto original_node = column_reference.original_node();
+  if (!original_node || original_node->type != LQPNodeType::StoredTable) return;
+  if (!is_prunable_path(probe_node, original_node)) return;
+
+  // With a single chunk, there is nothing to gain
+  const auto& table_name = static_cast<const StoredTableNode&>(*original_node).table_name;
+  const auto table = StorageManager::get().get_table(table_name);
+  if (table->chunk_count() < 2) return;
+
+  // A GetTable that prunes chunks outputs a copy of the table without its TableIndex, which a JoinIndex would use to
+  // look up the values of the left input in the right one
+  if (!probe_side_is_left && table->get_table_index(column_reference.original_column_id())) return;
+
+  const auto get_table =
+      std::dynamic_pointer_cast<GetTable>(translate_node(std::const_pointer_cast<AbstractLQPNode>(original_node)));
+  if (!get_table || get_table->runtime_filter_count() >= 2) return;
+
+  // The GetTable must not be executed before the build side, which is the case if the build side reads it as well
+  if (pqp_contains_operator(build_operator, get_table)) return;
+
+  get_table->add_runtime_filter(build_operator, build_column_id, column_reference.original_column_id());
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
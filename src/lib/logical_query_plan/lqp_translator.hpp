@@ -10,8 +10,10 @@
 namespace opossum {
 
 class AbstractOperator;
+class CostModelCalibrated;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -20,9 +22,13 @@ struct OperatorJoinPredicate;
 /**
  * Translates an LQP (Logical Query Plan), represented by its root node, into an Operator tree for the execution
  * engine, which in return is represented by its root Operator.
+ *
+ * Where multiple operators implement a node (e.g., the join implementations), the physical cost model decides which
+ * one is used. If no cost model is passed, CostModelCalibrated with its default coefficients is used.
  */
 class LQPTranslator {
  public:
+  explicit LQPTranslator(const std::shared_ptr<const CostModelCalibrated>& cost_model = nullptr);
   virtual ~LQPTranslator() = default;
 
   virtual std::shared_ptr<AbstractOperator> translate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -41,6 +47,10 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  void _add_runtime_filter(const std::shared_ptr<JoinNode>& join_node,
+                           const OperatorJoinPredicate& operator_join_predicate,
+                           const std::shared_ptr<AbstractOperator>& input_left_operator,
+                           const std::shared_ptr<AbstractOperator>& input_right_operator) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -67,6 +77,8 @@ class LQPTranslator {
       const std::vector<std::shared_ptr<AbstractExpression>>& lqp_expressions,
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  std::shared_ptr<const CostModelCalibrated> _cost_model;
+
   // Cache operator subtrees by LQP node to avoid executing operators below a diamond shape multiple times
   mutable std::unordered_map<std::shared_ptr<const AbstractLQPNode>, std::shared_ptr<AbstractOperator>>
       _operator_by_lqp_node;
@@ -59,4 +59,6 @@ bool StoredTableNode::_on_shallow_equals(const AbstractLQPNode& rhs, const LQPNo
   return table_name == stored_table_node.table_name && _excluded_chunk_ids == stored_table_node._excluded_chunk_ids;
 }
 
+size_t StoredTableNode::_on_shallow_hash() const { return std::hash<std::string>{}(table_name); }
+
 }  // namespace opossum
@@ -32,6 +32,7 @@ class StoredTableNode : public EnableMakeForLQPNode<StoredTableNode>, public Abs
  protected:
   std::shared_ptr<AbstractLQPNode> _on_shallow_copy(LQPNodeMapping& node_mapping) const override;
   bool _on_shallow_equals(const AbstractLQPNode& rhs, const LQPNodeMapping& node_mapping) const override;
+  size_t _on_shallow_hash() const override;
 
  private:
   mutable std::optional<std::vector<std::shared_ptr<AbstractExpression>>> _expressions;
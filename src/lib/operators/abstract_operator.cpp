@@ -7,6 +7,7 @@
 
 #include "abstract_read_only_operator.hpp"
 #include "concurrency/transaction_context.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
@@ -25,6 +26,10 @@ OperatorType AbstractOperator::type() const { return _type; }
 
 void AbstractOperator::execute() {
   DTRACE_PROBE1(HYRISE, OPERATOR_STARTED, name().c_str());
+
+  // If the query was cancelled, the inputs might not have been executed
+  CancellationToken::check_current();
+
   DebugAssert(!_input_left || _input_left->get_output(), "Left input has not yet been executed");
   DebugAssert(!_input_right || _input_right->get_output(), "Right input has not yet been executed");
   DebugAssert(!_output, "Operator has already been executed");
@@ -43,7 +48,13 @@ void AbstractOperator::execute() {
       return;
     }
     transaction_context->on_operator_started();
-    _output = _on_execute(transaction_context);
+    try {
+      _output = _on_execute(transaction_context);
+    } catch (const QueryCancelledException&) {
+      // Otherwise, the rollback of the cancelled query would wait for this operator forever
+      transaction_context->on_operator_finished();
+      throw;
+    }
     transaction_context->on_operator_finished();
   } else {
     _output = _on_execute(nullptr);
@@ -53,6 +64,7 @@ void AbstractOperator::execute() {
   _on_cleanup();
 
   _performance_data->walltime = performance_timer.lap();
+  _performance_data->output_row_count = _output ? _output->row_count() : 0;
 
   DTRACE_PROBE5(HYRISE, OPERATOR_EXECUTED, name().c_str(), _performance_data->walltime.count(),
                 _output ? _output->row_count() : 0, _output ? _output->chunk_count() : 0,
@@ -121,6 +133,10 @@ std::shared_ptr<AbstractOperator> AbstractOperator::mutable_input_right() const
 
 const OperatorPerformanceData& AbstractOperator::performance_data() const { return *_performance_data; }
 
+const std::shared_ptr<AbstractLQPNode>& AbstractOperator::lqp_node() const { return _lqp_node; }
+
+void AbstractOperator::set_lqp_node(const std::shared_ptr<AbstractLQPNode>& lqp_node) { _lqp_node = lqp_node; }
+
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_left() const { return _input_left; }
 
 std::shared_ptr<const AbstractOperator> AbstractOperator::input_right() const { return _input_right; }
@@ -172,6 +188,7 @@ std::shared_ptr<AbstractOperator> AbstractOperator::_deep_copy_impl(
 
   const auto copied_op = _on_deep_copy(copied_input_left, copied_input_right);
   if (_transaction_context) copied_op->set_transaction_context(*_transaction_context);
+  copied_op->set_lqp_node(_lqp_node);
 
   copied_ops.emplace(this, copied_op);
 
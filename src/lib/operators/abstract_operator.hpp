@@ -11,6 +11,7 @@
 
 namespace opossum {
 
+class AbstractLQPNode;
 class OperatorTask;
 class Table;
 class TransactionContext;
@@ -28,6 +29,7 @@ enum class OperatorType {
   IndexScan,
   Insert,
   JitOperatorWrapper,
+  JoinAdaptive,
   JoinHash,
   JoinIndex,
   JoinMPSM,
@@ -104,7 +106,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   void set_transaction_context_recursively(const std::weak_ptr<TransactionContext>& transaction_context);
 
   // Returns a new instance of the same operator with the same configuration.
-  // Recursively copies the input operators.
+  // Recursively copies the input operators. Expressions without execution state (i.e., without parameters and
+  // subqueries) are shared with the copy, see expression_copy_for_pqp().
   // An operator needs to implement this method in order to be cacheable.
   std::shared_ptr<AbstractOperator> deep_copy() const;
 
@@ -129,6 +132,11 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // Set parameters (AllParameterVariants or CorrelatedParameterExpressions) to their respective values
   void set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters);
 
+  // The LQP node this operator was translated from (set by the LQPTranslator, can be nullptr). Used to compare the
+  // estimated with the actual cardinality, e.g., for q-error reports.
+  const std::shared_ptr<AbstractLQPNode>& lqp_node() const;
+  void set_lqp_node(const std::shared_ptr<AbstractLQPNode>& lqp_node);
+
  protected:
   // abstract method to actually execute the operator
   // execute and get_output are split into two methods to allow for easier
@@ -170,6 +178,8 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   std::optional<std::weak_ptr<TransactionContext>> _transaction_context;
 
   const std::unique_ptr<OperatorPerformanceData> _performance_data;
+
+  std::shared_ptr<AbstractLQPNode> _lqp_node;
 };
 
 }  // namespace opossum
@@ -14,6 +14,7 @@
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
@@ -347,6 +348,8 @@ void Aggregate::_aggregate() {
         AggregateKeyEntry id_counter = 1u;
 
         for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+          CancellationToken::check_current();
+
           const auto chunk_in = input_table->get_chunk(chunk_id);
           const auto base_segment = chunk_in->get_segment(column_id);
 
@@ -417,6 +420,8 @@ void Aggregate::_aggregate() {
 
   // Process Chunks and perform aggregations
   for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); ++chunk_id) {
+    CancellationToken::check_current();
+
     auto chunk_in = input_table->get_chunk(chunk_id);
 
     const auto& hash_keys = keys_per_chunk[chunk_id];
@@ -51,34 +51,53 @@ std::shared_ptr<const Table> Delete::_on_execute(std::shared_ptr<TransactionCont
     for (auto row_id : *pos_list) {
       auto referenced_chunk = first_segment->referenced_table()->get_chunk(row_id.chunk_id);
 
-      // Scope for the lock on the MVCC data
-      {
-        auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+      // If the row is locked by another transaction, we may wait for that transaction to finish (see
+      // TransactionManager::wait_for_lock_holder()) and try again. We only wait once per lock holder: If it has
+      // committed, the row stays locked and we fail. If it was rolled back, the row is unlocked and we can lock it.
+      auto last_lock_holder_id = TransactionManager::INVALID_TRANSACTION_ID;
 
-        DebugAssert(
-            Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
-                                     mvcc_data->tids[row_id.chunk_offset], mvcc_data->begin_cids[row_id.chunk_offset],
-                                     mvcc_data->end_cids[row_id.chunk_offset]),
-            "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
+      while (true) {
+        auto lock_holder_id = TransactionManager::INVALID_TRANSACTION_ID;
 
-        // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
-        auto expected = 0u;
-        const auto success = mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
+        // Scope for the lock on the MVCC data
+        {
+          auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
+
+          DebugAssert(
+              Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
+                                       mvcc_data->tids[row_id.chunk_offset], mvcc_data->begin_cids[row_id.chunk_offset],
+                                       mvcc_data->end_cids[row_id.chunk_offset]),
+              "Trying to delete a row that is not visible to the current transaction. Has the input been validated?");
+
+          // Actual row "lock" for delete happens here, making sure that no other transaction can delete this row
+          auto expected = 0u;
+          const auto success =
+              mvcc_data->tids[row_id.chunk_offset].compare_exchange_strong(expected, _transaction_id);
+
+          if (success) break;
 
-        if (!success) {
           // If the row has a set TID, it might be a row that our TX inserted
           // No need to compare-and-swap here, because we can only run into conflicts when two transactions try to
           // change this row from the initial tid
-
-          if (mvcc_data->tids[row_id.chunk_offset] == _transaction_id) {
+          if (expected == _transaction_id) {
             // Make sure that even we don't see it anymore
             mvcc_data->tids[row_id.chunk_offset] = TransactionManager::INVALID_TRANSACTION_ID;
-          } else {
-            // the row is already locked by someone else and the transaction needs to be rolled back
-            _mark_as_failed();
-            return nullptr;
+            break;
           }
+
+          lock_holder_id = expected;
+        }
+
+        // The row is already locked by someone else. Unless we can wait for the lock holder to finish (without
+        // holding the MVCC lock, which the lock holder needs to commit or roll back), the transaction needs to be
+        // rolled back.
+        if (lock_holder_id == last_lock_holder_id ||
+            !TransactionManager::get().wait_for_lock_holder(*context, lock_holder_id)) {
+          _mark_as_failed();
+          return nullptr;
         }
+
+        last_lock_holder_id = lock_holder_id;
       }
     }
   }
@@ -100,6 +119,7 @@ void Delete::_on_commit_records(const CommitID cid) {
       referenced_chunk->get_scoped_mvcc_data_lock()->end_cids[row_id.chunk_offset] = cid;
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
+    referenced_table->record_modification(cid);
 
     // Update statistics about deleted rows
     const auto table_statistics = referenced_table->table_statistics();
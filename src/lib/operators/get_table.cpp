@@ -2,13 +2,18 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_set>
 #include <vector>
 
+#include "resolve_type.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "storage/segment_iterate.hpp"
 #include "storage/storage_manager.hpp"
 #include "types.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
@@ -20,9 +25,17 @@ const std::string GetTable::description(DescriptionMode description_mode) const
   const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
   std::stringstream stream;
   stream << name() << separator << "(" << table_name() << ")";
+  if (_included_chunk_ids) {
+    stream << separator << "(" << _included_chunk_ids->size() << " Chunks included)";
+  }
   if (!_excluded_chunk_ids.empty()) {
     stream << separator << "(" << _excluded_chunk_ids.size() << " Chunks pruned)";
   }
+  if (!_runtime_filters.empty()) {
+    stream << separator << "(" << _runtime_filters.size() << " Runtime Filters";
+    if (_output) stream << ", " << _runtime_pruned_chunk_count << " Chunks pruned";
+    stream << ")";
+  }
   return stream.str();
 }
 
@@ -32,11 +45,43 @@ void GetTable::set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk
   _excluded_chunk_ids = excluded_chunk_ids;
 }
 
+const std::vector<ChunkID>& GetTable::excluded_chunk_ids() const { return _excluded_chunk_ids; }
+
+void GetTable::set_included_chunk_ids(const std::vector<ChunkID>& included_chunk_ids) {
+  _included_chunk_ids = included_chunk_ids;
+}
+
+const std::optional<std::vector<ChunkID>>& GetTable::included_chunk_ids() const { return _included_chunk_ids; }
+
+void GetTable::add_runtime_filter(const std::shared_ptr<const AbstractOperator>& source_operator,
+                                  const ColumnID source_column_id, const ColumnID column_id) {
+  Assert(source_operator, "Runtime filter needs a source operator");
+
+  if (_runtime_filters.empty()) {
+    _input_left = source_operator;
+  } else if (_runtime_filters.size() == 1) {
+    _input_right = source_operator;
+  } else {
+    Fail("GetTable supports at most two runtime filters");
+  }
+
+  _runtime_filters.emplace_back(RuntimeFilter{source_column_id, column_id});
+}
+
+size_t GetTable::runtime_filter_count() const { return _runtime_filters.size(); }
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
   auto copy = std::make_shared<GetTable>(_name);
   copy->set_excluded_chunk_ids(_excluded_chunk_ids);
+  if (_included_chunk_ids) copy->set_included_chunk_ids(*_included_chunk_ids);
+  if (_runtime_filters.size() > 0) {
+    copy->add_runtime_filter(copied_input_left, _runtime_filters[0].source_column_id, _runtime_filters[0].column_id);
+  }
+  if (_runtime_filters.size() > 1) {
+    copy->add_runtime_filter(copied_input_right, _runtime_filters[1].source_column_id, _runtime_filters[1].column_id);
+  }
   return copy;
 }
 
@@ -44,22 +89,101 @@ void GetTable::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeV
 
 std::shared_ptr<const Table> GetTable::_on_execute() {
   auto original_table = StorageManager::get().get_table(_name);
-  if (_excluded_chunk_ids.empty()) {
+
+  auto excluded_chunks_set = std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
+  for (auto filter_idx = size_t{0}; filter_idx < _runtime_filters.size(); ++filter_idx) {
+    _add_runtime_excluded_chunk_ids(*original_table, filter_idx, excluded_chunks_set);
+  }
+  _runtime_pruned_chunk_count = excluded_chunks_set.size() - _excluded_chunk_ids.size();
+
+  if (excluded_chunks_set.empty() && !_included_chunk_ids) {
     return original_table;
   }
 
   // we create a copy of the original table and don't include the excluded chunks
   const auto pruned_table = std::make_shared<Table>(original_table->column_definitions(), TableType::Data,
                                                     original_table->max_chunk_size(), original_table->has_mvcc());
-  const auto excluded_chunks_set =
-      std::unordered_set<ChunkID>(_excluded_chunk_ids.cbegin(), _excluded_chunk_ids.cend());
-  for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+  const auto append_chunk_unless_excluded = [&](const ChunkID chunk_id) {
     if (excluded_chunks_set.find(chunk_id) == excluded_chunks_set.end()) {
       pruned_table->append_chunk(original_table->get_chunk(chunk_id));
     }
+  };
+
+  if (_included_chunk_ids) {
+    for (const auto chunk_id : *_included_chunk_ids) {
+      append_chunk_unless_excluded(chunk_id);
+    }
+  } else {
+    for (ChunkID chunk_id{0}; chunk_id < original_table->chunk_count(); ++chunk_id) {
+      append_chunk_unless_excluded(chunk_id);
+    }
   }
 
   return pruned_table;
 }
 
+void GetTable::_add_runtime_excluded_chunk_ids(const Table& table, const size_t filter_idx,
+                                               std::unordered_set<ChunkID>& excluded_chunk_ids) const {
+  const auto& runtime_filter = _runtime_filters[filter_idx];
+  const auto& source_table = filter_idx == 0 ? input_table_left() : input_table_right();
+
+  const auto data_type = table.column_data_type(runtime_filter.column_id);
+  // The ChunkStatistics cannot be probed with values of another type without casting them, which might be lossy
+  if (source_table->column_data_type(runtime_filter.source_column_id) != data_type) return;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    // Summarize the join keys of the source. NULLs never find a join partner and are ignored.
+    auto min = std::optional<ColumnDataType>{};
+    auto max = std::optional<ColumnDataType>{};
+    auto distinct_values = std::unordered_set<ColumnDataType>{};
+    auto distinct_values_exceeded = false;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < source_table->chunk_count(); ++chunk_id) {
+      const auto& segment = *source_table->get_chunk(chunk_id)->get_segment(runtime_filter.source_column_id);
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) return;
+        const auto& value = position.value();
+
+        if (!min || value < *min) min = value;
+        if (!max || value > *max) max = value;
+
+        if (distinct_values_exceeded) return;
+        distinct_values.emplace(value);
+        if (distinct_values.size() > MAX_RUNTIME_FILTER_DISTINCT_VALUE_COUNT) {
+          distinct_values_exceeded = true;
+          distinct_values.clear();
+        }
+      });
+    }
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      if (excluded_chunk_ids.count(chunk_id)) continue;
+
+      // Without any join key, no chunk has a join partner
+      if (!min) {
+        excluded_chunk_ids.emplace(chunk_id);
+        continue;
+      }
+
+      const auto statistics = table.get_chunk(chunk_id)->statistics();
+      if (!statistics) continue;
+
+      if (statistics->can_prune(runtime_filter.column_id, PredicateCondition::Between, *min, *max)) {
+        excluded_chunk_ids.emplace(chunk_id);
+        continue;
+      }
+
+      if (distinct_values_exceeded) continue;
+
+      const auto all_values_pruned =
+          std::all_of(distinct_values.cbegin(), distinct_values.cend(), [&](const auto& value) {
+            return statistics->can_prune(runtime_filter.column_id, PredicateCondition::Equals, value);
+          });
+      if (all_values_pruned) excluded_chunk_ids.emplace(chunk_id);
+    }
+  });
+}
+
 }  // namespace opossum
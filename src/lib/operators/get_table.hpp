@@ -1,7 +1,9 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
@@ -20,6 +22,34 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::string& table_name() const;
 
   void set_excluded_chunk_ids(const std::vector<ChunkID>& excluded_chunk_ids);
+  const std::vector<ChunkID>& excluded_chunk_ids() const;
+
+  /**
+   * Restricts the output to the chunks with @param included_chunk_ids (e.g., a single chunk, see ResultChunkStream).
+   * Chunks appended to the table later are not read, and excluded chunks and runtime filters still apply. By default,
+   * all chunks are included.
+   */
+  void set_included_chunk_ids(const std::vector<ChunkID>& included_chunk_ids);
+  const std::optional<std::vector<ChunkID>>& included_chunk_ids() const;
+
+  /**
+   * Runtime filters implement sideways information passing for joins: Once the other input of a join (the build side,
+   * @param source_operator) is executed, the values of its column @param source_column_id are summarized as their
+   * range and, if there are only few, as a set of distinct values. Chunks whose ChunkStatistics (MinMaxFilter,
+   * RangeFilter, CountingQuotientFilter) prove that column @param column_id contains none of these values cannot have
+   * a join partner and are skipped.
+   *
+   * @param source_operator becomes an input of the GetTable, so that it is executed first. Thus, at most two runtime
+   * filters can be added. It is up to the caller to make sure that dropping rows without join partners is correct,
+   * i.e., that the GetTable feeds only into the probe side of an inner or semi join.
+   */
+  void add_runtime_filter(const std::shared_ptr<const AbstractOperator>& source_operator,
+                          const ColumnID source_column_id, const ColumnID column_id);
+  size_t runtime_filter_count() const;
+
+  // Up to this number of distinct values, runtime filters probe the chunks for each value. Above, only the range is
+  // used.
+  static constexpr auto MAX_RUNTIME_FILTER_DISTINCT_VALUE_COUNT = size_t{64};
 
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
@@ -29,8 +59,22 @@ class GetTable : public AbstractReadOnlyOperator {
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
+  struct RuntimeFilter {
+    ColumnID source_column_id;
+    ColumnID column_id;
+  };
+
+  // Adds the chunks of @param table that the runtime filter with the index @param filter_idx prunes
+  void _add_runtime_excluded_chunk_ids(const Table& table, const size_t filter_idx,
+                                       std::unordered_set<ChunkID>& excluded_chunk_ids) const;
+
   // name of the table to retrieve
   const std::string _name;
   std::vector<ChunkID> _excluded_chunk_ids;
+  std::optional<std::vector<ChunkID>> _included_chunk_ids;
+
+  // The source operator of the first runtime filter is the left input, the one of the second filter is the right input
+  std::vector<RuntimeFilter> _runtime_filters;
+  size_t _runtime_pruned_chunk_count{0};
 };
 }  // namespace opossum
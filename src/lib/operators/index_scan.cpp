@@ -7,6 +7,7 @@
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -34,6 +35,18 @@ std::shared_ptr<const Table> IndexScan::_on_execute() {
 
   _out_table = std::make_shared<Table>(_in_table->column_definitions(), TableType::References);
 
+  // A TableIndex covers all chunks with a single lookup. The chunk-wise indexes are used if the scan is restricted to
+  // certain chunks.
+  if (_included_chunk_ids.empty() && _left_column_ids.size() == 1) {
+    const auto table_index = _in_table->get_table_index(_left_column_ids.front());
+    const auto right_value2 =
+        _predicate_condition == PredicateCondition::Between ? _right_values2.front() : AllTypeVariant{NullValue{}};
+    if (table_index && table_index->is_applicable(_predicate_condition, _right_values.front(), right_value2)) {
+      _scan_table_index(*table_index, right_value2);
+      return _out_table;
+    }
+  }
+
   std::mutex output_mutex;
 
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
@@ -87,6 +100,20 @@ std::shared_ptr<AbstractTask> IndexScan::_create_job_and_schedule(const ChunkID
   return job_task;
 }
 
+void IndexScan::_scan_table_index(const TableIndex& table_index, const AllTypeVariant& right_value2) {
+  const auto matches_out = std::make_shared<PosList>();
+  table_index.append_matches(_predicate_condition, _right_values.front(), *matches_out, right_value2);
+
+  // The index returns the matches ordered by their values. Order them by their position instead, as a scan does.
+  std::sort(matches_out->begin(), matches_out->end());
+
+  Segments segments;
+  for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
+    segments.push_back(std::make_shared<ReferenceSegment>(_in_table, column_id, matches_out));
+  }
+  _out_table->append_chunk(segments);
+}
+
 void IndexScan::_validate_input() {
   Assert(_predicate_condition != PredicateCondition::Like, "Predicate condition not supported by index scan.");
   Assert(_predicate_condition != PredicateCondition::NotLike, "Predicate condition not supported by index scan.");
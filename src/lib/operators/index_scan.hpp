@@ -12,12 +12,16 @@
 namespace opossum {
 
 class Table;
+class TableIndex;
 class AbstractTask;
 
 /**
  * Operator that performs a predicate search using indices
  *
  * Note: Scans only the set of chunks passed to the constructor
+ *
+ * If no chunks were passed and the input table has an applicable TableIndex on the (single) scanned column, the
+ * TableIndex is used for all chunks instead of the chunks' indexes of index_type.
  */
 class IndexScan : public AbstractReadOnlyOperator {
   friend class LQPTranslatorTest;
@@ -47,6 +51,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  void _scan_table_index(const TableIndex& table_index, const AllTypeVariant& right_value2);
 
  private:
   const SegmentIndexType _index_type;
@@ -8,8 +8,11 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/segment_accessor.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_segment.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "tasks/table_statistics_update_task.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 
@@ -78,11 +81,23 @@ class TypedSegmentProcessor : public AbstractTypedSegmentProcessor {
 
       // Ignore source value and only set null to true
       casted_target->null_values()[target_start_index] = true;
+    } else if (source->data_type() == data_type_from_type<T>()) {
+      // Since we have no guarantee that a ReferenceSegment references only a single other segment, we access the
+      // values through a typed SegmentAccessor. This avoids going through AllTypeVariant for every value, which is
+      // noticeable for Updates, where unchanged columns are usually forwarded as ReferenceSegments.
+      const auto accessor = create_segment_accessor<T>(source);
+      for (auto i = 0u; i < length; i++) {
+        const auto value = accessor->access(source_start_index + i);
+        if (!value) {
+          Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
+          values[target_start_index + i] = T{};
+          casted_target->null_values()[target_start_index + i] = true;
+        } else {
+          values[target_start_index + i] = *value;
+        }
+      }
     } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceSegment>(source)){
-      // since we have no guarantee that a ReferenceSegment references only a single other segment,
-      // this would require us to find out the referenced segment's type for each single row.
-      // instead, we just use the slow path below.
+      // The data types of source and target differ, so we use the slow path below.
       for (auto i = 0u; i < length; i++) {
         auto ref_value = (*source)[source_start_index + i];
         if (variant_is_null(ref_value)) {
@@ -156,6 +171,12 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
 
       remaining_rows -= rows_to_insert_this_loop;
 
+      // A full chunk does not accept any more rows. Marking it as immutable makes subsequent Inserts append a new
+      // chunk and allows the full chunk to be encoded once all its rows are committed (see _encode_completed_chunks()).
+      if (current_chunk->size() == _target_table->max_chunk_size()) {
+        current_chunk->mark_immutable();
+      }
+
       // Create new chunk if necessary.
       if (remaining_rows > 0) {
         _target_table->append_mutable_chunk();
@@ -163,7 +184,6 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       }
     }
   }
-  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
 
   // Then, actually insert the data.
   auto input_offset = 0u;
@@ -210,6 +230,10 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
       _inserted_rows.emplace_back(RowID{target_chunk_id, i});
     }
 
+    // The rows are added to the TableIndexes right away, like they are added to the chunk. Until they are committed,
+    // the MvccData makes them invisible to other transactions. If they are rolled back, they stay invisible.
+    _target_table->index_rows(target_chunk_id, start_index, start_index + current_num_rows_to_insert);
+
     input_offset += current_num_rows_to_insert;
     start_index = 0u;
   }
@@ -225,6 +249,11 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_data->begin_cids[row_id.chunk_offset] = cid;
     mvcc_data->tids[row_id.chunk_offset] = 0u;
   }
+
+  _target_table->record_modification(cid);
+
+  _encode_completed_chunks();
+  _schedule_table_statistics_update();
 }
 
 void Insert::_on_rollback_records() {
@@ -238,6 +267,44 @@ void Insert::_on_rollback_records() {
 
     chunk->get_scoped_mvcc_data_lock()->tids[row_id.chunk_offset] = 0u;
   }
+
+  _encode_completed_chunks();
+}
+
+void Insert::_encode_completed_chunks() {
+  if (!_target_table->chunk_encoding_spec()) return;
+
+  // The rows in _inserted_rows are ordered by their chunk id, so every chunk touched by this Insert is checked once.
+  // Only chunks that are full (i.e., immutable) and whose rows are all committed or rolled back are safe to encode.
+  // If multiple Inserts complete the same chunk concurrently, try_mark_for_encoding() makes sure that only one of them
+  // schedules its encoding.
+  auto previous_chunk_id = INVALID_CHUNK_ID;
+  for (const auto& row_id : _inserted_rows) {
+    if (row_id.chunk_id == previous_chunk_id) continue;
+    previous_chunk_id = row_id.chunk_id;
+
+    const auto chunk = _target_table->get_chunk(row_id.chunk_id);
+    if (chunk->is_mutable()) continue;
+    if (!ChunkCompressionTask::chunk_is_completed(chunk, _target_table->max_chunk_size())) continue;
+    if (!chunk->try_mark_for_encoding()) continue;
+
+    // Concurrent readers keep working on the unencoded segments, see Chunk::replace_segment()
+    std::make_shared<ChunkCompressionTask>(_target_table_name, row_id.chunk_id)->schedule();
+  }
+}
+
+void Insert::_schedule_table_statistics_update() {
+  // Tables that are not managed by the StorageManager have no statistics that could be updated
+  if (!_target_table->table_statistics_sketch()) return;
+
+  // Updating the statistics for every Insert would sketch the mutable chunk over and over again
+  const auto filled_chunk = std::any_of(_inserted_rows.begin(), _inserted_rows.end(), [&](const auto& row_id) {
+    return !_target_table->get_chunk(row_id.chunk_id)->is_mutable();
+  });
+  if (!filled_chunk) return;
+
+  // Sketching the filled chunks takes a while, so it is done in the background instead of delaying the commit
+  std::make_shared<TableStatisticsUpdateTask>(_target_table)->schedule();
 }
 
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
@@ -17,6 +17,10 @@ class TransactionContext;
  * Expects the table name of the table to insert into as a string and
  * the values to insert in a separate table using the same column layout.
  *
+ * Chunks that are filled up by the Insert are marked as immutable. If the target table has a chunk encoding spec,
+ * they are encoded in the background (see ChunkCompressionTask) once the last of their rows is committed or
+ * rolled back.
+ *
  * Assumption: The input has been validated before.
  * Note: Insert does not support null values at the moment
  */
@@ -37,6 +41,12 @@ class Insert : public AbstractReadWriteOperator {
   void _on_rollback_records() override;
 
  private:
+  // Schedules the encoding of all chunks this Insert wrote to that are now full and completed
+  void _encode_completed_chunks();
+
+  // Schedules a TableStatisticsUpdateTask for the target table if this Insert filled a chunk
+  void _schedule_table_statistics_update();
+
   const std::string _target_table_name;
   std::shared_ptr<Table> _target_table;
 
@@ -0,0 +1,157 @@
+#include "join_adaptive.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "cost_model/cost_model_calibrated.hpp"
+#include "join_hash.hpp"
+#include "join_index.hpp"
+#include "join_mpsm.hpp"
+#include "join_nested_loop.hpp"
+#include "join_sort_merge.hpp"
+#include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+JoinAdaptive::JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+                           const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+                           const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+                           const std::optional<float>& selectivity,
+                           const std::shared_ptr<const CostModelCalibrated>& cost_model)
+    : AbstractJoinOperator(OperatorType::JoinAdaptive, left, right, mode, column_ids, predicate_condition,
+                           std::make_unique<JoinAdaptive::PerformanceData>()),
+      _selectivity(selectivity),
+      _cost_model(cost_model ? cost_model : std::make_shared<CostModelCalibrated>()) {}
+
+const std::string JoinAdaptive::name() const { return "JoinAdaptive"; }
+
+OperatorType JoinAdaptive::select_join_implementation() const {
+  const auto& left_input_table = *input_table_left();
+  const auto& right_input_table = *input_table_right();
+
+  auto join_implementations = CostModelCalibrated::applicable_join_implementations(
+      _mode, _predicate_condition, left_input_table.column_data_type(_column_ids.first),
+      right_input_table.column_data_type(_column_ids.second),
+      left_input_table.column_is_nullable(_column_ids.first) ||
+          right_input_table.column_is_nullable(_column_ids.second));
+
+  const auto is_semi_or_anti_join = _mode == JoinMode::Semi || _mode == JoinMode::Anti;
+  const auto index_supports_predicate_condition = _predicate_condition == PredicateCondition::Equals ||
+                                                  _predicate_condition == PredicateCondition::NotEquals ||
+                                                  _predicate_condition == PredicateCondition::LessThan ||
+                                                  _predicate_condition == PredicateCondition::LessThanEquals ||
+                                                  _predicate_condition == PredicateCondition::GreaterThan ||
+                                                  _predicate_condition == PredicateCondition::GreaterThanEquals;
+  if (!is_semi_or_anti_join && index_supports_predicate_condition && _right_input_is_indexed()) {
+    join_implementations.emplace_back(OperatorType::JoinIndex);
+  }
+  Assert(!join_implementations.empty(), "No join implementation supports " + description(DescriptionMode::SingleLine));
+
+  const auto left_row_count = static_cast<float>(left_input_table.row_count());
+  const auto right_row_count = static_cast<float>(right_input_table.row_count());
+
+  auto selectivity = TableStatistics::DEFAULT_OPEN_ENDED_SELECTIVITY;
+  if (_selectivity) {
+    selectivity = *_selectivity;
+  } else if (_predicate_condition == PredicateCondition::Equals) {
+    selectivity = 1.0f / std::max({left_row_count, right_row_count, 1.0f});
+  }
+  const auto output_row_count = left_row_count * right_row_count * selectivity;
+
+  auto cheapest_join_implementation = join_implementations.front();
+  auto cheapest_cost = std::numeric_limits<Cost>::max();
+
+  for (const auto join_implementation : join_implementations) {
+    const auto cost =
+        _cost_model->estimate_join_cost(join_implementation, left_row_count, right_row_count, output_row_count);
+    if (cost < cheapest_cost) {
+      cheapest_cost = cost;
+      cheapest_join_implementation = join_implementation;
+    }
+  }
+
+  return cheapest_join_implementation;
+}
+
+std::shared_ptr<const Table> JoinAdaptive::_on_execute() {
+  const auto join_implementation = select_join_implementation();
+
+  auto join = std::shared_ptr<AbstractOperator>{};
+  switch (join_implementation) {
+    case OperatorType::JoinHash:
+      join = std::make_shared<JoinHash>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+      break;
+    case OperatorType::JoinIndex:
+      join = std::make_shared<JoinIndex>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+      break;
+    case OperatorType::JoinMPSM:
+      join = std::make_shared<JoinMPSM>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+      break;
+    case OperatorType::JoinNestedLoop:
+      join = std::make_shared<JoinNestedLoop>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+      break;
+    case OperatorType::JoinSortMerge:
+      join = std::make_shared<JoinSortMerge>(_input_left, _input_right, _mode, _column_ids, _predicate_condition);
+      break;
+    default:
+      Fail("Unexpected join implementation");
+  }
+
+  join->execute();
+
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+  performance_data.join_implementation = join_implementation;
+  performance_data.join_implementation_performance = join->name() + ": " + join->performance_data().to_string();
+
+  return join->get_output();
+}
+
+std::shared_ptr<AbstractOperator> JoinAdaptive::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<JoinAdaptive>(copied_input_left, copied_input_right, _mode, _column_ids,
+                                        _predicate_condition, _selectivity, _cost_model);
+}
+
+void JoinAdaptive::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
+
+bool JoinAdaptive::_right_input_is_indexed() const {
+  // A TableIndex covers all chunks, also those of a validated stored table (see JoinIndex)
+  const auto indexed_table = JoinIndex::right_table_with_table_index(*_input_right, _column_ids.second, _mode);
+  if (indexed_table) {
+    const auto table_index = indexed_table->get_table_index(_column_ids.second);
+    if (table_index->data_type() == input_table_left()->column_data_type(_column_ids.first) &&
+        table_index->is_applicable(flip_predicate_condition(_predicate_condition), NullValue{})) {
+      return true;
+    }
+  }
+
+  // JoinIndex falls back to a nested loop join for chunks without an index and cannot use indexes on
+  // ReferenceSegments
+  const auto& right_input_table = *input_table_right();
+  if (right_input_table.type() != TableType::Data) return false;
+
+  if (right_input_table.chunk_count() == 0) return false;
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < right_input_table.chunk_count(); ++chunk_id) {
+    const auto indexes = right_input_table.get_chunk(chunk_id)->get_indices(std::vector<ColumnID>{_column_ids.second});
+    if (indexes.empty()) return false;
+  }
+
+  return true;
+}
+
+std::string JoinAdaptive::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += "executed as " + join_implementation_performance;
+  return string;
+}
+
+}  // namespace opossum
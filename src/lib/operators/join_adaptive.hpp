@@ -0,0 +1,64 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class CostModelCalibrated;
+
+/**
+ * Join that decides on its implementation (JoinHash, JoinSortMerge, JoinIndex, ...) only once both inputs are
+ * executed. The LQPTranslator's choice is based on estimated input sizes, which can be far off for complex subplans.
+ * JoinAdaptive costs the applicable implementations with the CostModelCalibrated, using the actual input row counts
+ * and the output row count derived from @param selectivity (the selectivity the optimizer estimated for the join,
+ * i.e., output rows / (left rows * right rows)). Without a selectivity, equi joins are assumed to be foreign key
+ * joins and all other joins to have TableStatistics::DEFAULT_OPEN_ENDED_SELECTIVITY.
+ *
+ * JoinIndex is only considered if the right input is a data table with a TableIndex or an index on the join column in
+ * every chunk, or a Validate of a stored table with a TableIndex (see JoinIndex::right_table_with_table_index()).
+ * Build side and radix partitioning of the JoinHash are chosen by the JoinHash itself, based on the actual input
+ * sizes as well.
+ *
+ * The selected implementation is executed on the inputs of the JoinAdaptive and its decisions are recorded in the
+ * PerformanceData.
+ */
+class JoinAdaptive : public AbstractJoinOperator {
+ public:
+  JoinAdaptive(const std::shared_ptr<const AbstractOperator>& left,
+               const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
+               const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
+               const std::optional<float>& selectivity = std::nullopt,
+               const std::shared_ptr<const CostModelCalibrated>& cost_model = nullptr);
+
+  const std::string name() const override;
+
+  struct PerformanceData : public OperatorPerformanceData {
+    // Type of the executed join implementation and the output of its PerformanceData::to_string()
+    OperatorType join_implementation{OperatorType::JoinHash};
+    std::string join_implementation_performance;
+
+    std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const override;
+  };
+
+  // @return the cheapest join implementation for the (executed) inputs
+  OperatorType select_join_implementation() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  bool _right_input_is_indexed() const;
+
+  const std::optional<float> _selectivity;
+  const std::shared_ptr<const CostModelCalibrated> _cost_model;
+};
+
+}  // namespace opossum
@@ -26,7 +26,8 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator>& left,
                    const std::shared_ptr<const AbstractOperator>& right, const JoinMode mode,
                    const ColumnIDPair& column_ids, const PredicateCondition predicate_condition,
                    const std::optional<size_t>& radix_bits)
-    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition),
+    : AbstractJoinOperator(OperatorType::JoinHash, left, right, mode, column_ids, predicate_condition,
+                           std::make_unique<JoinHash::PerformanceData>()),
       _radix_bits(radix_bits) {
   DebugAssert(predicate_condition == PredicateCondition::Equals, "Operator not supported by Hash Join.");
 }
@@ -172,6 +173,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
 
     _output_table = _join_hash._initialize_output_table();
 
+    auto& performance_data = static_cast<PerformanceData&>(*_join_hash._performance_data);
+    performance_data.radix_bits = _radix_bits;
+    performance_data.inputs_swapped = _inputs_swapped;
+
     /*
      * This flag is used in the materialization and probing phases.
      * When dealing with an OUTER join, we need to make sure that we keep the NULL values for the outer relation.
@@ -362,4 +367,11 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
   }
 };
 
+std::string JoinHash::PerformanceData::to_string(DescriptionMode description_mode) const {
+  std::string string = OperatorPerformanceData::to_string(description_mode);
+  string += (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  string += std::to_string(radix_bits) + " radix bits, " + (inputs_swapped ? "left" : "right") + " input probed";
+  return string;
+}
+
 }  // namespace opossum
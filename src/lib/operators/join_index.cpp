@@ -1,5 +1,6 @@
 #include "join_index.hpp"
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <numeric>
@@ -9,18 +10,22 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "concurrency/transaction_context.hpp"
 #include "join_nested_loop.hpp"
 #include "resolve_type.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "validate.hpp"
 
 namespace opossum {
 
 /*
- * This is an index join implementation. It expects to find an index on the right column.
+ * This is an index join implementation. It expects to find an index on the right column, either a TableIndex or
+ * indexes of the right input's chunks.
  * It can be used for all join modes except JoinMode::Cross.
  * For the remaining join types or if no index is found it falls back to a nested loop join.
  */
@@ -43,6 +48,22 @@ std::shared_ptr<AbstractOperator> JoinIndex::_on_deep_copy(
 
 void JoinIndex::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
+std::shared_ptr<const Table> JoinIndex::right_table_with_table_index(const AbstractOperator& right_input,
+                                                                     const ColumnID right_column_id,
+                                                                     const JoinMode mode) {
+  const auto right_input_table = right_input.get_output();
+  if (right_input_table->get_table_index(right_column_id)) return right_input_table;
+
+  if (right_input.type() != OperatorType::Validate || mode == JoinMode::Right || mode == JoinMode::Outer) {
+    return nullptr;
+  }
+
+  // GetTables that prune chunks output a copy of the stored table without its TableIndex
+  const auto validated_table = right_input.input_table_left();
+  if (validated_table->type() != TableType::Data || !validated_table->get_table_index(right_column_id)) return nullptr;
+  return validated_table;
+}
+
 std::shared_ptr<const Table> JoinIndex::_on_execute() {
   _output_table = _initialize_output_table();
 
@@ -75,46 +96,80 @@ void JoinIndex::_perform_join() {
 
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  // Scan all chunks for right input
-  for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
-    const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
-    const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
-    if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
-
-    std::shared_ptr<BaseIndex> index = nullptr;
+  // The table that the right RowIDs refer to. If the right input is a Validate, this is the validated table when its
+  // TableIndex is used.
+  auto right_table = input_table_right();
+
+  // A TableIndex on the right column serves all chunks of the right input with a single lookup per left row
+  const auto indexed_table = right_table_with_table_index(*_input_right, _column_ids.second, _mode);
+  const auto table_index = indexed_table ? indexed_table->get_table_index(_column_ids.second) : nullptr;
+  if (table_index && input_table_left()->column_data_type(_column_ids.first) == table_index->data_type() &&
+      table_index->is_applicable(flip_predicate_condition(_predicate_condition), NullValue{})) {
+    right_table = indexed_table;
+
+    auto transaction_context = std::shared_ptr<const TransactionContext>{};
+    if (indexed_table != input_table_right()) {
+      transaction_context = _input_right->transaction_context();
+      Assert(transaction_context, "Validate requires a TransactionContext");
+    }
 
-    if (!indices.empty()) {
-      // We assume the first index to be efficient for our join
-      // as we do not want to spend time on evaluating the best index inside of this join loop
-      index = indices.front();
+    if (track_right_matches) {
+      for (ChunkID chunk_id_right{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+        _right_matches[chunk_id_right].resize(right_table->get_chunk(chunk_id_right)->size());
+      }
     }
 
-    // Scan all chunks from left input
-    if (index != nullptr) {
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+    for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+      const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
 
-        segment_with_iterators(*segment_left, [&](auto it, const auto end) {
-          _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
-        });
+      segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+        _join_segment_using_table_index(it, end, chunk_id_left, *indexed_table, *table_index, transaction_context);
+      });
+    }
+    performance_data.chunks_scanned_with_index = right_table->chunk_count();
+  } else {
+    // Scan all chunks for right input
+    for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      const auto chunk_right = input_table_right()->get_chunk(chunk_id_right);
+      const auto indices = chunk_right->get_indices(std::vector<ColumnID>{_column_ids.second});
+      if (track_right_matches) _right_matches[chunk_id_right].resize(chunk_right->size());
+
+      std::shared_ptr<BaseIndex> index = nullptr;
+
+      if (!indices.empty()) {
+        // We assume the first index to be efficient for our join
+        // as we do not want to spend time on evaluating the best index inside of this join loop
+        index = indices.front();
       }
-      performance_data.chunks_scanned_with_index++;
-    } else {
-      // Fall back to NestedLoopJoin
-      const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
-      for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
-        const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
-        JoinNestedLoop::JoinParams params{*_pos_list_left,
-                                          *_pos_list_right,
-                                          _left_matches[chunk_id_left],
-                                          _right_matches[chunk_id_right],
-                                          track_left_matches,
-                                          track_right_matches,
-                                          _mode,
-                                          _predicate_condition};
-        JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right, params);
+
+      // Scan all chunks from left input
+      if (index != nullptr) {
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+
+          segment_with_iterators(*segment_left, [&](auto it, const auto end) {
+            _join_two_segments_using_index(it, end, chunk_id_left, chunk_id_right, index);
+          });
+        }
+        performance_data.chunks_scanned_with_index++;
+      } else {
+        // Fall back to NestedLoopJoin
+        const auto segment_right = input_table_right()->get_chunk(chunk_id_right)->get_segment(_column_ids.second);
+        for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
+          const auto segment_left = input_table_left()->get_chunk(chunk_id_left)->get_segment(_column_ids.first);
+          JoinNestedLoop::JoinParams params{*_pos_list_left,
+                                            *_pos_list_right,
+                                            _left_matches[chunk_id_left],
+                                            _right_matches[chunk_id_right],
+                                            track_left_matches,
+                                            track_right_matches,
+                                            _mode,
+                                            _predicate_condition};
+          JoinNestedLoop::_join_two_untyped_segments(segment_left, segment_right, chunk_id_left, chunk_id_right,
+                                                     params);
+        }
+        performance_data.chunks_scanned_without_index++;
       }
-      performance_data.chunks_scanned_without_index++;
     }
   }
 
@@ -149,7 +204,7 @@ void JoinIndex::_perform_join() {
   Segments output_segments;
 
   _write_output_segments(output_segments, input_table_left(), _pos_list_left);
-  _write_output_segments(output_segments, input_table_right(), _pos_list_right);
+  _write_output_segments(output_segments, right_table, _pos_list_right);
 
   _output_table->append_chunk(output_segments);
 
@@ -218,6 +273,57 @@ void JoinIndex::_join_two_segments_using_index(LeftIterator left_it, LeftIterato
   }
 }
 
+// join loop that joins a segment of the left column with all chunks of the right column using a TableIndex
+template <typename LeftIterator>
+void JoinIndex::_join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end,
+                                                const ChunkID chunk_id_left, const Table& indexed_table,
+                                                const TableIndex& table_index,
+                                                const std::shared_ptr<const TransactionContext>& transaction_context) {
+  // The join predicate reads `left <condition> right`, the TableIndex is probed for `right <flipped condition> left`
+  const auto flipped_predicate_condition = flip_predicate_condition(_predicate_condition);
+
+  auto right_matches = PosList{};
+  for (; left_it != left_end; ++left_it) {
+    const auto left_value = *left_it;
+    if (left_value.is_null()) continue;
+
+    right_matches.clear();
+    table_index.append_matches(flipped_predicate_condition, AllTypeVariant{left_value.value()}, right_matches);
+
+    // Same as the Validate that is the right input
+    if (transaction_context) {
+      const auto our_tid = transaction_context->transaction_id();
+      const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+      const auto is_invisible = [&](const auto& row_id) {
+        const auto mvcc_data = indexed_table.get_chunk(row_id.chunk_id)->get_scoped_mvcc_data_lock();
+        return !Validate::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data);
+      };
+      right_matches.erase(std::remove_if(right_matches.begin(), right_matches.end(), is_invisible),
+                          right_matches.end());
+    }
+    if (right_matches.empty()) continue;
+
+    if (_mode == JoinMode::Left || _mode == JoinMode::Outer) {
+      _left_matches[chunk_id_left][left_value.chunk_offset()] = true;
+    }
+
+    std::fill_n(std::back_inserter(*_pos_list_left), right_matches.size(),
+                RowID{chunk_id_left, left_value.chunk_offset()});
+    _pos_list_right->insert(_pos_list_right->end(), right_matches.cbegin(), right_matches.cend());
+
+    if (_mode == JoinMode::Outer || _mode == JoinMode::Right) {
+      for (const auto& row_id : right_matches) {
+        // Rows inserted concurrently may lie beyond the chunks that were present when the join started
+        if (static_cast<size_t>(row_id.chunk_id) >= _right_matches.size() ||
+            row_id.chunk_offset >= _right_matches[row_id.chunk_id].size()) {
+          continue;
+        }
+        _right_matches[row_id.chunk_id][row_id.chunk_offset] = true;
+      }
+    }
+  }
+}
+
 // join loop that joins two segments of two columns via their iterators
 template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
 void JoinIndex::_join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
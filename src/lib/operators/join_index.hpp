@@ -12,12 +12,19 @@
 #include "types.hpp"
 
 namespace opossum {
+
+class TableIndex;
+class TransactionContext;
+
 /**
    * This operator joins two tables using one column of each table.
    * A speedup compared to the Nested Loop Join is achieved by avoiding the inner loop, and instead
    * finding the right values utilizing the index.
    *
-   * Note: An index needs to be present on the right table in order to execute an index join.
+   * Note: An index needs to be present on the right table in order to execute an index join. If the right table has a
+   * TableIndex on the join column, it is used for all chunks of the right table. If the right input is a Validate of a
+   * stored table with a TableIndex, the TableIndex is probed and the visibility of the matching rows is checked by
+   * the JoinIndex (see right_table_with_table_index()).
    * Note: Cross joins are not supported. Use the product operator instead.
    */
 class JoinIndex : public AbstractJoinOperator {
@@ -28,6 +35,16 @@ class JoinIndex : public AbstractJoinOperator {
 
   const std::string name() const override;
 
+  /**
+   * @return the table whose TableIndex on @param right_column_id is used for @param right_input (which is executed),
+   *         or nullptr. This is either the output of @param right_input or, if @param right_input is a Validate of an
+   *         unpruned GetTable, the stored table. Right and outer joins do not use the latter, as they would also have
+   *         to validate the right rows without a match.
+   */
+  static std::shared_ptr<const Table> right_table_with_table_index(const AbstractOperator& right_input,
+                                                                   const ColumnID right_column_id,
+                                                                   const JoinMode mode);
+
   struct PerformanceData : public OperatorPerformanceData {
     size_t chunks_scanned_with_index{0};
     size_t chunks_scanned_without_index{0};
@@ -49,6 +66,12 @@ class JoinIndex : public AbstractJoinOperator {
   void _join_two_segments_using_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
                                       const ChunkID chunk_id_right, const std::shared_ptr<BaseIndex>& index);
 
+  // @param transaction_context is set if the matches in @param indexed_table have to be validated
+  template <typename LeftIterator>
+  void _join_segment_using_table_index(LeftIterator left_it, LeftIterator left_end, const ChunkID chunk_id_left,
+                                       const Table& indexed_table, const TableIndex& table_index,
+                                       const std::shared_ptr<const TransactionContext>& transaction_context);
+
   template <typename BinaryFunctor, typename LeftIterator, typename RightIterator>
   void _join_two_segments_nested_loop(const BinaryFunctor& func, LeftIterator left_it, LeftIterator left_end,
                                       RightIterator right_begin, RightIterator right_end, const ChunkID chunk_id_left,
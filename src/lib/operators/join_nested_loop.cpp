@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "storage/create_iterable_from_segment.hpp"
 #include "storage/segment_iterables/any_segment_iterable.hpp"
 #include "storage/segment_iterate.hpp"
@@ -169,6 +170,8 @@ void JoinNestedLoop::_perform_join() {
 
     // Scan all chunks for right input
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < right_table->chunk_count(); ++chunk_id_right) {
+      CancellationToken::check_current();
+
       const auto segment_right = right_table->get_chunk(chunk_id_right)->get_segment(right_column_id);
       _right_matches[chunk_id_right].resize(segment_right->size());
 
@@ -24,7 +24,7 @@ std::shared_ptr<AbstractExpression> Limit::row_count_expression() const { return
 std::shared_ptr<AbstractOperator> Limit::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Limit>(copied_input_left, _row_count_expression->deep_copy());
+  return std::make_shared<Limit>(copied_input_left, expression_copy_for_pqp(_row_count_expression));
 }
 
 std::shared_ptr<const Table> Limit::_on_execute() {
@@ -14,6 +14,9 @@ struct OperatorPerformanceData : public Noncopyable {
 
   std::chrono::nanoseconds walltime{0};
 
+  // Number of rows in the output table, kept after the output itself has been cleared
+  uint64_t output_row_count{0};
+
   virtual std::string to_string(DescriptionMode description_mode = DescriptionMode::SingleLine) const;
 };
 
@@ -6,6 +6,7 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/cancellation_token.hpp"
 #include "storage/reference_segment.hpp"
 
 namespace opossum {
@@ -32,6 +33,7 @@ std::shared_ptr<const Table> Product::_on_execute() {
 
   for (ChunkID chunk_id_left = ChunkID{0}; chunk_id_left < input_table_left()->chunk_count(); ++chunk_id_left) {
     for (ChunkID chunk_id_right = ChunkID{0}; chunk_id_right < input_table_right()->chunk_count(); ++chunk_id_right) {
+      CancellationToken::check_current();
       _add_product_of_two_chunks(output, chunk_id_left, chunk_id_right);
     }
   }
@@ -7,6 +7,7 @@
 #include <utility>
 #include <vector>
 
+#include "scheduler/cancellation_token.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
@@ -212,6 +213,8 @@ class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
     auto& null_value_rows = *_null_value_rows;
 
     for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
+      CancellationToken::check_current();
+
       auto chunk = _table_in->get_chunk(chunk_id);
 
       auto base_segment = chunk->get_segment(_column_id);
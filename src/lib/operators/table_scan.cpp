@@ -73,7 +73,7 @@ void TableScan::_on_set_parameters(const std::unordered_map<ParameterID, AllType
 std::shared_ptr<AbstractOperator> TableScan::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<TableScan>(copied_input_left, _predicate->deep_copy());
+  return std::make_shared<TableScan>(copied_input_left, expression_copy_for_pqp(_predicate));
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
@@ -6,23 +6,12 @@
 #include <vector>
 
 #include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-namespace {
-
-bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
-                    const MvccData& mvcc_data) {
-  const auto row_tid = mvcc_data.tids[chunk_offset].load();
-  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
-  const auto end_cid = mvcc_data.end_cids[chunk_offset];
-  return Validate::is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
-}
-
-}  // namespace
-
 bool Validate::is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                               const CommitID begin_cid, const CommitID end_cid) {
   // Taken from: https://github.com/hyrise/hyrise-v1/blob/master/docs/documentation/queryexecution/tx.rst
@@ -34,6 +23,20 @@ bool Validate::is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, con
   return snapshot_commit_id < end_cid && ((snapshot_commit_id >= begin_cid) != (row_tid == our_tid));
 }
 
+bool Validate::is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
+                              const MvccData& mvcc_data) {
+  // Read-only transactions never insert or lock rows, so the row's TID cannot be ours and we do not need to load it.
+  if (our_tid == TransactionManager::READ_ONLY_TRANSACTION_ID) {
+    return snapshot_commit_id >= mvcc_data.begin_cids[chunk_offset] &&
+           snapshot_commit_id < mvcc_data.end_cids[chunk_offset];
+  }
+
+  const auto row_tid = mvcc_data.tids[chunk_offset].load();
+  const auto begin_cid = mvcc_data.begin_cids[chunk_offset];
+  const auto end_cid = mvcc_data.end_cids[chunk_offset];
+  return is_row_visible(our_tid, snapshot_commit_id, row_tid, begin_cid, end_cid);
+}
+
 Validate::Validate(const std::shared_ptr<AbstractOperator>& in)
     : AbstractReadOnlyOperator(OperatorType::Validate, in) {}
 
@@ -88,7 +91,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
         auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
         for (auto row_id : pos_list_in) {
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
             pos_list_out->emplace_back(row_id);
           }
         }
@@ -101,7 +104,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
 
           auto mvcc_data = referenced_chunk->get_scoped_mvcc_data_lock();
 
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+          if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
             pos_list_out->emplace_back(row_id);
           }
         }
@@ -126,7 +129,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       // Generate pos_list_out.
       auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
       for (auto i = 0u; i < chunk_size; i++) {
-        if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
+        if (is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
           pos_list_out->emplace_back(RowID{chunk_id, i});
         }
       }
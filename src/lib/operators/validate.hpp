@@ -10,6 +10,8 @@
 
 namespace opossum {
 
+struct MvccData;
+
 /**
  * Validates visibility of records of a table
  * within the context of a given transaction
@@ -26,6 +28,11 @@ class Validate : public AbstractReadOnlyOperator {
   static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, const TransactionID row_tid,
                              const CommitID begin_cid, const CommitID end_cid);
 
+  // Same as above for the row at @param chunk_offset of a chunk with @param mvcc_data. Also used by JoinIndex, which
+  // validates the rows it finds in the TableIndex of a stored table.
+  static bool is_row_visible(CommitID our_tid, CommitID snapshot_commit_id, ChunkOffset chunk_offset,
+                             const MvccData& mvcc_data);
+
  protected:
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> transaction_context) override;
   std::shared_ptr<const Table> _on_execute() override;
@@ -13,6 +13,58 @@ AbstractJoinOrderingAlgorithm::AbstractJoinOrderingAlgorithm(
     const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
     : _cost_estimator(cost_estimator) {}
 
+std::vector<std::shared_ptr<AbstractLQPNode>> AbstractJoinOrderingAlgorithm::_build_vertex_plans(
+    const JoinGraph& join_graph) const {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  auto vertex_plans = join_graph.vertices;
+
+  /**
+   * 1. Place Uncorrelated Predicates (think "6 > 4": not referencing any vertex)
+   * 1.1 Collect uncorrelated predicates
+   */
+  std::vector<std::shared_ptr<AbstractExpression>> uncorrelated_predicates;
+  for (const auto& edge : join_graph.edges) {
+    if (!edge.vertex_set.none()) continue;
+    uncorrelated_predicates.insert(uncorrelated_predicates.end(), edge.predicates.begin(), edge.predicates.end());
+  }
+
+  /**
+   * 1.2 Find the largest vertex and place the uncorrelated predicates for optimal execution.
+   *     Reasoning: Uncorrelated predicates are either False or True for *all* rows. If an uncorrelated
+   *                predicate is False and we place it on top of the largest vertex we avoid processing the vertex'
+   *                many rows in later joins.
+   */
+  if (!uncorrelated_predicates.empty()) {
+    // Find the largest vertex
+    auto largest_vertex_idx = size_t{0};
+    auto largest_vertex_cardinality = join_graph.vertices.front()->get_statistics()->row_count();
+
+    for (size_t vertex_idx = 1; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
+      const auto vertex_cardinality = join_graph.vertices[vertex_idx]->get_statistics()->row_count();
+      if (vertex_cardinality > largest_vertex_cardinality) {
+        largest_vertex_idx = vertex_idx;
+        largest_vertex_cardinality = vertex_cardinality;
+      }
+    }
+
+    // Place the uncorrelated predicates on top of the largest vertex
+    for (const auto& uncorrelated_predicate : uncorrelated_predicates) {
+      vertex_plans[largest_vertex_idx] = PredicateNode::make(uncorrelated_predicate, vertex_plans[largest_vertex_idx]);
+    }
+  }
+
+  /**
+   * 2. Add local predicates on top of the vertices
+   */
+  for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
+    const auto vertex_predicates = join_graph.find_local_predicates(vertex_idx);
+    vertex_plans[vertex_idx] = _add_predicates_to_plan(vertex_plans[vertex_idx], vertex_predicates);
+  }
+
+  return vertex_plans;
+}
+
 std::shared_ptr<AbstractLQPNode> AbstractJoinOrderingAlgorithm::_add_predicates_to_plan(
     const std::shared_ptr<AbstractLQPNode>& lqp,
     const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const {
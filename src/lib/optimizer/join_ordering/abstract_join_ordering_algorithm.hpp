@@ -16,6 +16,13 @@ class AbstractJoinOrderingAlgorithm {
   virtual ~AbstractJoinOrderingAlgorithm() = default;
 
  protected:
+  /**
+   * @return one plan per vertex of @param join_graph, consisting of the vertex with its local predicates on top. The
+   *         uncorrelated predicates of the JoinGraph (think "6 > 4": not referencing any vertex) are placed on top of
+   *         the largest vertex.
+   */
+  std::vector<std::shared_ptr<AbstractLQPNode>> _build_vertex_plans(const JoinGraph& join_graph) const;
+
   std::shared_ptr<AbstractLQPNode> _add_predicates_to_plan(
       const std::shared_ptr<AbstractLQPNode>& lqp,
       const std::vector<std::shared_ptr<AbstractExpression>>& predicates) const;
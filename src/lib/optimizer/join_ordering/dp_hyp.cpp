@@ -0,0 +1,247 @@
+#include "dp_hyp.hpp"
+
+#include <vector>
+
+#include "cost_model/abstract_cost_estimator.hpp"
+#include "join_graph.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+/**
+ * Calls @param visitor for the non-empty subsets of @param vertex_set, in subsets-first order (see
+ * EnumerateCcp::_non_empty_subsets()), until it returns false. The subsets are generated one at a time, since there are
+ * 2^|vertex_set| of them. Returns false if the visitor aborted the enumeration.
+ */
+template <typename Visitor>
+bool for_each_non_empty_subset(const JoinGraphVertexSet& vertex_set, const Visitor& visitor) {
+  if (vertex_set.none()) return true;
+
+  const auto s = vertex_set.to_ulong();
+  auto s1 = s & -s;
+
+  while (s1 != s) {
+    if (!visitor(JoinGraphVertexSet{vertex_set.size(), s1})) return false;
+    s1 = s & (s1 - s);
+  }
+  return visitor(vertex_set);
+}
+
+}  // namespace
+
+namespace opossum {
+
+DpHyp::DpHyp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator, const size_t max_csg_cmp_pair_count)
+    : AbstractJoinOrderingAlgorithm(cost_estimator), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
+
+std::shared_ptr<AbstractLQPNode> DpHyp::operator()(const JoinGraph& join_graph) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  // Subset enumeration operates on the integer representation of the vertex sets
+  if (join_graph.vertices.size() > static_cast<size_t>(std::numeric_limits<unsigned long>::digits)) {  // NOLINT
+    return nullptr;
+  }
+
+  _join_graph = &join_graph;
+  _csg_cmp_pair_count = 0;
+  _best_plans.clear();
+
+  /**
+   * 1. Initialize the best plans with the vertices, the uncorrelated predicates and the local predicates on top of
+   *    them
+   */
+  const auto vertex_plans = _build_vertex_plans(join_graph);
+  for (size_t vertex_idx = 0; vertex_idx < join_graph.vertices.size(); ++vertex_idx) {
+    const auto& vertex_plan = vertex_plans[vertex_idx];
+    _best_plans.emplace(_single_vertex_set(vertex_idx),
+                        PlanCostPair{vertex_plan, _cost_estimator->estimate_plan_cost(vertex_plan)});
+  }
+
+  /**
+   * 2. Enumerate the csg-cmp-pairs and build the best plans for them bottom-up, unless the budget is exhausted
+   */
+  const auto within_budget = _solve();
+
+  auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
+  if (within_budget) {
+    auto all_vertices_set = JoinGraphVertexSet{join_graph.vertices.size()};
+    all_vertices_set.flip();  // Turns all bits to '1'
+
+    const auto best_plan_iter = _best_plans.find(all_vertices_set);
+    Assert(best_plan_iter != _best_plans.end(), "No plan for all vertices generated. Maybe JoinGraph isn't connected?");
+    result_lqp = best_plan_iter->second.lqp;
+  }
+
+  _join_graph = nullptr;
+  _best_plans.clear();
+
+  return result_lqp;
+}
+
+bool DpHyp::_solve() {
+  /**
+   * Start the enumeration from each vertex, in descending order. Vertices with a lower index are excluded from the
+   * enumeration started from a vertex, so that each csg-cmp-pair is enumerated exactly once.
+   */
+  for (auto vertex_idx = _join_graph->vertices.size(); vertex_idx-- > 0;) {
+    const auto vertex_set = _single_vertex_set(vertex_idx);
+    if (!_emit_csg(vertex_set)) return false;
+    if (!_enumerate_csg_recursive(vertex_set, _exclusion_set(vertex_idx))) return false;
+  }
+
+  return true;
+}
+
+bool DpHyp::_enumerate_csg_recursive(const JoinGraphVertexSet& vertex_set, const JoinGraphVertexSet& exclusion_set) {
+  /**
+   * Extend `vertex_set` with subsets of its neighborhood. Each extension for which a plan exists is a connected
+   * subgraph, for which complements are searched. The extensions without a plan might be connected via a hyperedge
+   * later on, so the recursion continues from all of them.
+   */
+  const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+
+  const auto emitted = for_each_non_empty_subset(neighborhood, [&](const auto& subset) {
+    if (_budget_exhausted()) return false;
+
+    const auto extended_vertex_set = vertex_set | subset;
+    if (_best_plans.count(extended_vertex_set) == 0) return true;
+    return _emit_csg(extended_vertex_set);
+  });
+  if (!emitted) return false;
+
+  const auto extended_exclusion_set = exclusion_set | neighborhood;
+  return for_each_non_empty_subset(neighborhood, [&](const auto& subset) {
+    return !_budget_exhausted() && _enumerate_csg_recursive(vertex_set | subset, extended_exclusion_set);
+  });
+}
+
+bool DpHyp::_emit_csg(const JoinGraphVertexSet& vertex_set) {
+  /**
+   * Find complements for the connected subgraph `vertex_set`. Only complements with a vertex higher than the lowest
+   * vertex of `vertex_set` are considered, since the other pairs are enumerated starting from the lower vertex.
+   */
+  const auto exclusion_set = vertex_set | _exclusion_set(vertex_set.find_first());
+  const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+
+  for (auto vertex_idx = _join_graph->vertices.size(); vertex_idx-- > 0;) {
+    if (!neighborhood.test(vertex_idx)) continue;
+
+    const auto cmp = _single_vertex_set(vertex_idx);
+    if (_connected(vertex_set, cmp)) {
+      if (!_emit_csg_cmp_pair(vertex_set, cmp)) return false;
+    }
+
+    if (!_enumerate_cmp_recursive(vertex_set, cmp, exclusion_set | (_exclusion_set(vertex_idx) & neighborhood))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool DpHyp::_enumerate_cmp_recursive(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& vertex_set,
+                                     const JoinGraphVertexSet& exclusion_set) {
+  /**
+   * Extend the complement `vertex_set` of `csg` with subsets of its neighborhood. Each extension for which a plan
+   * exists and that is connected to `csg` forms a csg-cmp-pair.
+   */
+  const auto neighborhood = _neighborhood(vertex_set, exclusion_set);
+
+  const auto emitted = for_each_non_empty_subset(neighborhood, [&](const auto& subset) {
+    if (_budget_exhausted()) return false;
+
+    const auto extended_vertex_set = vertex_set | subset;
+    if (_best_plans.count(extended_vertex_set) == 0 || !_connected(csg, extended_vertex_set)) return true;
+    return _emit_csg_cmp_pair(csg, extended_vertex_set);
+  });
+  if (!emitted) return false;
+
+  const auto extended_exclusion_set = exclusion_set | neighborhood;
+  return for_each_non_empty_subset(neighborhood, [&](const auto& subset) {
+    return !_budget_exhausted() && _enumerate_cmp_recursive(csg, vertex_set | subset, extended_exclusion_set);
+  });
+}
+
+bool DpHyp::_emit_csg_cmp_pair(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& cmp) {
+  ++_csg_cmp_pair_count;
+  if (_budget_exhausted()) return false;
+
+  const auto best_plan_csg_iter = _best_plans.find(csg);
+  const auto best_plan_cmp_iter = _best_plans.find(cmp);
+  DebugAssert(best_plan_csg_iter != _best_plans.end() && best_plan_cmp_iter != _best_plans.end(),
+              "Subplan missing: DpHyp enumeration order is broken");
+
+  const auto join_predicates = _join_graph->find_join_predicates(csg, cmp);
+  const auto& csg_lqp = best_plan_csg_iter->second.lqp;
+  const auto& cmp_lqp = best_plan_cmp_iter->second.lqp;
+
+  // Both inputs are tried on either side of the join, since physical join implementations are not symmetric (e.g.,
+  // JoinHash builds its hash table on the smaller input). On ties, the csg remains the left input.
+  const auto joined_vertex_set = csg | cmp;
+  for (const auto& [left_lqp, right_lqp] : {std::make_pair(csg_lqp, cmp_lqp), std::make_pair(cmp_lqp, csg_lqp)}) {
+    const auto candidate_plan = _add_join_to_plan(left_lqp, right_lqp, join_predicates);
+    const auto candidate_cost = _cost_estimator->estimate_plan_cost(candidate_plan);
+
+    const auto best_plan_iter = _best_plans.find(joined_vertex_set);
+    if (best_plan_iter == _best_plans.end()) {
+      _best_plans.emplace(joined_vertex_set, PlanCostPair{candidate_plan, candidate_cost});
+    } else if (candidate_cost < best_plan_iter->second.cost) {
+      best_plan_iter->second = PlanCostPair{candidate_plan, candidate_cost};
+    }
+  }
+
+  return true;
+}
+
+bool DpHyp::_budget_exhausted() const { return _csg_cmp_pair_count > _max_csg_cmp_pair_count; }
+
+JoinGraphVertexSet DpHyp::_neighborhood(const JoinGraphVertexSet& vertex_set,
+                                        const JoinGraphVertexSet& exclusion_set) const {
+  auto neighborhood = JoinGraphVertexSet{_join_graph->vertices.size()};
+
+  for (const auto& edge : _join_graph->edges) {
+    // Local and uncorrelated predicates do not connect anything
+    if (edge.vertex_set.count() < 2) continue;
+    if (!edge.vertex_set.intersects(vertex_set)) continue;
+
+    const auto remaining_vertex_set = edge.vertex_set - vertex_set;
+    if (remaining_vertex_set.none() || remaining_vertex_set.intersects(exclusion_set)) continue;
+
+    neighborhood.set(remaining_vertex_set.find_first());
+  }
+
+  return neighborhood;
+}
+
+bool DpHyp::_connected(const JoinGraphVertexSet& vertex_set_a, const JoinGraphVertexSet& vertex_set_b) const {
+  const auto joined_vertex_set = vertex_set_a | vertex_set_b;
+
+  for (const auto& edge : _join_graph->edges) {
+    if (edge.vertex_set.count() < 2) continue;
+
+    if (edge.vertex_set.is_subset_of(joined_vertex_set) && edge.vertex_set.intersects(vertex_set_a) &&
+        edge.vertex_set.intersects(vertex_set_b)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+JoinGraphVertexSet DpHyp::_exclusion_set(const size_t vertex_idx) const {
+  auto exclusion_set = JoinGraphVertexSet{_join_graph->vertices.size()};
+  for (size_t exclusion_vertex_idx = 0; exclusion_vertex_idx <= vertex_idx; ++exclusion_vertex_idx) {
+    exclusion_set.set(exclusion_vertex_idx);
+  }
+  return exclusion_set;
+}
+
+JoinGraphVertexSet DpHyp::_single_vertex_set(const size_t vertex_idx) const {
+  auto vertex_set = JoinGraphVertexSet{_join_graph->vertices.size()};
+  vertex_set.set(vertex_idx);
+  return vertex_set;
+}
+
+}  // namespace opossum
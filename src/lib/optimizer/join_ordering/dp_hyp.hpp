@@ -0,0 +1,84 @@
+#pragma once
+
+#include <limits>
+#include <map>
+#include <memory>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "cost_model/cost.hpp"
+#include "join_graph_edge.hpp"
+
+namespace opossum {
+
+/**
+ * Optimal join ordering algorithm described in "Dynamic Programming Strikes Back"
+ * https://dl.acm.org/citation.cfm?id=1376672
+ *
+ * Like DpCcp, DpHyp enumerates all pairs of connected subgraphs that are connected by an edge (csg-cmp-pairs) in an
+ * order suitable for dynamic programming. In contrast to DpCcp, the enumeration is driven directly by the edges of the
+ * JoinGraph, so that hyperedges (i.e., predicates referencing more than two vertices, such as `a.x + b.y = c.z`) are
+ * used for connecting subgraphs instead of being ignored. Like DpCcp, outer joins remain opaque vertices.
+ *
+ * To keep optimization time bounded for large JoinGraphs, DpHyp can be given a budget for the number of
+ * csg-cmp-pairs it considers. Once the budget is exhausted, DpHyp gives up and the caller is expected to use a cheaper
+ * algorithm, such as LinearizedDp.
+ *
+ * Local predicates are pushed down and sorted by increasing cost.
+ */
+class DpHyp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  explicit DpHyp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                 const size_t max_csg_cmp_pair_count = std::numeric_limits<size_t>::max());
+
+  /**
+   * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. DpHyp is only applied
+   *                        to this particular JoinGraph and doesn't modify the subplans in the vertices.
+   * @return                An LQP consisting of
+   *                         * the operations from the JoinGraph in an optimal order
+   *                         * the subplans from the vertices below them
+   *                        or nullptr, if more than max_csg_cmp_pair_count csg-cmp-pairs would need to be considered
+   */
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+
+ private:
+  struct PlanCostPair {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    Cost cost;
+  };
+
+  // The functions below correspond to the functions of the same name in the paper. They return false once the budget
+  // is exhausted, so that the enumeration can be aborted.
+  bool _solve();
+  bool _enumerate_csg_recursive(const JoinGraphVertexSet& vertex_set, const JoinGraphVertexSet& exclusion_set);
+  bool _emit_csg(const JoinGraphVertexSet& vertex_set);
+  bool _enumerate_cmp_recursive(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& vertex_set,
+                                const JoinGraphVertexSet& exclusion_set);
+  bool _emit_csg_cmp_pair(const JoinGraphVertexSet& csg, const JoinGraphVertexSet& cmp);
+
+  // Checked before each subset of a neighborhood is visited, as neighborhoods in large JoinGraphs (e.g., the center of
+  // a star) have too many subsets to visit them all
+  bool _budget_exhausted() const;
+
+  // Corresponds to N(S, X) in the paper. For hyperedges, only the lowest vertex not in @param vertex_set is added to
+  // the neighborhood ("representative"), the other vertices of the hyperedge are added by the recursive enumeration.
+  JoinGraphVertexSet _neighborhood(const JoinGraphVertexSet& vertex_set, const JoinGraphVertexSet& exclusion_set) const;
+
+  // @return whether an edge of the JoinGraph connects @param vertex_set_a and @param vertex_set_b
+  bool _connected(const JoinGraphVertexSet& vertex_set_a, const JoinGraphVertexSet& vertex_set_b) const;
+
+  // Corresponds to B_i(V) in the paper, i.e., all vertices with an index lower than or equal to @param vertex_idx
+  JoinGraphVertexSet _exclusion_set(const size_t vertex_idx) const;
+
+  JoinGraphVertexSet _single_vertex_set(const size_t vertex_idx) const;
+
+  const size_t _max_csg_cmp_pair_count;
+
+  // State of the current invocation of operator()
+  const JoinGraph* _join_graph{nullptr};
+  size_t _csg_cmp_pair_count{0};
+
+  // No std::unordered_map, since hashing of JoinGraphVertexSet is not (efficiently) possible
+  std::map<JoinGraphVertexSet, PlanCostPair> _best_plans;
+};
+
+}  // namespace opossum
@@ -0,0 +1,137 @@
+#include "linearized_dp.hpp"
+
+#include <limits>
+#include <optional>
+
+#include "cost_model/abstract_cost_estimator.hpp"
+#include "cost_model/cost.hpp"
+#include "join_graph.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LinearizedDp::LinearizedDp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
+    : AbstractJoinOrderingAlgorithm(cost_estimator) {}
+
+std::shared_ptr<AbstractLQPNode> LinearizedDp::operator()(const JoinGraph& join_graph) {
+  Assert(!join_graph.vertices.empty(), "Code below relies on the JoinGraph having vertices");
+
+  const auto vertex_count = join_graph.vertices.size();
+  const auto vertex_plans = _build_vertex_plans(join_graph);
+  const auto linear_order = _linearize(join_graph, vertex_plans);
+
+  /**
+   * Dynamic programming over the intervals of the linear order: best_plans[begin][end] holds the best plan for joining
+   * the vertices linear_order[begin] to linear_order[end]. It is built from the best plans of all splits of the
+   * interval into two adjacent intervals.
+   */
+  struct IntervalPlan {
+    std::shared_ptr<AbstractLQPNode> lqp;
+    Cost cost{std::numeric_limits<Cost>::max()};
+    JoinGraphVertexSet vertex_set;
+    // Whether `lqp` joins the vertices without cross joins
+    bool connected{false};
+  };
+
+  auto best_plans = std::vector<std::vector<IntervalPlan>>(vertex_count, std::vector<IntervalPlan>(vertex_count));
+
+  for (auto position = size_t{0}; position < vertex_count; ++position) {
+    auto& interval_plan = best_plans[position][position];
+    interval_plan.lqp = vertex_plans[linear_order[position]];
+    interval_plan.cost = _cost_estimator->estimate_plan_cost(interval_plan.lqp);
+    interval_plan.vertex_set = JoinGraphVertexSet{vertex_count};
+    interval_plan.vertex_set.set(linear_order[position]);
+    interval_plan.connected = true;
+  }
+
+  for (auto interval_length = size_t{2}; interval_length <= vertex_count; ++interval_length) {
+    for (auto begin = size_t{0}; begin + interval_length <= vertex_count; ++begin) {
+      const auto end = begin + interval_length - 1;
+      auto& interval_plan = best_plans[begin][end];
+      interval_plan.vertex_set = best_plans[begin][begin].vertex_set | best_plans[begin + 1][end].vertex_set;
+
+      // Splits that would require a cross join are only considered if the interval cannot be split otherwise. Since
+      // the linear order keeps connected vertices together, this avoids cross joins for connected JoinGraphs.
+      for (auto split = begin; split < end; ++split) {
+        const auto& left_plan = best_plans[begin][split];
+        const auto& right_plan = best_plans[split + 1][end];
+        const auto join_predicates = join_graph.find_join_predicates(left_plan.vertex_set, right_plan.vertex_set);
+        const auto connected_split = left_plan.connected && right_plan.connected && !join_predicates.empty();
+
+        if (!connected_split && interval_plan.connected) continue;
+        if (connected_split && !interval_plan.connected) {
+          interval_plan.lqp = nullptr;
+          interval_plan.connected = true;
+        }
+
+        for (const auto& [left_lqp, right_lqp] :
+             {std::make_pair(left_plan.lqp, right_plan.lqp), std::make_pair(right_plan.lqp, left_plan.lqp)}) {
+          const auto candidate_plan = _add_join_to_plan(left_lqp, right_lqp, join_predicates);
+          const auto candidate_cost = _cost_estimator->estimate_plan_cost(candidate_plan);
+          if (!interval_plan.lqp || candidate_cost < interval_plan.cost) {
+            interval_plan.lqp = candidate_plan;
+            interval_plan.cost = candidate_cost;
+          }
+        }
+      }
+    }
+  }
+
+  return best_plans[0][vertex_count - 1].lqp;
+}
+
+std::vector<size_t> LinearizedDp::_linearize(const JoinGraph& join_graph,
+                                             const std::vector<std::shared_ptr<AbstractLQPNode>>& vertex_plans) const {
+  const auto vertex_count = join_graph.vertices.size();
+
+  // Start with the vertex with the lowest cardinality
+  auto first_vertex_idx = size_t{0};
+  for (auto vertex_idx = size_t{1}; vertex_idx < vertex_count; ++vertex_idx) {
+    if (vertex_plans[vertex_idx]->get_statistics()->row_count() <
+        vertex_plans[first_vertex_idx]->get_statistics()->row_count()) {
+      first_vertex_idx = vertex_idx;
+    }
+  }
+
+  auto linear_order = std::vector<size_t>{first_vertex_idx};
+  auto ordered_vertex_set = JoinGraphVertexSet{vertex_count};
+  ordered_vertex_set.set(first_vertex_idx);
+  auto plan = vertex_plans[first_vertex_idx];
+
+  while (linear_order.size() < vertex_count) {
+    auto next_vertex_idx = std::optional<size_t>{};
+    auto next_plan = std::shared_ptr<AbstractLQPNode>{};
+    auto next_plan_cardinality = std::numeric_limits<float>::max();
+    auto next_vertex_connected = false;
+
+    for (auto vertex_idx = size_t{0}; vertex_idx < vertex_count; ++vertex_idx) {
+      if (ordered_vertex_set.test(vertex_idx)) continue;
+
+      auto vertex_set = JoinGraphVertexSet{vertex_count};
+      vertex_set.set(vertex_idx);
+
+      const auto join_predicates = join_graph.find_join_predicates(ordered_vertex_set, vertex_set);
+      const auto connected = !join_predicates.empty();
+      if (next_vertex_connected && !connected) continue;
+
+      const auto candidate_plan = _add_join_to_plan(plan, vertex_plans[vertex_idx], join_predicates);
+      const auto candidate_cardinality = candidate_plan->get_statistics()->row_count();
+
+      if (!next_vertex_idx || (connected && !next_vertex_connected) || candidate_cardinality < next_plan_cardinality) {
+        next_vertex_idx = vertex_idx;
+        next_plan = candidate_plan;
+        next_plan_cardinality = candidate_cardinality;
+        next_vertex_connected = connected;
+      }
+    }
+
+    linear_order.emplace_back(*next_vertex_idx);
+    ordered_vertex_set.set(*next_vertex_idx);
+    plan = next_plan;
+  }
+
+  return linear_order;
+}
+
+}  // namespace opossum
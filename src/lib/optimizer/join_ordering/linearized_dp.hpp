@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "abstract_join_ordering_algorithm.hpp"
+#include "join_graph_edge.hpp"
+
+namespace opossum {
+
+/**
+ * Join ordering algorithm for JoinGraphs too large for DpHyp, derived from "Adaptive Optimization of Very Large Join
+ * Queries" https://dl.acm.org/citation.cfm?id=3183733
+ *
+ * LinearizedDp first brings the vertices into a linear order and then runs a dynamic programming algorithm that
+ * considers only those (bushy) plans in which each subplan joins vertices that are adjacent in the linear order. This
+ * requires O(n^3) join candidates instead of the exponential number DpHyp might enumerate.
+ *
+ * Instead of the IKKBZ-based linearization from the paper, the linear order is built greedily: Starting with the
+ * vertex with the lowest cardinality, the vertex that, when joined, produces the lowest cardinality is appended. Only
+ * vertices connected to the already ordered ones are considered, as long as there are any.
+ *
+ * Local predicates are pushed down and sorted by increasing cost.
+ */
+class LinearizedDp final : public AbstractJoinOrderingAlgorithm {
+ public:
+  explicit LinearizedDp(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+
+  /**
+   * @param join_graph      A JoinGraph for a part of an LQP with further subplans as vertices. LinearizedDp is only
+   *                        applied to this particular JoinGraph and doesn't modify the subplans in the vertices.
+   * @return                An LQP consisting of
+   *                         * the operations from the JoinGraph in the best order within the considered plan space
+   *                         * the subplans from the vertices below them
+   */
+  std::shared_ptr<AbstractLQPNode> operator()(const JoinGraph& join_graph);
+
+ private:
+  // @return the vertex indices of @param join_graph in the order they are considered by the dynamic programming
+  std::vector<size_t> _linearize(const JoinGraph& join_graph,
+                                 const std::vector<std::shared_ptr<AbstractLQPNode>>& vertex_plans) const;
+};
+
+}  // namespace opossum
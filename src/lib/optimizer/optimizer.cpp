@@ -19,6 +19,7 @@
 #include "strategy/join_ordering_rule.hpp"
 #include "strategy/logical_reduction_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/subquery_decorrelation_rule.hpp"
 #include "utils/performance_warning.hpp"
 
 /**
@@ -91,6 +92,9 @@ std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
 
   optimizer->add_rule(std::make_shared<LogicalReductionRule>());
 
+  // Turn correlated subqueries into joins before pruning, so that the ColumnPruningRule sees the joined subplans
+  optimizer->add_rule(std::make_shared<SubqueryDecorrelationRule>());
+
   optimizer->add_rule(std::make_shared<ColumnPruningRule>());
 
   optimizer->add_rule(std::make_shared<ExistsReformulationRule>());
@@ -13,6 +13,7 @@
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/table_index.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
@@ -45,6 +46,10 @@ void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const
           predicate_node->scan_type = ScanType::IndexScan;
         }
       }
+
+      if (_is_table_index_scan_applicable(*table, *stored_table_node, predicate_node)) {
+        predicate_node->scan_type = ScanType::IndexScan;
+      }
     }
   }
 
@@ -69,6 +74,37 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexInfo& index_info,
 
   if (index_info.column_ids[0] != operator_predicate.column_id) return false;
 
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_table_index_scan_applicable(const Table& table, const StoredTableNode& stored_table_node,
+                                                    const std::shared_ptr<PredicateNode>& predicate_node) const {
+  // The RowIDs of a TableIndex refer to the unpruned table
+  if (!stored_table_node.excluded_chunk_ids().empty()) return false;
+
+  const auto operator_predicates =
+      OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
+  if (!operator_predicates) return false;
+  if (operator_predicates->size() != 1) return false;
+
+  const auto& operator_predicate = (*operator_predicates)[0];
+
+  const auto table_index = table.get_table_index(operator_predicate.column_id);
+  if (!table_index) return false;
+
+  // Column references and parameters cannot be looked up
+  if (!is_variant(operator_predicate.value)) return false;
+  if (operator_predicate.value2 && !is_variant(*operator_predicate.value2)) return false;
+
+  const auto& value = boost::get<AllTypeVariant>(operator_predicate.value);
+  const auto value2 =
+      operator_predicate.value2 ? boost::get<AllTypeVariant>(*operator_predicate.value2) : AllTypeVariant{NullValue{}};
+  if (!table_index->is_applicable(operator_predicate.predicate_condition, value, value2)) return false;
+
+  return _is_selective_enough(predicate_node);
+}
+
+bool IndexScanRule::_is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const {
   const auto row_count_table = predicate_node->left_input()->derive_statistics_from(nullptr, nullptr)->row_count();
   if (row_count_table < INDEX_SCAN_ROW_COUNT_THRESHOLD) return false;
 
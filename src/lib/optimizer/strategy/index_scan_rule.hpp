@@ -12,6 +12,8 @@ namespace opossum {
 
 class AbstractLQPNode;
 class PredicateNode;
+class StoredTableNode;
+class Table;
 
 /**
  * This optimizer rule finds PredicateNodes whose inputs are StoredTableNodes. These PredicateNodes are candidates
@@ -23,6 +25,9 @@ class PredicateNode;
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
  * Currently, only GroupKeyIndexes are supported.
+ *
+ * A TableIndex (see Table::create_table_index()) on the predicate's column is used under the same conditions, as long
+ * as no chunks of the table are pruned.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +38,9 @@ class IndexScanRule : public AbstractRule {
  protected:
   bool _is_index_scan_applicable(const IndexInfo& index_info,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_table_index_scan_applicable(const Table& table, const StoredTableNode& stored_table_node,
+                                       const std::shared_ptr<PredicateNode>& predicate_node) const;
+  bool _is_selective_enough(const std::shared_ptr<PredicateNode>& predicate_node) const;
   inline bool _is_single_segment_index(const IndexInfo& index_info) const;
 };
 
@@ -2,15 +2,16 @@
 
 #include "expression/expression_utils.hpp"
 #include "logical_query_plan/projection_node.hpp"
-#include "optimizer/join_ordering/dp_ccp.hpp"
-#include "optimizer/join_ordering/greedy_operator_ordering.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
 #include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator)
-    : _cost_estimator(cost_estimator) {}
+JoinOrderingRule::JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                                   const size_t max_csg_cmp_pair_count)
+    : _cost_estimator(cost_estimator), _max_csg_cmp_pair_count(max_csg_cmp_pair_count) {}
 
 std::string JoinOrderingRule::name() const { return "JoinOrderingRule"; }
 
@@ -40,7 +41,7 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
    * Try to build a JoinGraph starting for the current subplan
    *    -> if that fails, continue to try it with the node's inputs
    *    -> if that works
-   *        -> call DpCcp on that JoinGraph
+   *        -> call DpHyp (or LinearizedDp, if DpHyp exceeds its budget) on that JoinGraph
    *        -> look for more JoinGraphs below the JoinGraph's vertices
    */
 
@@ -50,13 +51,11 @@ std::shared_ptr<AbstractLQPNode> JoinOrderingRule::_perform_join_ordering_recurs
     return lqp;
   }
 
-  // Simple heuristic: Use DpCcp for any query with less than X tables and GOO for everything more complex
-  // TODO(anybody) Increase X once our costing/cardinality estimation is faster/uses internal caching
-  auto result_lqp = std::shared_ptr<AbstractLQPNode>{};
-  if (join_graph->vertices.size() < 9) {
-    result_lqp = DpCcp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
-  } else {
-    result_lqp = GreedyOperatorOrdering{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
+  // The number of join candidates DpHyp needs to consider depends on the shape of the JoinGraph rather than only on its
+  // size, so we let DpHyp decide whether the JoinGraph is too complex
+  auto result_lqp = DpHyp{_cost_estimator, _max_csg_cmp_pair_count}(*join_graph);  // NOLINT - doesn't like `{}()`
+  if (!result_lqp) {
+    result_lqp = LinearizedDp{_cost_estimator}(*join_graph);  // NOLINT - doesn't like `{}()`
   }
 
   for (const auto& vertex : join_graph->vertices) {
@@ -10,14 +10,17 @@ class AbstractCostEstimator;
 
 /**
  * A rule that brings join operations into a (supposedly) efficient order.
- * Currently only the order of inner joins is modified using a single underlying algorithm, DpCcp.
- *
- * TODO(anybody) Use a different join ordering algorithm, such as GreedyOperatorOrdering, if there are too many join
- *               operations for DPccp to handle efficiently.
+ * Currently only the order of inner joins is modified. The optimal order is searched for with DpHyp. If DpHyp would
+ * need to consider more than max_csg_cmp_pair_count join candidates, which bounds the optimization time, LinearizedDp
+ * is used instead.
  */
 class JoinOrderingRule : public AbstractRule {
  public:
-  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator);
+  // Enough for all sizes of chain and cycle queries we have encountered and for star queries with ~12 tables
+  static constexpr auto DEFAULT_MAX_CSG_CMP_PAIR_COUNT = size_t{20'000};
+
+  explicit JoinOrderingRule(const std::shared_ptr<AbstractCostEstimator>& cost_estimator,
+                            const size_t max_csg_cmp_pair_count = DEFAULT_MAX_CSG_CMP_PAIR_COUNT);
 
   std::string name() const override;
 
@@ -29,6 +32,7 @@ class JoinOrderingRule : public AbstractRule {
   void _recurse_to_inputs(const std::shared_ptr<AbstractLQPNode>& lqp) const;
 
   std::shared_ptr<AbstractCostEstimator> _cost_estimator;
+  const size_t _max_csg_cmp_pair_count;
 };
 
 }  // namespace opossum
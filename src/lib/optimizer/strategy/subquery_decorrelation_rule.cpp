@@ -0,0 +1,284 @@
+#include "subquery_decorrelation_rule.hpp"
+
+#include <algorithm>
+#include <optional>
+#include <vector>
+
+#include "expression/aggregate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/in_expression.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Describes how a PredicateNode with a correlated subquery is replaced
+struct Decorrelation {
+  // Plan producing the (grouped) result of the subquery, joined with the input of the PredicateNode
+  std::shared_ptr<AbstractLQPNode> subplan;
+  std::shared_ptr<AbstractExpression> join_predicate;
+
+  // Replaces the predicate of the PredicateNode, with the subquery replaced by a column of the subplan
+  std::shared_ptr<AbstractExpression> predicate;
+};
+
+size_t count_parameter_usages(const std::shared_ptr<AbstractLQPNode>& lqp, const ParameterID parameter_id) {
+  auto usage_count = size_t{0};
+
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        const auto parameter_expression = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression);
+        if (parameter_expression && parameter_expression->parameter_id == parameter_id) {
+          ++usage_count;
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  return usage_count;
+}
+
+// @return the column compared with the parameter, if @param predicate is `<column> = <parameter>`
+std::shared_ptr<AbstractExpression> get_correlated_column(const std::shared_ptr<AbstractExpression>& predicate,
+                                                          const ParameterID parameter_id) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return nullptr;
+
+  for (const auto& [column, parameter] : {std::make_pair(binary_predicate->left_operand(),
+                                                         binary_predicate->right_operand()),
+                                          std::make_pair(binary_predicate->right_operand(),
+                                                         binary_predicate->left_operand())}) {
+    if (column->type != ExpressionType::LQPColumn || parameter->type != ExpressionType::CorrelatedParameter) continue;
+    if (static_cast<const CorrelatedParameterExpression&>(*parameter).parameter_id != parameter_id) continue;
+    return column;
+  }
+
+  return nullptr;
+}
+
+/**
+ * Searches the `<column> = <parameter>` predicate from @param first_node downwards and removes it from @param lqp.
+ * The column is added to all ProjectionNodes above the predicate, so that it is available for the join.
+ * @return the column, or nullptr (with @param lqp unchanged) if the subquery cannot be decorrelated
+ */
+std::shared_ptr<AbstractExpression> remove_correlated_predicate(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                                const std::shared_ptr<AbstractLQPNode>& first_node,
+                                                                const ParameterID parameter_id) {
+  if (count_parameter_usages(lqp, parameter_id) != 1) return nullptr;
+
+  auto projection_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto correlated_predicate_node = std::shared_ptr<AbstractLQPNode>{};
+  auto correlated_column = std::shared_ptr<AbstractExpression>{};
+
+  for (auto node = first_node; node && !correlated_predicate_node; node = node->left_input()) {
+    switch (node->type) {
+      case LQPNodeType::Projection:
+        projection_nodes.emplace_back(node);
+        break;
+
+      case LQPNodeType::Validate:
+      case LQPNodeType::Sort:
+        break;
+
+      case LQPNodeType::Predicate:
+        correlated_column =
+            get_correlated_column(std::static_pointer_cast<PredicateNode>(node)->predicate(), parameter_id);
+        if (correlated_column) correlated_predicate_node = node;
+        break;
+
+      default:
+        // Joins, Unions, Limits, etc. change the result when the predicate is pulled up above them
+        return nullptr;
+    }
+  }
+
+  if (!correlated_predicate_node) return nullptr;
+
+  lqp_remove_node(correlated_predicate_node);
+
+  for (const auto& projection_node : projection_nodes) {
+    auto& expressions = projection_node->node_expressions;
+    const auto column_is_projected = std::any_of(expressions.begin(), expressions.end(), [&](const auto& expression) {
+      return *expression == *correlated_column;
+    });
+    if (!column_is_projected) expressions.emplace_back(correlated_column);
+  }
+
+  return correlated_column;
+}
+
+// @return whether @param expression references no columns other than @param aggregate_expression, e.g., `0.2 * AVG(a)`
+bool is_computed_from_aggregate(const std::shared_ptr<AbstractExpression>& expression,
+                                const std::shared_ptr<AbstractExpression>& aggregate_expression) {
+  auto computed_from_aggregate = true;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (*sub_expression == *aggregate_expression) return ExpressionVisitation::DoNotVisitArguments;
+
+    switch (sub_expression->type) {
+      case ExpressionType::LQPColumn:
+      case ExpressionType::Aggregate:
+      case ExpressionType::CorrelatedParameter:
+      case ExpressionType::Placeholder:
+      case ExpressionType::LQPSubquery:
+        computed_from_aggregate = false;
+        return ExpressionVisitation::DoNotVisitArguments;
+      default:
+        return ExpressionVisitation::VisitArguments;
+    }
+  });
+  return computed_from_aggregate;
+}
+
+// `<expression> <comparison> (SELECT <aggregate> FROM ... WHERE <column> = <parameter>)`, where the subquery may
+// compute its result from the aggregate, such as `SELECT 0.2 * AVG(l_quantity)` in TPC-H Q17
+std::optional<Decorrelation> decorrelate_scalar_aggregate(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate) return std::nullopt;
+
+  switch (binary_predicate->predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      break;
+    default:
+      return std::nullopt;
+  }
+
+  const auto subquery_is_left = binary_predicate->left_operand()->type == ExpressionType::LQPSubquery;
+  const auto subquery_is_right = binary_predicate->right_operand()->type == ExpressionType::LQPSubquery;
+  if (subquery_is_left == subquery_is_right) return std::nullopt;
+
+  const auto& subquery_expression = static_cast<const LQPSubqueryExpression&>(
+      subquery_is_left ? *binary_predicate->left_operand() : *binary_predicate->right_operand());
+  if (subquery_expression.arguments.size() != 1) return std::nullopt;
+
+  // The subquery's LQP is copied, so that it is left untouched if it cannot be decorrelated
+  const auto lqp = subquery_expression.lqp->deep_copy();
+
+  auto projection_node = std::shared_ptr<AbstractLQPNode>{};
+  auto aggregate_lqp = lqp;
+  if (lqp->type == LQPNodeType::Projection) {
+    if (lqp->node_expressions.size() != 1) return std::nullopt;
+    projection_node = lqp;
+    aggregate_lqp = lqp->left_input();
+  }
+  if (aggregate_lqp->type != LQPNodeType::Aggregate) return std::nullopt;
+
+  const auto aggregate_node = std::static_pointer_cast<AggregateNode>(aggregate_lqp);
+  if (aggregate_node->aggregate_expressions_begin_idx != 0 || aggregate_node->node_expressions.size() != 1) {
+    return std::nullopt;
+  }
+
+  const auto aggregate_expression = aggregate_node->node_expressions[0];
+  const auto aggregate_function = static_cast<const AggregateExpression&>(*aggregate_expression).aggregate_function;
+  if (aggregate_function == AggregateFunction::Count || aggregate_function == AggregateFunction::CountDistinct) {
+    return std::nullopt;
+  }
+
+  const auto subquery_result = projection_node ? projection_node->node_expressions[0] : aggregate_expression;
+  if (!is_computed_from_aggregate(subquery_result, aggregate_expression)) return std::nullopt;
+
+  const auto correlated_column =
+      remove_correlated_predicate(lqp, aggregate_node->left_input(), subquery_expression.parameter_ids[0]);
+  if (!correlated_column) return std::nullopt;
+
+  // Compute the aggregate for each value of the correlated column at once
+  const auto aggregate_input = aggregate_node->left_input();
+  aggregate_node->set_left_input(nullptr);
+  auto subplan = std::shared_ptr<AbstractLQPNode>{AggregateNode::make(
+      expression_vector(correlated_column), expression_vector(aggregate_expression), aggregate_input)};
+
+  // Compute the subquery's result per value of the correlated column as well
+  if (projection_node && *subquery_result != *aggregate_expression) {
+    subplan = ProjectionNode::make(expression_vector(correlated_column, subquery_result), subplan);
+  }
+
+  const auto decorrelated_predicate = std::make_shared<BinaryPredicateExpression>(
+      binary_predicate->predicate_condition, subquery_is_left ? subquery_result : binary_predicate->left_operand(),
+      subquery_is_right ? subquery_result : binary_predicate->right_operand());
+
+  return Decorrelation{subplan, equals_(subquery_expression.arguments[0], correlated_column), decorrelated_predicate};
+}
+
+// `<expression> IN (SELECT <column> FROM ... WHERE <column> = <parameter>)`
+std::optional<Decorrelation> decorrelate_in(const std::shared_ptr<AbstractExpression>& predicate) {
+  const auto in_expression = std::dynamic_pointer_cast<InExpression>(predicate);
+  if (!in_expression || in_expression->is_negated() || in_expression->set()->type != ExpressionType::LQPSubquery) {
+    return std::nullopt;
+  }
+
+  const auto& subquery_expression = static_cast<const LQPSubqueryExpression&>(*in_expression->set());
+  if (subquery_expression.arguments.size() != 1) return std::nullopt;
+
+  const auto lqp = subquery_expression.lqp->deep_copy();
+  if (lqp->type != LQPNodeType::Projection || lqp->node_expressions.size() != 1 ||
+      lqp->node_expressions[0]->type != ExpressionType::LQPColumn) {
+    return std::nullopt;
+  }
+
+  const auto value_column = lqp->node_expressions[0];
+
+  const auto correlated_column = remove_correlated_predicate(lqp, lqp, subquery_expression.parameter_ids[0]);
+  if (!correlated_column) return std::nullopt;
+
+  // Make the values distinct per value of the correlated column, so that the join does not duplicate outer rows
+  auto group_by_expressions = expression_vector(correlated_column);
+  if (*value_column != *correlated_column) group_by_expressions.emplace_back(value_column);
+  const auto distinct_node = AggregateNode::make(group_by_expressions, expression_vector(), lqp);
+
+  return Decorrelation{distinct_node, equals_(subquery_expression.arguments[0], correlated_column),
+                       equals_(in_expression->value(), value_column)};
+}
+
+}  // namespace
+
+namespace opossum {
+
+std::string SubqueryDecorrelationRule::name() const { return "Correlated Subquery to Join Decorrelation Rule"; }
+
+void SubqueryDecorrelationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(node);
+  if (!predicate_node) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  auto decorrelation = decorrelate_scalar_aggregate(predicate_node->predicate());
+  if (!decorrelation) decorrelation = decorrelate_in(predicate_node->predicate());
+
+  if (!decorrelation) {
+    _apply_to_inputs(node);
+    return;
+  }
+
+  // The join adds the columns of the subplan, which the nodes above the PredicateNode do not expect
+  const auto projection_node = ProjectionNode::make(predicate_node->left_input()->column_expressions());
+  lqp_replace_node(predicate_node, projection_node);
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, decorrelation->join_predicate);
+  lqp_insert_node(projection_node, LQPInputSide::Left, join_node);
+  join_node->set_right_input(decorrelation->subplan);
+
+  lqp_insert_node(projection_node, LQPInputSide::Left, PredicateNode::make(decorrelation->predicate));
+
+  _apply_to_inputs(projection_node);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * Rewrites correlated subqueries in PredicateNodes into joins, so that they are not executed once per outer row by the
+ * ExpressionEvaluator. Covers
+ *
+ *  - scalar aggregates, such as
+ *        SELECT * FROM t1 WHERE t1.a < (SELECT MAX(t2.b) FROM t2 WHERE t2.c = t1.c)
+ *    which become an inner join of t1 with `SELECT t2.c, MAX(t2.b) FROM t2 GROUP BY t2.c` on t1.c = t2.c, followed by
+ *    the predicate t1.a < MAX(t2.b). A ProjectionNode that computes the subquery's result from the aggregate (e.g.,
+ *    `SELECT 0.2 * AVG(t2.b)`, as in TPC-H Q17) is evaluated per group as well.
+ *
+ *  - IN subqueries, such as
+ *        SELECT * FROM t1 WHERE t1.a IN (SELECT t2.b FROM t2 WHERE t2.c = t1.c)
+ *    which become an inner join of t1 with `SELECT DISTINCT t2.c, t2.b FROM t2` on t1.c = t2.c, followed by the
+ *    predicate t1.a = t2.b. Since t2.b is distinct per t2.c, each row of t1 is matched at most once.
+ *
+ * In both cases, a ProjectionNode restores the columns of the outer LQP. As our joins can only handle a single
+ * predicate, the rule is limited to subqueries that
+ *  - use exactly one correlated parameter, exactly once, in a `<column> = <parameter>` predicate
+ *  - contain only Predicate-, Validate-, Sort- and ProjectionNodes (for IN: with a single column as the result) below
+ *    the AggregateNode (for scalar aggregates) or as the root (for IN)
+ *
+ * Not covered are
+ *  - COUNT(*) and COUNT(DISTINCT) aggregates, since they return 0 instead of NULL for an empty input, so outer rows
+ *    without a join partner would need to be kept (the "COUNT bug")
+ *  - NOT IN, which has different NULL semantics than an anti join
+ *  - subqueries that are not a direct operand of the PredicateNode's predicate (e.g., `x = 1 OR y IN (...)`), since
+ *    the join can only replace conjunctive predicates
+ *
+ * Subqueries not covered by this rule (or the ExistsReformulationRule) are still executed per row, although the
+ * ExpressionEvaluator memoizes their results per distinct parameter value.
+ */
+class SubqueryDecorrelationRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  void apply_to(const std::shared_ptr<AbstractLQPNode>& node) const override;
+};
+
+}  // namespace opossum
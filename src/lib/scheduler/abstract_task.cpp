@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "abstract_scheduler.hpp"
+#include "cancellation_token.hpp"
 #include "current_scheduler.hpp"
 #include "task_queue.hpp"
 #include "utils/tracing/probes.hpp"
@@ -13,9 +14,24 @@
 
 #include "utils/assert.hpp"
 
+namespace {
+
+// The QueryClass of the task being executed on this thread. Tasks can execute other tasks on the same thread (e.g.,
+// while waiting for their JobTasks), so execute() restores the previous class afterwards.
+thread_local opossum::QueryClass this_thread_query_class = opossum::QueryClass::Analytical;
+
+// Same for the CancellationToken of the task being executed on this thread
+thread_local std::shared_ptr<const opossum::CancellationToken> this_thread_cancellation_token;  // NOLINT
+
+}  // namespace
+
 namespace opossum {
 
-AbstractTask::AbstractTask(SchedulePriority priority, bool stealable) : _priority(priority), _stealable(stealable) {}
+AbstractTask::AbstractTask(SchedulePriority priority, bool stealable)
+    : _priority(priority),
+      _stealable(stealable),
+      _query_class(::this_thread_query_class),
+      _cancellation_token(::this_thread_cancellation_token) {}
 
 TaskID AbstractTask::id() const { return _id; }
 
@@ -29,6 +45,30 @@ bool AbstractTask::is_stealable() const { return _stealable; }
 
 bool AbstractTask::is_scheduled() const { return _is_scheduled; }
 
+QueryClass AbstractTask::query_class() const { return _query_class; }
+
+void AbstractTask::set_query_class(const QueryClass query_class) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the query class after the Task was scheduled");
+
+  _query_class = query_class;
+}
+
+QueryClass AbstractTask::current_query_class() { return ::this_thread_query_class; }
+
+const std::shared_ptr<const CancellationToken>& AbstractTask::cancellation_token() const {
+  return _cancellation_token;
+}
+
+void AbstractTask::set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  DebugAssert((!_is_scheduled), "Possible race: Don't set the cancellation token after the Task was scheduled");
+
+  _cancellation_token = cancellation_token;
+}
+
+const std::shared_ptr<const CancellationToken>& AbstractTask::current_cancellation_token() {
+  return ::this_thread_cancellation_token;
+}
+
 std::string AbstractTask::description() const {
   return _description.empty() ? "{Task with id: " + std::to_string(_id) + "}" : _description;
 }
@@ -80,7 +120,20 @@ void AbstractTask::execute() {
   DebugAssert(!(_started.exchange(true)), "Possible bug: Trying to execute the same task twice");
   DebugAssert(is_ready(), "Task must not be executed before its dependencies are done");
 
-  _on_execute();
+  const auto previous_query_class = ::this_thread_query_class;
+  auto previous_cancellation_token = std::move(::this_thread_cancellation_token);
+  ::this_thread_query_class = _query_class;
+  ::this_thread_cancellation_token = _cancellation_token;
+
+  try {
+    _on_execute();
+  } catch (const QueryCancelledException&) {
+    // The query was cancelled. The task is done nevertheless, so that its successors are executed (and stop early as
+    // well) and nobody waits for it forever. Whoever executes the query reports the cancellation.
+  }
+
+  ::this_thread_query_class = previous_query_class;
+  ::this_thread_cancellation_token = std::move(previous_cancellation_token);
 
   for (auto& successor : _successors) {
     successor->_on_predecessor_done();
@@ -12,6 +12,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class Worker;
 
 /**
@@ -47,6 +48,33 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
    */
   bool is_stealable() const;
 
+  /**
+   * The QueryClass determines the ResourceGroup whose share of the workers the task is executed with. By default, a
+   * task has the class of the task that is being executed on the thread creating it (see current_query_class()). Thus,
+   * the JobTasks spawned by an operator are scheduled in the class of the operator's query.
+   */
+  QueryClass query_class() const;
+  void set_query_class(const QueryClass query_class);
+
+  /**
+   * @return the QueryClass of the task that is being executed on the calling thread, or QueryClass::Analytical if no
+   *         task is being executed
+   */
+  static QueryClass current_query_class();
+
+  /**
+   * The CancellationToken of the query the task belongs to, nullptr if the query cannot be cancelled. Like the
+   * QueryClass, it is inherited from the task being executed on the thread creating the task. A task whose query is
+   * cancelled before or while it is executed stops early (see CancellationToken) and is done nonetheless.
+   */
+  const std::shared_ptr<const CancellationToken>& cancellation_token() const;
+  void set_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
+  /**
+   * @return the CancellationToken of the task that is being executed on the calling thread, or nullptr
+   */
+  static const std::shared_ptr<const CancellationToken>& current_cancellation_token();
+
   /**
    * Description for debugging purposes
    */
@@ -131,6 +159,8 @@ class AbstractTask : public std::enable_shared_from_this<AbstractTask> {
   std::atomic<NodeID> _node_id = INVALID_NODE_ID;
   SchedulePriority _priority;
   bool _stealable;
+  QueryClass _query_class;
+  std::shared_ptr<const CancellationToken> _cancellation_token;
   std::atomic_bool _done{false};
   std::function<void()> _done_callback;
 
@@ -0,0 +1,34 @@
+#include "cancellation_token.hpp"
+
+#include <memory>
+#include <string>
+
+#include "abstract_task.hpp"
+
+namespace opossum {
+
+void CancellationToken::cancel() { _cancelled = true; }
+
+void CancellationToken::set_timeout(const std::chrono::milliseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  _deadline = deadline.time_since_epoch().count();
+}
+
+bool CancellationToken::is_cancelled() const {
+  if (_cancelled) return true;
+
+  const auto deadline = _deadline.load();
+  return deadline != 0 && std::chrono::steady_clock::now().time_since_epoch().count() >= deadline;
+}
+
+std::string CancellationToken::cancellation_reason() const {
+  return _cancelled ? "canceling statement due to user request" : "canceling statement due to statement timeout";
+}
+
+void CancellationToken::check_current() { check(AbstractTask::current_cancellation_token()); }
+
+void CancellationToken::check(const std::shared_ptr<const CancellationToken>& token) {
+  if (token && token->is_cancelled()) throw QueryCancelledException(token->cancellation_reason());
+}
+
+}  // namespace opossum
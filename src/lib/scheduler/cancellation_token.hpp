@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace opossum {
+
+/**
+ * Thrown by CancellationToken::check_current() once the query of the calling thread was cancelled. Tasks that throw
+ * it are treated as done (see AbstractTask::execute()), so that the remaining tasks of a cancelled query finish
+ * quickly and the query's caller (e.g., the SQLPipelineStatement) reports the cancellation.
+ */
+class QueryCancelledException : public std::runtime_error {
+ public:
+  explicit QueryCancelledException(const std::string& what_arg) : std::runtime_error(what_arg) {}
+};
+
+/**
+ * Allows stopping a query that is being executed. Queries are cancelled cooperatively: the token is passed on to all
+ * tasks of the query, including the JobTasks spawned by its operators (see AbstractTask), and operators check it
+ * between chunks. A token is cancelled either explicitly or once its timeout expired.
+ */
+class CancellationToken {
+ public:
+  void cancel();
+
+  // The query is cancelled once @param timeout has passed (counting from this call)
+  void set_timeout(const std::chrono::milliseconds timeout);
+
+  bool is_cancelled() const;
+
+  // @return the reason of the cancellation, for error messages
+  std::string cancellation_reason() const;
+
+  // Throws a QueryCancelledException if the token of the task executed by the calling thread is cancelled
+  static void check_current();
+
+  // Throws a QueryCancelledException if @param token is set and cancelled
+  static void check(const std::shared_ptr<const CancellationToken>& token);
+
+ private:
+  std::atomic_bool _cancelled{false};
+
+  // Nanoseconds since the epoch of the steady clock, zero if there is no timeout
+  std::atomic<std::chrono::steady_clock::rep> _deadline{0};
+};
+
+}  // namespace opossum
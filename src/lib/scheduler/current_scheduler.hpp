@@ -3,6 +3,7 @@
 #include <memory>
 #include <vector>
 
+#include "cancellation_token.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 #include "worker.hpp"
@@ -28,6 +29,8 @@ class CurrentScheduler {
   /**
    * If there is an active Scheduler, block execution until all @param tasks have finished
    * If there is no active Scheduler, returns immediately since all @param tasks have executed when they were scheduled
+   * Throws a QueryCancelledException if the query of the calling task was cancelled, as the @param tasks might have
+   * been skipped (see CancellationToken) and their results must not be used.
    */
   template <typename TaskType>
   static void wait_for_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks);
@@ -64,6 +67,8 @@ void CurrentScheduler::wait_for_tasks(const std::vector<std::shared_ptr<TaskType
   } else {
     for (auto& task : tasks) task->_join();
   }
+
+  CancellationToken::check_current();
 }
 
 template <typename TaskType>
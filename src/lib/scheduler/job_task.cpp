@@ -1,7 +1,12 @@
 #include "job_task.hpp"
 
+#include "cancellation_token.hpp"
+
 namespace opossum {
 
-void JobTask::_on_execute() { _fn(); }
+void JobTask::_on_execute() {
+  CancellationToken::check_current();
+  _fn();
+}
 
 }  // namespace opossum
@@ -101,8 +101,9 @@ void OperatorTask::_on_execute() {
   // root (i.e., the final result)
   if (_cleanup_temporaries == CleanupTemporaries::Yes) {
     for (const auto& weak_predecessor : predecessors()) {
+      // Predecessors that are not OperatorTasks (e.g., the admission task of a ResourceGroup) have no output
       const auto predecessor = std::dynamic_pointer_cast<OperatorTask>(weak_predecessor.lock());
-      DebugAssert(predecessor != nullptr, "predecessor of OperatorTask is not an OperatorTask itself");
+      if (!predecessor) continue;
       auto previous_operator_still_needed = false;
 
       for (const auto& successor : predecessor->successors()) {
@@ -0,0 +1,111 @@
+#include "resource_group.hpp"
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ResourceGroup::ResourceGroup(const uint32_t weight, const size_t max_concurrent_queries)
+    : _weight(weight), _max_concurrent_queries(max_concurrent_queries) {}
+
+ResourceGroup& ResourceGroup::get(const QueryClass query_class) {
+  static ResourceGroup transactional_group{DEFAULT_TRANSACTIONAL_WEIGHT, 0};
+  static ResourceGroup analytical_group{DEFAULT_ANALYTICAL_WEIGHT, 0};
+
+  switch (query_class) {
+    case QueryClass::Transactional:
+      return transactional_group;
+    case QueryClass::Analytical:
+      return analytical_group;
+  }
+  Fail("Invalid enum value");
+}
+
+void ResourceGroup::reset() {
+  for (const auto query_class : {QueryClass::Transactional, QueryClass::Analytical}) {
+    auto& resource_group = get(query_class);
+    std::lock_guard<std::mutex> lock(resource_group._mutex);
+    DebugAssert(resource_group._running_query_count == 0 && resource_group._waiting_admission_tasks.empty(),
+                "Cannot reset a ResourceGroup while queries are being executed");
+
+    resource_group._weight = query_class == QueryClass::Transactional ? DEFAULT_TRANSACTIONAL_WEIGHT
+                                                                      : DEFAULT_ANALYTICAL_WEIGHT;
+    resource_group._max_concurrent_queries = 0;
+  }
+}
+
+uint32_t ResourceGroup::weight() const { return _weight; }
+
+void ResourceGroup::set_weight(const uint32_t weight) {
+  Assert(weight > 0, "The weight of a ResourceGroup has to be positive");
+  _weight = weight;
+}
+
+size_t ResourceGroup::max_concurrent_queries() const { return _max_concurrent_queries; }
+
+void ResourceGroup::set_max_concurrent_queries(const size_t max_concurrent_queries) {
+  auto admitted_tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _max_concurrent_queries = max_concurrent_queries;
+
+    // A higher limit admits waiting queries right away
+    while (!_waiting_admission_tasks.empty() &&
+           (max_concurrent_queries == 0 || _running_query_count < max_concurrent_queries)) {
+      admitted_tasks.emplace_back(std::move(_waiting_admission_tasks.front()));
+      _waiting_admission_tasks.pop_front();
+      ++_running_query_count;
+    }
+  }
+
+  for (const auto& admission_task : admitted_tasks) {
+    admission_task->schedule();
+  }
+}
+
+size_t ResourceGroup::running_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _running_query_count;
+}
+
+size_t ResourceGroup::waiting_query_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _waiting_admission_tasks.size();
+}
+
+void ResourceGroup::_admit_query(const std::shared_ptr<AbstractTask>& admission_task) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_max_concurrent_queries != 0 && _running_query_count >= _max_concurrent_queries) {
+      _waiting_admission_tasks.emplace_back(admission_task);
+      return;
+    }
+    ++_running_query_count;
+  }
+
+  admission_task->schedule();
+}
+
+void ResourceGroup::_release_query() {
+  auto admission_task = std::shared_ptr<AbstractTask>{};
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // The released slot is handed over to the next waiting query, unless the limit was lowered in the meantime
+    if (!_waiting_admission_tasks.empty() &&
+        (_max_concurrent_queries == 0 || _running_query_count <= _max_concurrent_queries)) {
+      admission_task = std::move(_waiting_admission_tasks.front());
+      _waiting_admission_tasks.pop_front();
+    } else {
+      --_running_query_count;
+    }
+  }
+
+  if (admission_task) admission_task->schedule();
+}
+
+}  // namespace opossum
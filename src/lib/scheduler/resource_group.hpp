@@ -0,0 +1,89 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Scheduling configuration and admission control for the queries of one QueryClass. Use ResourceGroup::get() to
+ * access the group of a class.
+ *
+ *  - weight: As long as both classes have ready tasks, the TaskQueues hand out their tasks in proportion to the
+ *    weights of their classes (see TaskQueue).
+ *  - max_concurrent_queries: The number of queries of the class that are executed at the same time. Further queries
+ *    are held back until one of the executed queries is done. 0 means unlimited.
+ *
+ * By default, Transactional queries get four times the share of Analytical queries and the number of concurrent
+ * queries is not limited.
+ */
+class ResourceGroup final : private Noncopyable {
+ public:
+  static constexpr uint32_t DEFAULT_TRANSACTIONAL_WEIGHT = 4;
+  static constexpr uint32_t DEFAULT_ANALYTICAL_WEIGHT = 1;
+
+  static ResourceGroup& get(const QueryClass query_class);
+
+  // Restores the default configuration of all groups. Must not be called while queries are being executed.
+  static void reset();
+
+  uint32_t weight() const;
+  void set_weight(const uint32_t weight);
+
+  size_t max_concurrent_queries() const;
+  void set_max_concurrent_queries(const size_t max_concurrent_queries);
+
+  // @return the number of queries of this group that are currently executed
+  size_t running_query_count() const;
+
+  // @return the number of queries of this group that wait to be admitted
+  size_t waiting_query_count() const;
+
+  /**
+   * Schedules the tasks of a query, which are executed once the query is admitted. Until then, they are held back by
+   * an additional predecessor, so that no thread (in particular, no Worker) blocks while waiting for the admission.
+   * The query is executed until its last task (i.e., the root of its PQP) is done.
+   */
+  template <typename TaskType>
+  void schedule_query_tasks(const std::vector<std::shared_ptr<TaskType>>& tasks) {
+    DebugAssert(!tasks.empty(), "Expected at least one task");
+
+    auto admission_task = std::make_shared<JobTask>([]() {});
+    auto release_task = std::make_shared<JobTask>([this]() { _release_query(); });
+    admission_task->set_query_class(tasks.back()->query_class());
+    release_task->set_query_class(tasks.back()->query_class());
+
+    for (const auto& task : tasks) {
+      if (task->predecessors().empty()) admission_task->set_as_predecessor_of(task);
+    }
+    tasks.back()->set_as_predecessor_of(release_task);
+
+    release_task->schedule();
+    CurrentScheduler::schedule_tasks(tasks);
+    _admit_query(admission_task);
+  }
+
+ private:
+  ResourceGroup(const uint32_t weight, const size_t max_concurrent_queries);
+
+  // Schedules the @param admission_task if the query can be executed right away, otherwise, it waits for a release
+  void _admit_query(const std::shared_ptr<AbstractTask>& admission_task);
+  void _release_query();
+
+  std::atomic<uint32_t> _weight;
+  std::atomic<size_t> _max_concurrent_queries;
+
+  mutable std::mutex _mutex;
+  size_t _running_query_count{0};
+  std::deque<std::shared_ptr<AbstractTask>> _waiting_admission_tasks;
+};
+
+}  // namespace opossum
@@ -1,9 +1,11 @@
 #include "task_queue.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
 #include "abstract_task.hpp"
+#include "resource_group.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -21,17 +23,20 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  _queues[static_cast<size_t>(task->query_class())][priority].push(task);
 
   _num_tasks++;
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      _num_tasks--;
-      return task;
+  for (const auto query_class : _query_classes_by_pass()) {
+    for (auto& queue : _queues[static_cast<size_t>(query_class)]) {
+      if (queue.try_pop(task)) {
+        _num_tasks--;
+        _advance_pass(query_class);
+        return task;
+      }
     }
   }
   return nullptr;
@@ -39,17 +44,41 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        _num_tasks--;
-        return task;
-      } else {
-        queue.push(task);
+  for (const auto query_class : _query_classes_by_pass()) {
+    for (auto& queue : _queues[static_cast<size_t>(query_class)]) {
+      if (queue.try_pop(task)) {
+        if (task->is_stealable()) {
+          _num_tasks--;
+          _advance_pass(query_class);
+          return task;
+        } else {
+          queue.push(task);
+        }
       }
     }
   }
   return nullptr;
 }
 
+std::array<QueryClass, TaskQueue::NUM_QUERY_CLASSES> TaskQueue::_query_classes_by_pass() const {
+  const auto last_pass = _last_pass.load();
+  auto effective_passes = std::array<uint64_t, NUM_QUERY_CLASSES>{};
+  for (auto class_idx = size_t{0}; class_idx < NUM_QUERY_CLASSES; ++class_idx) {
+    effective_passes[class_idx] = std::max(_passes[class_idx].load(), last_pass);
+  }
+
+  auto query_classes = std::array<QueryClass, NUM_QUERY_CLASSES>{QueryClass::Transactional, QueryClass::Analytical};
+  std::stable_sort(query_classes.begin(), query_classes.end(), [&](const auto lhs, const auto rhs) {
+    return effective_passes[static_cast<size_t>(lhs)] < effective_passes[static_cast<size_t>(rhs)];
+  });
+  return query_classes;
+}
+
+void TaskQueue::_advance_pass(const QueryClass query_class) {
+  const auto class_idx = static_cast<size_t>(query_class);
+  const auto pass = std::max(_passes[class_idx].load(), _last_pass.load());
+  _last_pass = pass;
+  _passes[class_idx] = pass + STRIDE / ResourceGroup::get(query_class).weight();
+}
+
 }  // namespace opossum
@@ -14,10 +14,18 @@ class AbstractTask;
 
 /**
  * Holds a queue of AbstractTasks, usually one of these exists per node
+ *
+ * Each QueryClass has its own queues. When pulling, the classes are served by stride scheduling: every class has a
+ * pass that advances by STRIDE / weight (see ResourceGroup) whenever one of its tasks is pulled, and the class with the
+ * lowest pass is served first. Thus, as long as both classes have tasks, they get their shares of the workers in
+ * proportion to their weights. A class that had no tasks does not accumulate a credit, because its pass is raised to
+ * the pass of the last pulled task. Within a class, tasks are pulled in FIFO order, with High priority tasks first.
  */
 class TaskQueue {
  public:
   static constexpr uint32_t NUM_PRIORITY_LEVELS = 2;
+  static constexpr uint32_t NUM_QUERY_CLASSES = 2;
+  static constexpr uint64_t STRIDE = 1'000'000;
 
   explicit TaskQueue(NodeID node_id);
 
@@ -38,9 +46,20 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> steal();
 
  private:
+  // @return the query classes in the order in which they are to be served, i.e., by ascending pass
+  std::array<QueryClass, NUM_QUERY_CLASSES> _query_classes_by_pass() const;
+
+  // Advances the pass of @param query_class after one of its tasks was pulled
+  void _advance_pass(const QueryClass query_class);
+
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS>, NUM_QUERY_CLASSES>
+      _queues;
   std::atomic_uint _num_tasks{0};
+
+  // The passes are updated without synchronization between the workers, so the shares are only approximately kept
+  std::array<std::atomic<uint64_t>, NUM_QUERY_CLASSES> _passes{};
+  std::atomic<uint64_t> _last_pass{0};
 };
 
 }  // namespace opossum
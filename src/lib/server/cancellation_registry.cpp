@@ -0,0 +1,47 @@
+#include "cancellation_registry.hpp"
+
+#include <memory>
+
+#include "scheduler/cancellation_token.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+BackendKey CancellationRegistry::register_session() {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto process_id = _next_process_id++;
+  const auto secret_key = static_cast<int32_t>(_random_engine());
+  _sessions.emplace(process_id, SessionEntry{secret_key, nullptr});
+
+  return {process_id, secret_key};
+}
+
+void CancellationRegistry::unregister_session(const int32_t process_id) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _sessions.erase(process_id);
+}
+
+void CancellationRegistry::set_current_query(const int32_t process_id,
+                                             const std::shared_ptr<CancellationToken>& cancellation_token) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto session_iter = _sessions.find(process_id);
+  DebugAssert(session_iter != _sessions.end(), "Session was not registered");
+  session_iter->second.current_query = cancellation_token;
+}
+
+bool CancellationRegistry::cancel_current_query(const BackendKey& backend_key) {
+  std::lock_guard<std::mutex> lock(_mutex);
+
+  const auto session_iter = _sessions.find(backend_key.process_id);
+  if (session_iter == _sessions.end()) return false;
+
+  auto& session = session_iter->second;
+  if (session.secret_key != backend_key.secret_key || !session.current_query) return false;
+
+  session.current_query->cancel();
+  return true;
+}
+
+}  // namespace opossum
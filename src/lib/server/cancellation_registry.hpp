@@ -0,0 +1,46 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <random>
+#include <unordered_map>
+
+#include "postgres_wire_handler.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class CancellationToken;
+
+/**
+ * Keeps track of the query each session is currently executing, so that a CancelRequest, which a client sends on a
+ * new connection, can cancel it. Sessions are identified by their BackendKey, whose secret key prevents clients from
+ * cancelling the queries of other clients' sessions.
+ */
+class CancellationRegistry : public Singleton<CancellationRegistry> {
+ public:
+  // @return a new BackendKey with a unique process id and a random secret key
+  BackendKey register_session();
+  void unregister_session(const int32_t process_id);
+
+  void set_current_query(const int32_t process_id, const std::shared_ptr<CancellationToken>& cancellation_token);
+
+  // Cancels the current query of the session, if the secret key matches. @return whether a query was cancelled.
+  bool cancel_current_query(const BackendKey& backend_key);
+
+ protected:
+  CancellationRegistry() = default;
+  friend class Singleton;
+
+  struct SessionEntry {
+    int32_t secret_key;
+    std::shared_ptr<CancellationToken> current_query;
+  };
+
+  std::mutex _mutex;
+  int32_t _next_process_id{1};
+  std::mt19937 _random_engine{std::random_device{}()};
+  std::unordered_map<int32_t, SessionEntry> _sessions;
+};
+
+}  // namespace opossum
@@ -16,17 +16,18 @@ ClientConnection::ClientConnection(boost::asio::ip::tcp::socket socket) : _socke
   _response_buffer.reserve(_max_response_size);
 }
 
-boost::future<uint32_t> ClientConnection::receive_startup_packet_header() {
+boost::future<StartupPacketHeader> ClientConnection::receive_startup_packet_header() {
   constexpr uint32_t STARTUP_HEADER_LENGTH = 8u;
 
   return _receive_bytes_async(STARTUP_HEADER_LENGTH) >> then >> PostgresWireHandler::handle_startup_package;
 }
 
-boost::future<void> ClientConnection::receive_startup_packet_body(uint32_t size) {
-  return _receive_bytes_async(size) >> then >> [](InputPacket p) {
-    // Read these values and ignore them
-    PostgresWireHandler::handle_startup_package_content(p);
-  };
+boost::future<StartupParameters> ClientConnection::receive_startup_packet_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_startup_package_content;
+}
+
+boost::future<BackendKey> ClientConnection::receive_cancel_request_body(uint32_t size) {
+  return _receive_bytes_async(size) >> then >> PostgresWireHandler::handle_cancel_request_packet;
 }
 
 boost::future<RequestHeader> ClientConnection::receive_packet_header() {
@@ -80,6 +81,13 @@ boost::future<void> ClientConnection::send_auth() {
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
+boost::future<void> ClientConnection::send_backend_key_data(const BackendKey& backend_key) {
+  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::BackendKeyData);
+  PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(backend_key.process_id)));
+  PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(backend_key.secret_key)));
+  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+}
+
 boost::future<void> ClientConnection::send_parameter_status(const std::string& key, const std::string& value) {
   auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::ParameterStatus);
   PostgresWireHandler::write_string(*output_packet, key);
@@ -168,48 +176,27 @@ boost::future<void> ClientConnection::send_row_description(const std::vector<Col
     PostgresWireHandler::write_value(*output_packet,
                                      htons(static_cast<uint16_t>(column_description.type_width)));  // regular int
     PostgresWireHandler::write_value(*output_packet, htonl(-1));                                    // no modifier
-    PostgresWireHandler::write_value(*output_packet, htons(0u));                                    // text format
+    PostgresWireHandler::write_value(*output_packet,
+                                     htons(static_cast<uint16_t>(column_description.format)));  // text or binary
   }
 
   return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
 }
 
-boost::future<void> ClientConnection::send_data_row(const std::vector<std::string>& row_strings) {
-  auto output_packet = PostgresWireHandler::new_output_packet(NetworkMessageType::DataRow);
-
-  /*
-  DataRow (B)
-  Byte1('D')
-  Identifies the message as a data row.
-
-  Int32
-  Length of message contents in bytes, including self.
-
-  Int16
-  The number of column values that follow (possibly zero).
-
-  Next, the following pair of fields appear for each column:
-
-  Int32
-  The length of the column value, in bytes (this count does not include itself). Can be zero. As a special case,
-  -1 indicates a NULL column value. No value bytes follow in the NULL case.
-
-  Byte n
-  The value of the column, in the format indicated by the associated format code. n is the above length.
-  */
-
-  // Number of columns in row
-  PostgresWireHandler::write_value(*output_packet, htons(static_cast<uint16_t>(row_strings.size())));
-
-  for (const auto& value_string : row_strings) {
-    // Size of string representation of value, NOT of value type's size
-    PostgresWireHandler::write_value(*output_packet, htonl(static_cast<uint32_t>(value_string.length())));
-
-    // Text mode means that all values are sent as non-terminated strings
-    PostgresWireHandler::write_string(*output_packet, value_string, false);
-  }
+boost::future<void> ClientConnection::send_data_rows(const ByteBuffer& data_rows) {
+  // The DataRow messages are written directly from the caller's buffer instead of copying them into _response_buffer,
+  // which only holds a few small messages. Those need to be sent first to keep the order of the messages.
+  auto self = shared_from_this();
+  const auto write_data_rows = [this, self, &data_rows]() {
+    return boost::asio::async_write(_socket, boost::asio::buffer(data_rows), boost::asio::use_boost_future) >> then >>
+           [&data_rows](uint64_t sent_bytes) {
+             // If this fails, the connection may be closed but the server will keep running.
+             Assert(sent_bytes == data_rows.size(), "Could not send all data");
+           };
+  };
 
-  return _send_bytes_async(output_packet) >> then >> ignore_sent_bytes;
+  if (_response_buffer.empty()) return write_data_rows();
+  return _flush_async() >> then >> [write_data_rows](uint64_t) { return write_data_rows(); };
 }
 
 boost::future<void> ClientConnection::send_command_complete(const std::string& message) {
@@ -4,6 +4,10 @@
 #include <boost/thread/future.hpp>
 
 #include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "types.hpp"
 
 namespace opossum {
 
@@ -13,12 +17,14 @@ struct OutputPacket;
 struct RequestHeader;
 struct ParsePacket;
 struct BindPacket;
-enum class NetworkMessageType : unsigned char;
+struct StartupPacketHeader;
+struct BackendKey;
 
 struct ColumnDescription {
   std::string column_name;
   uint64_t object_id;
   int64_t type_width;
+  ResultFormat format{ResultFormat::Text};
 };
 
 // This class provides a wrapper over the TCP socket and (de)serializes
@@ -28,8 +34,9 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
  public:
   explicit ClientConnection(boost::asio::ip::tcp::socket socket);
 
-  boost::future<uint32_t> receive_startup_packet_header();
-  boost::future<void> receive_startup_packet_body(uint32_t size);
+  boost::future<StartupPacketHeader> receive_startup_packet_header();
+  boost::future<std::unordered_map<std::string, std::string>> receive_startup_packet_body(uint32_t size);
+  boost::future<BackendKey> receive_cancel_request_body(uint32_t size);
 
   boost::future<RequestHeader> receive_packet_header();
   boost::future<std::string> receive_simple_query_packet_body(uint32_t size);
@@ -42,13 +49,17 @@ class ClientConnection : public std::enable_shared_from_this<ClientConnection> {
 
   boost::future<void> send_ssl_denied();
   boost::future<void> send_auth();
+  boost::future<void> send_backend_key_data(const BackendKey& backend_key);
   boost::future<void> send_parameter_status(const std::string& key, const std::string& value);
   boost::future<void> send_ready_for_query();
   boost::future<void> send_error(const std::string& message);
   boost::future<void> send_notice(const std::string& notice);
   boost::future<void> send_status_message(const NetworkMessageType& type);
   boost::future<void> send_row_description(const std::vector<ColumnDescription>& row_description);
-  boost::future<void> send_data_row(const std::vector<std::string>& row_strings);
+
+  // Sends serialized DataRow messages (see DataRowSerializer) with a single write. @param data_rows needs to stay valid
+  // until the returned future is ready.
+  boost::future<void> send_data_rows(const ByteBuffer& data_rows);
   boost::future<void> send_command_complete(const std::string& message);
 
  protected:
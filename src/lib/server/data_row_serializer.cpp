@@ -0,0 +1,157 @@
+#include "data_row_serializer.hpp"
+
+#include <array>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Appends @param value in network byte order (big endian)
+template <typename T>
+void append_big_endian(ByteBuffer& buffer, const T value) {
+  static_assert(std::is_unsigned_v<T>, "Only unsigned values can be shifted safely");
+  for (auto byte_idx = sizeof(T); byte_idx > 0; --byte_idx) {
+    buffer.push_back(static_cast<char>((value >> ((byte_idx - 1) * 8)) & 0xFF));
+  }
+}
+
+void append_field(ByteBuffer& buffer, const char* const data, const size_t size) {
+  append_big_endian(buffer, static_cast<uint32_t>(size));
+  buffer.insert(buffer.end(), data, data + size);
+}
+
+template <typename T>
+void append_text_field(ByteBuffer& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    append_field(buffer, value.data(), value.size());
+  } else if constexpr (std::is_integral_v<T>) {
+    auto characters = std::array<char, 24>{};
+    const auto result = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    append_field(buffer, characters.data(), static_cast<size_t>(result.ptr - characters.data()));
+  } else {
+    // Same representation as std::to_string() (and thus type_cast<std::string>()), but without allocating a string
+    // per value. The largest double has 309 digits before the decimal point.
+    auto characters = std::array<char, 512>{};
+    const auto size = std::snprintf(characters.data(), characters.size(), "%f", static_cast<double>(value));
+    DebugAssert(size > 0 && static_cast<size_t>(size) < characters.size(), "Could not convert value to string");
+    append_field(buffer, characters.data(), static_cast<size_t>(size));
+  }
+}
+
+template <typename T>
+void append_binary_field(ByteBuffer& buffer, const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    append_field(buffer, value.data(), value.size());
+  } else {
+    // int4, int8, float4, and float8 are sent as their bit patterns in network byte order
+    using UnsignedType = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+    auto bits = UnsignedType{};
+    std::memcpy(&bits, &value, sizeof(T));
+
+    append_big_endian(buffer, static_cast<uint32_t>(sizeof(T)));
+    append_big_endian(buffer, bits);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+DataRowSerializer::DataRowSerializer(const Table& table, const std::vector<ResultFormat>& result_formats)
+    : _table(table),
+      _result_formats(resolve_result_formats(result_formats, table.column_count())),
+      _serialized_columns(table.column_count()) {}
+
+std::vector<ResultFormat> DataRowSerializer::resolve_result_formats(const std::vector<ResultFormat>& result_formats,
+                                                                    const size_t column_count) {
+  if (result_formats.empty()) return std::vector<ResultFormat>(column_count, ResultFormat::Text);
+  if (result_formats.size() == 1) return std::vector<ResultFormat>(column_count, result_formats.front());
+
+  Assert(result_formats.size() == column_count, "Expected a result format for each column");
+  return result_formats;
+}
+
+const ByteBuffer& DataRowSerializer::serialize_next_batch(const size_t min_batch_size) {
+  _batch.clear();
+
+  const auto column_count = _table.column_count();
+
+  while (_batch.size() < min_batch_size && _chunk_id < _table.chunk_count()) {
+    if (_serialized_chunk_id != _chunk_id) _serialize_chunk_columns();
+
+    const auto chunk_size = _table.get_chunk(_chunk_id)->size();
+    for (; _chunk_offset < chunk_size && _batch.size() < min_batch_size; ++_chunk_offset) {
+      // DataRow: Byte1('D'), Int32 length of the message including itself (but not the message type), Int16 number
+      // of columns, followed by the length and bytes of each value. A length of -1 denotes NULL.
+      auto message_size = sizeof(uint32_t) + sizeof(uint16_t);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& field_ends = _serialized_columns[column_id].field_ends;
+        message_size += field_ends[_chunk_offset] - (_chunk_offset == 0 ? 0 : field_ends[_chunk_offset - 1]);
+      }
+
+      _batch.push_back('D');
+      append_big_endian(_batch, static_cast<uint32_t>(message_size));
+      append_big_endian(_batch, static_cast<uint16_t>(column_count));
+
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        const auto& serialized_column = _serialized_columns[column_id];
+        const auto field_begin = _chunk_offset == 0 ? 0 : serialized_column.field_ends[_chunk_offset - 1];
+        const auto field_end = serialized_column.field_ends[_chunk_offset];
+        _batch.insert(_batch.end(), serialized_column.fields.begin() + field_begin,
+                      serialized_column.fields.begin() + field_end);
+      }
+    }
+
+    if (_chunk_offset == chunk_size) {
+      ++_chunk_id;
+      _chunk_offset = 0;
+    }
+  }
+
+  return _batch;
+}
+
+const ByteBuffer& DataRowSerializer::batch() const { return _batch; }
+
+void DataRowSerializer::_serialize_chunk_columns() {
+  const auto chunk = _table.get_chunk(_chunk_id);
+
+  for (auto column_id = ColumnID{0}; column_id < _table.column_count(); ++column_id) {
+    auto& serialized_column = _serialized_columns[column_id];
+    serialized_column.fields.clear();
+    serialized_column.field_ends.clear();
+    serialized_column.field_ends.reserve(chunk->size());
+
+    const auto& segment = *chunk->get_segment(column_id);
+    const auto result_format = _result_formats[column_id];
+
+    resolve_data_type(_table.column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        if (position.is_null()) {
+          append_big_endian(serialized_column.fields, static_cast<uint32_t>(-1));
+        } else if (result_format == ResultFormat::Binary) {
+          append_binary_field(serialized_column.fields, position.value());
+        } else {
+          append_text_field(serialized_column.fields, position.value());
+        }
+        serialized_column.field_ends.emplace_back(serialized_column.fields.size());
+      });
+    });
+  }
+
+  _serialized_chunk_id = _chunk_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+
+#include "server/types.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+using ByteBuffer = std::vector<char>;
+
+/**
+ * Serializes the rows of a table into DataRow messages of the PostgreSQL wire protocol, in batches of many rows.
+ *
+ * Each chunk is serialized column by column: the values of a segment are iterated without going through
+ * AllTypeVariant and written, including their length prefix, into a buffer for the column. The DataRow messages are
+ * then assembled by copying the serialized values of each row from these buffers. All buffers are reused across chunks
+ * and batches.
+ *
+ * Numeric values are sent in the text or binary format, depending on the column's ResultFormat. Strings are sent as
+ * they are, which is their representation in both formats. NULL values are sent with a length of -1.
+ */
+class DataRowSerializer final {
+ public:
+  // @param result_formats    as in the Bind message, i.e., empty (all columns as text), one format for all columns, or
+  //                          one format per column
+  explicit DataRowSerializer(const Table& table, const std::vector<ResultFormat>& result_formats = {});
+
+  // @return one format per column for the formats requested in a Bind message (see above)
+  static std::vector<ResultFormat> resolve_result_formats(const std::vector<ResultFormat>& result_formats,
+                                                          const size_t column_count);
+
+  /**
+   * Serializes the next rows into a buffer until it holds at least @param min_batch_size bytes or all rows were
+   * serialized. The buffer is overwritten by the next call. An empty buffer is returned once all rows were serialized.
+   */
+  const ByteBuffer& serialize_next_batch(const size_t min_batch_size);
+
+  // @return the batch serialized by the last call of serialize_next_batch()
+  const ByteBuffer& batch() const;
+
+ private:
+  void _serialize_chunk_columns();
+
+  const Table& _table;
+  const std::vector<ResultFormat> _result_formats;
+
+  ChunkID _chunk_id{0};
+  ChunkOffset _chunk_offset{0};
+  ChunkID _serialized_chunk_id{INVALID_CHUNK_ID};
+
+  // The serialized value (i.e., length and bytes) of row i of the current chunk is stored in
+  // fields[field_ends[i - 1], field_ends[i])
+  struct SerializedColumn {
+    ByteBuffer fields;
+    std::vector<size_t> field_ends;
+  };
+  std::vector<SerializedColumn> _serialized_columns;
+
+  ByteBuffer _batch;
+};
+
+}  // namespace opossum
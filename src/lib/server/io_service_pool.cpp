@@ -0,0 +1,42 @@
+#include "io_service_pool.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+namespace opossum {
+
+IoServicePool::IoServicePool(size_t size) {
+  if (size == 0) size = std::max(std::thread::hardware_concurrency(), 1u);
+
+  _io_services.reserve(size);
+  _works.reserve(size);
+  _threads.reserve(size);
+
+  for (auto io_service_idx = size_t{0}; io_service_idx < size; ++io_service_idx) {
+    _io_services.emplace_back(std::make_unique<boost::asio::io_service>());
+    _works.emplace_back(std::make_unique<boost::asio::io_service::work>(*_io_services.back()));
+  }
+
+  for (const auto& io_service : _io_services) {
+    _threads.emplace_back([&io_service = *io_service]() { io_service.run(); });
+  }
+}
+
+IoServicePool::~IoServicePool() {
+  for (const auto& io_service : _io_services) {
+    io_service->stop();
+  }
+
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+boost::asio::io_service& IoServicePool::next_io_service() {
+  return *_io_services[_next_io_service_idx++ % _io_services.size()];
+}
+
+size_t IoServicePool::size() const { return _io_services.size(); }
+
+}  // namespace opossum
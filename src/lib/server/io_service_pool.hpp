@@ -0,0 +1,44 @@
+#pragma once
+
+#include <boost/asio/io_service.hpp>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * A pool of io_services, each of which is run by its own thread. The server distributes its connections across the
+ * io_services in a round-robin fashion, so that parsing requests and socket I/O of different sessions happen in
+ * parallel. As each io_service is run by a single thread, the handlers of a session are never executed concurrently
+ * and the sessions do not need any synchronization.
+ */
+class IoServicePool final {
+ public:
+  // Starts one thread per io_service. A @param size of 0 creates one io_service per core.
+  explicit IoServicePool(size_t size = 0);
+
+  // Stops all io_services and waits for their threads to finish
+  ~IoServicePool();
+
+  IoServicePool(const IoServicePool&) = delete;
+  IoServicePool& operator=(const IoServicePool&) = delete;
+
+  // Thread-safe
+  boost::asio::io_service& next_io_service();
+
+  size_t size() const;
+
+ private:
+  std::vector<std::unique_ptr<boost::asio::io_service>> _io_services;
+
+  // Keeps the io_services running even if they have no connections
+  std::vector<std::unique_ptr<boost::asio::io_service::work>> _works;
+
+  std::vector<std::thread> _threads;
+  std::atomic<size_t> _next_io_service_idx{0};
+};
+
+}  // namespace opossum
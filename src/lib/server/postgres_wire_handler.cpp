@@ -1,7 +1,9 @@
 #include "postgres_wire_handler.hpp"
 
+#include <cstring>
 #include <iostream>
 #include <iterator>
+#include <type_traits>
 
 #include "sql/sql_pipeline.hpp"
 #include "types.hpp"
@@ -9,7 +11,7 @@
 
 namespace opossum {
 
-uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
+StartupPacketHeader PostgresWireHandler::handle_startup_package(const InputPacket& packet) {
   auto network_length = read_value<uint32_t>(packet);
   // We ALWAYS need to convert from network endianess to host endianess with these fancy macros
   // ntohl = network to host long and htonl = host to network long (where long = uint32)
@@ -23,18 +25,36 @@ uint32_t PostgresWireHandler::handle_startup_package(const InputPacket& packet)
   // Reset data buffer
   packet.offset = packet.data.cbegin();
 
-  // Special SSL version number that we catch to deny SSL support
+  // Subtract read bytes from total length
+  const auto payload_length = static_cast<uint32_t>(length - (2 * sizeof(uint32_t)));
+
+  // Special version numbers that we catch to deny SSL support and to cancel queries, respectively
   if (version == 80877103) {
-    return 0;
+    return {StartupRequestType::SslRequest, 0};
+  } else if (version == 80877102) {
+    return {StartupRequestType::CancelRequest, payload_length};
   } else {
-    // Subtract read bytes from total length
-    return length - (2 * sizeof(uint32_t));
+    return {StartupRequestType::Startup, payload_length};
   }
 }
 
-void PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
-  // Ignore the content, because we don't care about the variables that were passed in.
-  read_values<char>(packet, packet.data.size());
+StartupParameters PostgresWireHandler::handle_startup_package_content(const InputPacket& packet) {
+  // The parameters are pairs of names and values, terminated by an empty name
+  auto parameters = StartupParameters{};
+  while (packet.offset != packet.data.cend()) {
+    auto name = read_string(packet);
+    if (name.empty()) break;
+
+    parameters[name] = read_string(packet);
+  }
+
+  return parameters;
+}
+
+BackendKey PostgresWireHandler::handle_cancel_request_packet(const InputPacket& packet) {
+  const auto process_id = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+  const auto secret_key = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+  return {process_id, secret_key};
 }
 
 RequestHeader PostgresWireHandler::handle_header(const InputPacket& packet) {
@@ -56,11 +76,14 @@ ParsePacket PostgresWireHandler::handle_parse_packet(const InputPacket& packet)
 
   auto query = read_string(packet);
 
-  auto network_parameter_data_types = read_value<uint16_t>(packet);
+  auto num_parameter_data_types = ntohs(read_value<uint16_t>(packet));
 
-  /*auto parameter_data_types = */ read_values<uint32_t>(packet, network_parameter_data_types);
+  auto parameter_type_oids = read_values<uint32_t>(packet, num_parameter_data_types);
+  for (auto& parameter_type_oid : parameter_type_oids) {
+    parameter_type_oid = ntohl(parameter_type_oid);
+  }
 
-  return ParsePacket{std::move(statement_name), std::move(query)};
+  return ParsePacket{std::move(statement_name), std::move(query), std::move(parameter_type_oids)};
 }
 
 BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
@@ -74,18 +97,93 @@ BindPacket PostgresWireHandler::handle_bind_packet(const InputPacket& packet) {
 
   auto num_parameter_values = ntohs(read_value<int16_t>(packet));
 
-  std::vector<AllTypeVariant> parameter_values;
+  std::vector<std::optional<ByteBuffer>> parameter_values;
   for (auto i = 0; i < num_parameter_values; ++i) {
-    auto parameter_value_length = ntohl(read_value<int32_t>(packet));
-    auto x = read_values<char>(packet, parameter_value_length);
-    const std::string x_str(x.begin(), x.end());
-    parameter_values.emplace_back(x_str);
+    auto parameter_value_length = static_cast<int32_t>(ntohl(read_value<uint32_t>(packet)));
+
+    // A length of -1 denotes NULL
+    if (parameter_value_length == -1) {
+      parameter_values.emplace_back(std::nullopt);
+      continue;
+    }
+
+    parameter_values.emplace_back(read_values<char>(packet, parameter_value_length));
+  }
+
+  // Like the result formats, the parameter formats are either omitted (all text), given once for all parameters, or
+  // given for each parameter
+  std::vector<ResultFormat> parameter_formats(num_parameter_values, ResultFormat::Text);
+  if (!format_codes.empty()) {
+    Assert(format_codes.size() == 1 || format_codes.size() == parameter_formats.size(),
+           "Expected a format code for each parameter");
+    for (auto parameter_idx = size_t{0}; parameter_idx < parameter_formats.size(); ++parameter_idx) {
+      const auto format_code = static_cast<int16_t>(ntohs(format_codes[format_codes.size() == 1 ? 0 : parameter_idx]));
+      Assert(format_code == 0 || format_code == 1, "Unknown parameter format code");
+      parameter_formats[parameter_idx] = static_cast<ResultFormat>(format_code);
+    }
   }
 
   auto num_result_column_format_codes = ntohs(read_value<int16_t>(packet));
   auto result_column_format_codes = read_values<int16_t>(packet, num_result_column_format_codes);
 
-  return BindPacket{statement_name, portal, std::move(parameter_values)};
+  std::vector<ResultFormat> result_formats;
+  for (const auto network_format_code : result_column_format_codes) {
+    const auto format_code = static_cast<int16_t>(ntohs(network_format_code));
+    Assert(format_code == 0 || format_code == 1, "Unknown result format code");
+    result_formats.emplace_back(static_cast<ResultFormat>(format_code));
+  }
+
+  return BindPacket{statement_name, portal, std::move(parameter_values), std::move(parameter_formats),
+                    std::move(result_formats)};
+}
+
+AllTypeVariant PostgresWireHandler::decode_parameter(const std::optional<ByteBuffer>& value, const ResultFormat format,
+                                                     const uint32_t type_oid) {
+  if (!value) return NULL_VALUE;
+
+  if (format == ResultFormat::Text) {
+    const auto text = std::string{value->begin(), value->end()};
+    switch (type_oid) {
+      case 20:  // int8
+        return static_cast<int64_t>(std::stoll(text));
+      case 23:  // int4
+        return static_cast<int32_t>(std::stoi(text));
+      case 700:  // float4
+        return std::stof(text);
+      case 701:  // float8
+        return std::stod(text);
+      default:
+        // Unspecified types and text types
+        return text;
+    }
+  }
+
+  // Binary values are sent in network byte order (big endian)
+  const auto read_big_endian = [&](auto result) {
+    Assert(value->size() == sizeof(result), "Unexpected size of binary parameter");
+    auto bits = std::conditional_t<sizeof(result) == 4, uint32_t, uint64_t>{0};
+    for (const auto byte : *value) {
+      bits = (bits << 8) | static_cast<uint8_t>(byte);
+    }
+    std::memcpy(&result, &bits, sizeof(result));
+    return result;
+  };
+
+  switch (type_oid) {
+    case 20:  // int8
+      return read_big_endian(int64_t{});
+    case 23:  // int4
+      return read_big_endian(int32_t{});
+    case 700:  // float4
+      return read_big_endian(float{});
+    case 701:  // float8
+      return read_big_endian(double{});
+    case 25:    // text
+    case 1043:  // varchar
+      return std::string{value->begin(), value->end()};
+    default:
+      Fail("Binary parameters must be of a supported type (int4, int8, float4, float8, text, varchar)");
+  }
 }
 
 std::string PostgresWireHandler::handle_execute_packet(const InputPacket& packet) {
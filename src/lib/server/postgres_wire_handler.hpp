@@ -2,7 +2,9 @@
 
 #include <arpa/inet.h>
 #include <algorithm>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "SQLParserResult.h"
@@ -29,6 +31,24 @@ struct OutputPacket {
   ByteBuffer data;
 };
 
+// The first packet on a connection either starts a session, asks for SSL, or cancels the query of another session
+enum class StartupRequestType { Startup, SslRequest, CancelRequest };
+
+struct StartupPacketHeader {
+  StartupRequestType request_type;
+  uint32_t payload_length;
+};
+
+// The parameters of a Startup packet (e.g., user or statement_timeout), by name
+using StartupParameters = std::unordered_map<std::string, std::string>;
+
+// Identifies a session. The server sends it in the BackendKeyData message, clients use it to cancel the session's
+// current query with a CancelRequest on a new connection.
+struct BackendKey {
+  int32_t process_id;
+  int32_t secret_key;
+};
+
 struct RequestHeader {
   NetworkMessageType message_type;
   uint32_t payload_length;
@@ -37,12 +57,23 @@ struct RequestHeader {
 struct ParsePacket {
   std::string statement_name;
   std::string query;
+
+  // Type OIDs of the parameters as specified by the client. May be fewer than the statement's parameters, 0 denotes an
+  // unspecified type.
+  std::vector<uint32_t> parameter_type_oids;
 };
 
 struct BindPacket {
   std::string statement_name;
   std::string destination_portal;
-  std::vector<AllTypeVariant> params;
+
+  // The raw parameter values (std::nullopt for NULL) and their formats, one per parameter. The values are decoded
+  // using decode_parameter() once the types of the statement's parameters are known.
+  std::vector<std::optional<ByteBuffer>> params;
+  std::vector<ResultFormat> parameter_formats;
+
+  // Formats of the result columns: either none (all text), one for all columns, or one per column
+  std::vector<ResultFormat> result_formats;
 };
 
 class PostgresWireHandler {
@@ -50,14 +81,20 @@ class PostgresWireHandler {
   static std::shared_ptr<OutputPacket> new_output_packet(NetworkMessageType type);
   static void write_output_packet_size(OutputPacket& packet);
 
-  static uint32_t handle_startup_package(const InputPacket& packet);
-  static void handle_startup_package_content(const InputPacket& packet);
+  static StartupPacketHeader handle_startup_package(const InputPacket& packet);
+  static StartupParameters handle_startup_package_content(const InputPacket& packet);
+  static BackendKey handle_cancel_request_packet(const InputPacket& packet);
 
   static RequestHeader handle_header(const InputPacket& packet);
 
   static std::string handle_query_packet(const InputPacket& packet);
   static ParsePacket handle_parse_packet(const InputPacket& packet);
   static BindPacket handle_bind_packet(const InputPacket& packet);
+
+  // Decodes a parameter of a Bind message. Text values of unspecified types (OID 0) are decoded as strings, binary
+  // values require a type.
+  static AllTypeVariant decode_parameter(const std::optional<ByteBuffer>& value, const ResultFormat format,
+                                         const uint32_t type_oid);
   static std::string handle_describe_packet(const InputPacket& packet);
   static std::string handle_execute_packet(const InputPacket& packet);
 
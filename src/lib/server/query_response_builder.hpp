@@ -3,6 +3,7 @@
 #include "sql/SQLStatement.h"
 
 #include "server/client_connection.hpp"
+#include "server/data_row_serializer.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -12,19 +13,14 @@ class SQLPipeline;
 
 class QueryResponseBuilder {
  public:
-  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table);
+  // @param result_formats    as in the Bind message, see DataRowSerializer
+  static std::vector<ColumnDescription> build_row_description(const std::shared_ptr<const Table>& table,
+                                                              const std::vector<ResultFormat>& result_formats = {});
   static std::string build_command_complete_message(const AbstractOperator& root_op, uint64_t row_count);
   static std::string build_execution_info_message(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
-  using send_row_t = std::function<boost::future<void>(const std::vector<std::string>&)>;
-
-  static boost::future<uint64_t> send_query_response(const send_row_t& send_row, const Table& table);
-
- protected:
-  static boost::future<void> _send_query_response_chunks(const send_row_t& send_row, const Table& table,
-                                                         ChunkID current_chunk_id);
-  static boost::future<void> _send_query_response_rows(const send_row_t& send_row, const Chunk& chunk,
-                                                       ChunkOffset current_chunk_offset);
+  // Minimum size of the batches of DataRow messages (see DataRowSerializer) that are sent to the client
+  static constexpr auto DATA_ROWS_BATCH_SIZE = size_t{256 * 1024};
 };
 
 }  // namespace opossum
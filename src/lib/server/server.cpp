@@ -3,6 +3,9 @@
 #include <boost/asio/placeholders.hpp>
 #include <boost/bind.hpp>
 
+#include <memory>
+#include <utility>
+
 #include "client_connection.hpp"
 #include "server_session.hpp"
 #include "task_runner.hpp"
@@ -12,24 +15,32 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
-Server::Server(boost::asio::io_service& io_service, uint16_t port)
+Server::Server(boost::asio::io_service& io_service, uint16_t port, std::shared_ptr<IoServicePool> io_service_pool,
+               const size_t max_in_flight_chunks)
     : _io_service(io_service),
-      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)),
-      _socket(io_service) {
+      _io_service_pool(std::move(io_service_pool)),
+      _max_in_flight_chunks(max_in_flight_chunks),
+      _acceptor(io_service, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)) {
   _accept_next_connection();
 }
 
 void Server::_accept_next_connection() {
-  _acceptor.async_accept(_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
+  // The acceptor may accept a connection into a socket that belongs to another io_service. All further handlers of the
+  // connection are then executed by that io_service.
+  _session_io_service = _io_service_pool ? &_io_service_pool->next_io_service() : &_io_service;
+  _socket = std::make_unique<boost::asio::ip::tcp::socket>(*_session_io_service);
+  _acceptor.async_accept(*_socket, boost::bind(&Server::_start_session, this, boost::asio::placeholders::error));
 }
 
 void Server::_start_session(boost::system::error_code error) {
   if (!error) {
-    auto connection = std::make_shared<ClientConnection>(std::move(_socket));
-    auto task_runner = std::make_shared<TaskRunner>(_io_service);
-    auto session = std::make_shared<ServerSession>(connection, task_runner);
-    // Start the session and release it once it has terminated
-    session->start() >> then >> [=]() mutable { session.reset(); };
+    // The results of the tasks dispatched by the session are handed back to the io_service of its connection
+    auto connection = std::make_shared<ClientConnection>(std::move(*_socket));
+    auto task_runner = std::make_shared<TaskRunner>(*_session_io_service);
+    auto session = std::make_shared<ServerSession>(connection, task_runner, _max_in_flight_chunks);
+    // Start the session on the io_service of its connection, so that the session is only ever accessed by the thread
+    // running that io_service. Release the session once it has terminated.
+    _session_io_service->post([session]() { session->start() >> then >> [=]() mutable { session.reset(); }; });
   }
 
   _accept_next_connection();
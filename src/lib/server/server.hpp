@@ -3,13 +3,20 @@
 #include <boost/asio/io_service.hpp>
 #include <boost/asio/ip/tcp.hpp>
 
+#include <memory>
+
+#include "io_service_pool.hpp"
 #include "server_session.hpp"
 
 namespace opossum {
 
 class Server {
  public:
-  Server(boost::asio::io_service& io_service, uint16_t port);
+  // Connections are accepted on the given io_service. If @param io_service_pool is set, each session runs on the next
+  // io_service of the pool. Otherwise, all sessions run on the given io_service. @param max_in_flight_chunks limits the
+  // number of result chunks each session produces ahead of its client.
+  Server(boost::asio::io_service& io_service, uint16_t port, std::shared_ptr<IoServicePool> io_service_pool = nullptr,
+         const size_t max_in_flight_chunks = ResultChunkStream::DEFAULT_MAX_IN_FLIGHT_CHUNKS);
 
   uint16_t get_port_number();
 
@@ -18,8 +25,13 @@ class Server {
   void _start_session(boost::system::error_code error);
 
   boost::asio::io_service& _io_service;
+  const std::shared_ptr<IoServicePool> _io_service_pool;
+  const size_t _max_in_flight_chunks;
   boost::asio::ip::tcp::acceptor _acceptor;
-  boost::asio::ip::tcp::socket _socket;
+
+  // The socket of the next connection is created on the io_service that the connection's session will run on
+  boost::asio::io_service* _session_io_service{nullptr};
+  std::unique_ptr<boost::asio::ip::tcp::socket> _socket;
 };
 
 }  // namespace opossum
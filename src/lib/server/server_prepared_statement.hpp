@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+namespace opossum {
+
+class ParameterizedPlan;
+class PreparedPlan;
+
+/**
+ * A statement prepared by a Parse message of the extended query protocol. Statements belong to the session that
+ * created them.
+ *
+ * The first Bind message optimizes the statement for its parameters and keeps the result as a ParameterizedPlan. Later
+ * Bind messages instantiate this plan with their parameters (i.e., copy the PQP and set the parameters), without
+ * translating or optimizing the statement again, as long as the plan covers the parameters (see
+ * ParameterizedPlan::covers()).
+ */
+struct ServerPreparedStatement {
+  ServerPreparedStatement(const std::shared_ptr<PreparedPlan>& prepared_plan,
+                          const std::vector<uint32_t>& parameter_type_oids)
+      : prepared_plan(prepared_plan), parameter_type_oids(parameter_type_oids) {}
+
+  std::shared_ptr<PreparedPlan> prepared_plan;
+
+  // See ParsePacket::parameter_type_oids
+  std::vector<uint32_t> parameter_type_oids;
+
+  // Set by the first Bind. nullptr if the statement cannot be parameterized.
+  std::shared_ptr<ParameterizedPlan> parameterized_plan;
+  bool is_parameterized{false};
+};
+
+}  // namespace opossum
@@ -1,28 +1,37 @@
 #include "server_session.hpp"
 
 #include <boost/algorithm/string/predicate.hpp>
+#include <boost/algorithm/string/trim.hpp>
 #include <boost/asio/placeholders.hpp>
 #include <boost/asio/write.hpp>
 #include <boost/bind.hpp>
 
 #include <chrono>
+#include <cmath>
 #include <iostream>
+#include <string>
 #include <thread>
+#include <unordered_map>
 
 #include "SQLParserResult.h"
 
 #include "concurrency/transaction_manager.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "sql/sql_translator.hpp"
-#include "storage/storage_manager.hpp"
+#include "storage/prepared_plan.hpp"
 #include "tasks/server/bind_server_prepared_statement_task.hpp"
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/fetch_server_result_chunks_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
+#include "tasks/server/serialize_server_data_rows_task.hpp"
 
+#include "cancellation_registry.hpp"
 #include "client_connection.hpp"
+#include "data_row_serializer.hpp"
 #include "query_response_builder.hpp"
 #include "then_operator.hpp"
 #include "types.hpp"
@@ -34,34 +43,94 @@ namespace opossum {
 
 using opossum::then_operator::then;
 
+namespace {
+
+// Parses a value of statement_timeout like PostgreSQL does: a number of milliseconds, optionally followed by one of the
+// units us, ms, s, min, h, or d
+std::chrono::milliseconds parse_statement_timeout(const std::string& value) {
+  auto unit_begin = size_t{0};
+  const auto amount = std::stod(value, &unit_begin);
+  Assert(amount >= 0, "statement_timeout must not be negative");
+
+  static const auto milliseconds_per_unit = std::unordered_map<std::string, double>{
+      {"", 1.0}, {"us", 0.001}, {"ms", 1.0}, {"s", 1'000.0}, {"min", 60'000.0}, {"h", 3'600'000.0},
+      {"d", 86'400'000.0}};
+  const auto unit = boost::algorithm::trim_copy(value.substr(unit_begin));
+  const auto unit_iter = milliseconds_per_unit.find(unit);
+  Assert(unit_iter != milliseconds_per_unit.end(),
+         "Invalid unit '" + unit + "' of statement_timeout, valid units are us, ms, s, min, h, and d");
+
+  return std::chrono::milliseconds{std::llround(amount * unit_iter->second)};
+}
+
+}  // namespace
+
+std::chrono::milliseconds statement_timeout_from(const StartupParameters& startup_parameters) {
+  const auto timeout_iter = startup_parameters.find("statement_timeout");
+  if (timeout_iter != startup_parameters.end()) return parse_statement_timeout(timeout_iter->second);
+
+  const auto options_iter = startup_parameters.find("options");
+  if (options_iter == startup_parameters.end()) return std::chrono::milliseconds{0};
+
+  const auto& options = options_iter->second;
+  const auto option = std::string{"statement_timeout="};
+  const auto option_begin = options.find(option);
+  if (option_begin == std::string::npos) return std::chrono::milliseconds{0};
+
+  // The options are separated by whitespace, e.g., "-c statement_timeout=5s -c search_path=public"
+  const auto value_begin = option_begin + option.size();
+  const auto value_end = options.find_first_of(" \t", value_begin);
+  return parse_statement_timeout(options.substr(value_begin, value_end - value_begin));
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::start() {
   // We need a copy of this session to outlive the async operation
   auto self = this->shared_from_this();
-  return (_perform_session_startup() >> then >> [this, self]() { return _handle_client_requests(); })
+  return (_perform_session_startup() >> then >>
+          [this, self]() {
+            // A CancelRequest is the only packet sent on its connection
+            if (!_backend_key) return boost::make_ready_future();
+            return _handle_client_requests();
+          })
       // Use .then instead of >> then >> to be able to handle exceptions
-      .then(boost::launch::sync, [self](boost::future<void> f) {
+      .then(boost::launch::sync, [this, self](boost::future<void> f) {
         try {
           f.get();
         } catch (const std::exception& e) {
           std::cerr << e.what() << std::endl;
         }
+
+        if (_backend_key) CancellationRegistry::get().unregister_session(_backend_key->process_id);
       });
 }
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_perform_session_startup() {
-  return _connection->receive_startup_packet_header() >> then >> [=](uint32_t startup_packet_length) {
-    if (startup_packet_length == 0) {
+  return _connection->receive_startup_packet_header() >> then >> [=](StartupPacketHeader startup_packet_header) {
+    if (startup_packet_header.request_type == StartupRequestType::SslRequest) {
       // This is a request for SSL, deny it and wait for the next startup packet
       return _connection->send_ssl_denied() >> then >> [=]() { return _perform_session_startup(); };
     }
 
-    return _connection->receive_startup_packet_body(startup_packet_length) >> then >>
-           [=]() { return _connection->send_auth(); } >> then >>
+    if (startup_packet_header.request_type == StartupRequestType::CancelRequest) {
+      // The server does not respond to CancelRequests, the client learns about the cancellation from the session
+      // executing the query
+      return _connection->receive_cancel_request_body(startup_packet_header.payload_length) >> then >>
+             [](BackendKey backend_key) { CancellationRegistry::get().cancel_current_query(backend_key); };
+    }
+
+    return _connection->receive_startup_packet_body(startup_packet_header.payload_length) >> then >>
+           [=](StartupParameters startup_parameters) {
+             _statement_timeout = statement_timeout_from(startup_parameters);
+             _backend_key = CancellationRegistry::get().register_session();
+             return _connection->send_auth();
+           } >>
+           then >>
            // We need to provide some random server version > 9 here, because some clients require it.
            [=]() { return _connection->send_parameter_status("server_version", "9.5"); } >> then >>
            [=]() { return _connection->send_parameter_status("client_encoding", "UTF8"); } >> then >>
+           [=]() { return _connection->send_backend_key_data(*_backend_key); } >> then >>
            [=]() { return _connection->send_ready_for_query(); };
   };
 }
@@ -147,18 +216,29 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_client_
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_query_response(
     const std::shared_ptr<SQLPipeline>& sql_pipeline) {
-  auto result_table = sql_pipeline->get_result_table();
-
   auto send_row_data = [=]() {
-    // If there is no result table, e.g. after an INSERT command, we cannot send row data
+    // The result of a single statement is sent while it is being produced
+    if (sql_pipeline->statement_count() == 1) {
+      const auto result_stream = sql_pipeline->get_result_stream(_max_in_flight_chunks);
+      auto task = std::make_shared<FetchServerResultChunksTask>(result_stream);
+      return _task_runner->dispatch_server_task(task) >> then >> [=](std::shared_ptr<const Table> result_part) {
+        // If there is no result table, e.g. after an INSERT command, we cannot send row data
+        if (!result_part) return boost::make_ready_future<uint64_t>(0);
+
+        auto row_description = QueryResponseBuilder::build_row_description(result_part);
+
+        return _connection->send_row_description(row_description) >> then >>
+               [=]() { return _send_result_stream(result_stream, result_part, 0); };
+      };
+    }
+
+    auto result_table = sql_pipeline->get_result_table();
     if (!result_table) return boost::make_ready_future<uint64_t>(0);
 
-    auto row_description = QueryResponseBuilder::build_row_description(sql_pipeline->get_result_table());
+    auto row_description = QueryResponseBuilder::build_row_description(result_table);
 
-    return _connection->send_row_description(row_description) >> then >> [=]() {
-      return QueryResponseBuilder::send_query_response(
-          [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-    };
+    return _connection->send_row_description(row_description) >> then >>
+           [=]() { return _send_data_rows(result_table); };
   };
 
   auto send_command_complete = [=](uint64_t row_count) {
@@ -173,10 +253,61 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_simple_qu
   };
 }
 
+template <typename TConnection, typename TTaskRunner>
+boost::future<uint64_t> ServerSessionImpl<TConnection, TTaskRunner>::_send_result_stream(
+    const std::shared_ptr<ResultChunkStream>& result_stream, const std::shared_ptr<const Table>& result_part,
+    const uint64_t sent_row_count) {
+  // The next part is only requested once the previous one was sent, so that the stream does not produce more than its
+  // in-flight chunks ahead of a slow client
+  return _send_data_rows(result_part) >> then >> [=](uint64_t row_count) {
+    auto task = std::make_shared<FetchServerResultChunksTask>(result_stream);
+    return _task_runner->dispatch_server_task(task) >> then >> [=](std::shared_ptr<const Table> next_result_part) {
+      if (!next_result_part) return boost::make_ready_future<uint64_t>(sent_row_count + row_count);
+      return _send_result_stream(result_stream, next_result_part, sent_row_count + row_count);
+    };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<uint64_t> ServerSessionImpl<TConnection, TTaskRunner>::_send_data_rows(
+    const std::shared_ptr<const Table>& result_table, const std::vector<ResultFormat>& result_formats) {
+  const auto data_row_serializer = std::make_shared<DataRowSerializer>(*result_table, result_formats);
+
+  // The continuation keeps the result table alive until all batches were sent
+  return _send_data_row_batches(data_row_serializer) >> then >>
+         [result_table]() { return static_cast<uint64_t>(result_table->row_count()); };
+}
+
+template <typename TConnection, typename TTaskRunner>
+boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_send_data_row_batches(
+    const std::shared_ptr<DataRowSerializer>& data_row_serializer) {
+  // The batches are serialized by the scheduler, so that the io_service can handle other sessions in the meantime. The
+  // next batch is only serialized once the previous one was sent, so that a slow client does not make the server
+  // buffer the entire result. Because of the asynchronous calls, we have to use recursion instead of a loop.
+  auto task = std::make_shared<SerializeServerDataRowsTask>(data_row_serializer,
+                                                            QueryResponseBuilder::DATA_ROWS_BATCH_SIZE);
+  return _task_runner->dispatch_server_task(task) >> then >> [=]() {
+    const auto& batch = data_row_serializer->batch();
+    if (batch.empty()) return boost::make_ready_future();
+
+    return _connection->send_data_rows(batch) >> then >>
+           [=]() { return _send_data_row_batches(data_row_serializer); };
+  };
+}
+
+template <typename TConnection, typename TTaskRunner>
+std::shared_ptr<CancellationToken> ServerSessionImpl<TConnection, TTaskRunner>::_create_cancellation_token() {
+  auto cancellation_token = std::make_shared<CancellationToken>();
+  if (_statement_timeout.count() > 0) cancellation_token->set_timeout(_statement_timeout);
+  if (_backend_key) CancellationRegistry::get().set_current_query(_backend_key->process_id, cancellation_token);
+  return cancellation_token;
+}
+
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_query_command(const std::string& sql) {
   auto create_sql_pipeline = [=]() {
-    return _task_runner->dispatch_server_task(std::make_shared<CreatePipelineTask>(sql, true));
+    auto task = std::make_shared<CreatePipelineTask>(sql, true, _create_cancellation_token());
+    return _task_runner->dispatch_server_task(task);
   };
 
   auto load_table_file = [=](std::string& file_name, std::string& table_name) {
@@ -186,12 +317,12 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_simple_
   };
 
   auto execute_sql_pipeline = [=](std::shared_ptr<SQLPipeline> sql_pipeline) {
-    auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline);
+    auto task = std::make_shared<ExecuteServerQueryTask>(sql_pipeline, _max_in_flight_chunks);
     return _task_runner->dispatch_server_task(task) >> then >> [=]() { return sql_pipeline; };
   };
 
   // A simple query command invalidates unnamed statements and portals
-  if (StorageManager::get().has_prepared_plan("")) StorageManager::get().drop_prepared_plan("");
+  _prepared_statements.erase("");
   _portals.erase("");
 
   return create_sql_pipeline() >> then >> [=](std::unique_ptr<CreatePipelineResult> result) {
@@ -208,33 +339,44 @@ template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_parse_command(const ParsePacket& parse_info) {
   // Named prepared statements must be explicitly closed before they can be redefined by another Parse message
   // https://www.postgresql.org/docs/10/static/protocol-flow.html
-  if (StorageManager::get().has_prepared_plan(parse_info.statement_name)) {
+  if (_prepared_statements.count(parse_info.statement_name)) {
     // Not using Assert() since it includes file:line info that we don't want to hard code in tests
     if (!parse_info.statement_name.empty()) {
       Fail("Named prepared statements must be explicitly closed before they can be redefined.");
     }
-    StorageManager::get().drop_prepared_plan(parse_info.statement_name);
+    _prepared_statements.erase(parse_info.statement_name);
+  }
+
+  // Reuse the statement (and thus its optimized plan) if the same query was parsed before
+  if (_statement_cache.has(parse_info.query)) {
+    const auto prepared_statement = _statement_cache.get(parse_info.query);
+    if (prepared_statement->parameter_type_oids == parse_info.parameter_type_oids) {
+      _prepared_statements.emplace(parse_info.statement_name, prepared_statement);
+      return _connection->send_status_message(NetworkMessageType::ParseComplete);
+    }
   }
 
   auto task = std::make_shared<ParseServerPreparedStatementTask>(parse_info.query);
   return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::unique_ptr<PreparedPlan> prepared_plan) {
            // We know that SQLPipeline is set because the load table command is not allowed in this context
-           StorageManager::get().add_prepared_plan(parse_info.statement_name, std::move(prepared_plan));
+           const auto prepared_statement =
+               std::make_shared<ServerPreparedStatement>(std::move(prepared_plan), parse_info.parameter_type_oids);
+           _prepared_statements.emplace(parse_info.statement_name, prepared_statement);
+           _statement_cache.set(parse_info.query, prepared_statement);
          } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::ParseComplete); };
 }
 
 template <typename TConnection, typename TTaskRunner>
 boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_command(const BindPacket& packet) {
+  const auto prepared_statement_it = _prepared_statements.find(packet.statement_name);
   // Not using Assert() since it includes file:line info that we don't want to hard code in tests
-  if (!StorageManager::get().has_prepared_plan(packet.statement_name)) {
-    Fail("The specified statement does not exist.");
-  }
+  if (prepared_statement_it == _prepared_statements.end()) Fail("The specified statement does not exist.");
 
-  const auto prepared_plan = StorageManager::get().get_prepared_plan(packet.statement_name);
+  const auto prepared_statement = prepared_statement_it->second;
 
-  if (packet.statement_name.empty()) StorageManager::get().drop_prepared_plan(packet.statement_name);
+  if (packet.statement_name.empty()) _prepared_statements.erase(prepared_statement_it);
 
   auto portal_name = packet.destination_portal;
 
@@ -248,9 +390,22 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_bind_co
     _portals.erase(portal_it);
   }
 
-  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_plan, packet.params);
+  // The parameters can only be decoded now that their types are known
+  DebugAssert(packet.parameter_formats.size() == packet.params.size(), "Expected a format for each parameter");
+  auto params = std::vector<AllTypeVariant>{};
+  params.reserve(packet.params.size());
+  for (auto parameter_idx = size_t{0}; parameter_idx < packet.params.size(); ++parameter_idx) {
+    const auto& parameter_type_oids = prepared_statement->parameter_type_oids;
+    const auto type_oid = parameter_idx < parameter_type_oids.size() ? parameter_type_oids[parameter_idx] : 0u;
+    params.emplace_back(PostgresWireHandler::decode_parameter(packet.params[parameter_idx],
+                                                              packet.parameter_formats[parameter_idx], type_oid));
+  }
+
+  auto task = std::make_shared<BindServerPreparedStatementTask>(prepared_statement, std::move(params));
   return _task_runner->dispatch_server_task(task) >> then >>
-         [=](std::shared_ptr<AbstractOperator> physical_plan) { _portals.emplace(portal_name, physical_plan); } >>
+         [=](std::shared_ptr<AbstractOperator> physical_plan) {
+           _portals.emplace(portal_name, Portal{physical_plan, packet.result_formats});
+         } >>
          then >> [=]() { return _connection->send_status_message(NetworkMessageType::BindComplete); };
 }
 
@@ -283,7 +438,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
   auto portal_it = _portals.find(portal_name);
   Assert(portal_it != _portals.end(), "The specified portal does not exist.");
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_formats = portal_it->second.result_formats;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -291,8 +447,8 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
 
   physical_plan->set_transaction_context_recursively(_transaction);
 
-  return _task_runner->dispatch_server_task(std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan)) >>
-         then >>
+  auto task = std::make_shared<ExecuteServerPreparedStatementTask>(physical_plan, _create_cancellation_token());
+  return _task_runner->dispatch_server_task(task) >> then >>
          [=](std::shared_ptr<const Table> result_table) {
            // The behavior is a little different compared to SimpleQueryCommand: Send a 'No Data' response
            if (!result_table) {
@@ -300,11 +456,9 @@ boost::future<void> ServerSessionImpl<TConnection, TTaskRunner>::_handle_execute
                     []() { return uint64_t(0); };
            }
 
-           const auto row_description = QueryResponseBuilder::build_row_description(result_table);
-           return _connection->send_row_description(row_description) >> then >> [=]() {
-             return QueryResponseBuilder::send_query_response(
-                 [=](const std::vector<std::string>& row) { return _connection->send_data_row(row); }, *result_table);
-           };
+           const auto row_description = QueryResponseBuilder::build_row_description(result_table, result_formats);
+           return _connection->send_row_description(row_description) >> then >>
+                  [=]() { return _send_data_rows(result_table, result_formats); };
          } >>
          then >> [=](uint64_t row_count) {
            auto complete_message = QueryResponseBuilder::build_command_complete_message(*physical_plan, row_count);
@@ -4,21 +4,37 @@
 #include <boost/asio/ip/tcp.hpp>
 #include <boost/thread/future.hpp>
 
+#include <chrono>
 #include <memory>
+#include <optional>
 
+#include "cache/lru_cache.hpp"
 #include "client_connection.hpp"
 #include "postgres_wire_handler.hpp"
+#include "server_prepared_statement.hpp"
+#include "sql/result_chunk_stream.hpp"
 #include "sql/sql_pipeline.hpp"
 #include "task_runner.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+class CancellationToken;
+class DataRowSerializer;
+
+// Reads the statement timeout, given either as a parameter of its own or, as sent by libpq for
+// PGOPTIONS="-c statement_timeout=5s", as an option. Like in PostgreSQL, the value is a number of milliseconds that
+// may be followed by one of the units us, ms, s, min, h, or d. Returns 0 (i.e., no timeout) if none is given.
+std::chrono::milliseconds statement_timeout_from(const StartupParameters& startup_parameters);
+
 template <typename TConnection, typename TTaskRunner>
 class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<TConnection, TTaskRunner>> {
  public:
-  explicit ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner)
-      : _connection(connection), _task_runner(task_runner) {}
+  // The results of simple queries are streamed with at most @param max_in_flight_chunks chunks being produced ahead of
+  // the client (see ResultChunkStream)
+  ServerSessionImpl(std::shared_ptr<TConnection> connection, std::shared_ptr<TTaskRunner> task_runner,
+                    const size_t max_in_flight_chunks = ResultChunkStream::DEFAULT_MAX_IN_FLIGHT_CHUNKS)
+      : _connection(connection), _task_runner(task_runner), _max_in_flight_chunks(max_in_flight_chunks) {}
 
   boost::future<void> start();
 
@@ -36,12 +52,46 @@ class ServerSessionImpl : public std::enable_shared_from_this<ServerSessionImpl<
 
   boost::future<void> _send_simple_query_response(const std::shared_ptr<SQLPipeline>& sql_pipeline);
 
+  // Sends the parts of a streamed result, starting with @param result_part, and returns the number of rows sent
+  boost::future<uint64_t> _send_result_stream(const std::shared_ptr<ResultChunkStream>& result_stream,
+                                              const std::shared_ptr<const Table>& result_part,
+                                              const uint64_t sent_row_count);
+
+  // Sends the result table as DataRow messages and returns the number of rows sent
+  boost::future<uint64_t> _send_data_rows(const std::shared_ptr<const Table>& result_table,
+                                          const std::vector<ResultFormat>& result_formats = {});
+  boost::future<void> _send_data_row_batches(const std::shared_ptr<DataRowSerializer>& data_row_serializer);
+
+  // Creates the token of the next query, which can be cancelled by a CancelRequest and times out after the statement
+  // timeout
+  std::shared_ptr<CancellationToken> _create_cancellation_token();
+
   std::shared_ptr<TConnection> _connection;
   std::shared_ptr<TTaskRunner> _task_runner;
+  const size_t _max_in_flight_chunks;
 
   std::shared_ptr<TransactionContext> _transaction;
 
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+  // Not set for connections that only send a CancelRequest
+  std::optional<BackendKey> _backend_key;
+
+  // Set by the statement_timeout startup parameter, 0 means no timeout
+  std::chrono::milliseconds _statement_timeout{0};
+
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<ResultFormat> result_formats;
+  };
+
+  std::unordered_map<std::string, Portal> _portals;
+
+  // Statements created by Parse messages, by name
+  std::unordered_map<std::string, std::shared_ptr<ServerPreparedStatement>> _prepared_statements;
+
+  // Recently parsed statements, by query. Clients that do not name their statements (e.g., libpq's PQexecParams)
+  // send a Parse message for each execution, which thus neither translates nor optimizes the query again.
+  static constexpr auto STATEMENT_CACHE_CAPACITY = size_t{128};
+  LRUCache<std::string, std::shared_ptr<ServerPreparedStatement>> _statement_cache{STATEMENT_CACHE_CAPACITY};
 };
 
 // The corresponding template instantiation takes place in the .cpp
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 namespace opossum {
 
 enum class NetworkMessageType : unsigned char {
@@ -20,6 +22,7 @@ enum class NetworkMessageType : unsigned char {
   ReadyForQuery = 'Z',
   RowDescription = 'T',
   DataRow = 'D',
+  BackendKeyData = 'K',
 
   // Errors
   HumanReadableError = 'M',
@@ -42,6 +45,9 @@ enum class NetworkMessageType : unsigned char {
   Notice = 'N',
 };
 
+// Format of the values of a result column or a parameter, as given by the format codes of the Bind message
+enum class ResultFormat : int16_t { Text = 0, Binary = 1 };
+
 enum class TransactionStatusIndicator : unsigned char {
   Idle = 'I',
   InTransactionBlock = 'T',
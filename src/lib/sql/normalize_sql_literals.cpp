@@ -0,0 +1,145 @@
+#include "normalize_sql_literals.hpp"
+
+#include <cctype>
+#include <limits>
+#include <optional>
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_identifier_char(const char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_' || c == '$'; }
+
+bool is_digit(const char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+// @return the index of the first character after the number starting at @param begin
+size_t find_number_end(const std::string& sql, const size_t begin) {
+  auto end = begin;
+  while (end < sql.size() && is_digit(sql[end])) ++end;
+  if (end < sql.size() && sql[end] == '.') {
+    ++end;
+    while (end < sql.size() && is_digit(sql[end])) ++end;
+  }
+  if (end < sql.size() && (sql[end] == 'e' || sql[end] == 'E')) {
+    auto exponent_end = end + 1;
+    if (exponent_end < sql.size() && (sql[exponent_end] == '+' || sql[exponent_end] == '-')) ++exponent_end;
+    if (exponent_end < sql.size() && is_digit(sql[exponent_end])) {
+      end = exponent_end;
+      while (end < sql.size() && is_digit(sql[end])) ++end;
+    }
+  }
+  return end;
+}
+
+std::optional<AllTypeVariant> parse_number(const std::string& number) {
+  try {
+    if (number.find_first_of(".eE") != std::string::npos) return AllTypeVariant{std::stod(number)};
+
+    const auto value = std::stoll(number);
+    if (value >= std::numeric_limits<int32_t>::min() && value <= std::numeric_limits<int32_t>::max()) {
+      return AllTypeVariant{static_cast<int32_t>(value)};
+    }
+    return AllTypeVariant{static_cast<int64_t>(value)};
+  } catch (const std::out_of_range&) {
+    // Leave the literal in place, so that the SQLParser reports it
+    return std::nullopt;
+  }
+}
+
+// @return true if the last non-whitespace character before @param position is a minus
+bool is_preceded_by_minus(const std::string& sql, size_t position) {
+  while (position > 0 && std::isspace(static_cast<unsigned char>(sql[position - 1]))) --position;
+  return position > 0 && sql[position - 1] == '-';
+}
+
+}  // namespace
+
+namespace opossum {
+
+NormalizedSQL normalize_sql_literals(const std::string& sql) {
+  auto normalized_sql = NormalizedSQL{};
+  normalized_sql.sql.reserve(sql.size());
+
+  auto position = size_t{0};
+  while (position < sql.size()) {
+    const auto c = sql[position];
+    const auto next = position + 1 < sql.size() ? sql[position + 1] : '\0';
+
+    // Comments are copied as they are
+    if ((c == '-' && next == '-') || (c == '/' && next == '*')) {
+      const auto end = c == '-' ? sql.find('\n', position) : sql.find("*/", position + 2);
+      const auto comment_end = end == std::string::npos ? sql.size() : end + (c == '-' ? 0 : 2);
+      normalized_sql.sql.append(sql, position, comment_end - position);
+      position = comment_end;
+      continue;
+    }
+
+    // Identifiers and quoted identifiers, which may contain digits, are copied as they are
+    if (is_identifier_char(c) && !is_digit(c)) {
+      const auto begin = position;
+      while (position < sql.size() && is_identifier_char(sql[position])) ++position;
+      normalized_sql.sql.append(sql, begin, position - begin);
+      continue;
+    }
+
+    if (c == '"' || c == '`') {
+      const auto end = sql.find(c, position + 1);
+      const auto identifier_end = end == std::string::npos ? sql.size() : end + 1;
+      normalized_sql.sql.append(sql, position, identifier_end - position);
+      position = identifier_end;
+      continue;
+    }
+
+    if (c == '\'') {
+      // Two consecutive quotes within a string literal are an escaped quote
+      auto value = std::string{};
+      auto end = position + 1;
+      auto terminated = false;
+      while (end < sql.size()) {
+        if (sql[end] == '\'') {
+          if (end + 1 < sql.size() && sql[end + 1] == '\'') {
+            value += '\'';
+            end += 2;
+            continue;
+          }
+          terminated = true;
+          break;
+        }
+        value += sql[end++];
+      }
+
+      if (!terminated) {
+        normalized_sql.sql.append(sql, position, std::string::npos);
+        break;
+      }
+
+      normalized_sql.sql += '?';
+      normalized_sql.literals.emplace_back(std::move(value));
+      position = end + 1;
+      continue;
+    }
+
+    if (is_digit(c) || (c == '.' && is_digit(next) && (position == 0 || !is_identifier_char(sql[position - 1])))) {
+      const auto end = find_number_end(sql, position);
+      const auto number = sql.substr(position, end - position);
+
+      // Numbers followed by identifier characters (e.g., `1abc`) are left to the SQLParser
+      const auto value = end < sql.size() && is_identifier_char(sql[end]) ? std::nullopt : parse_number(number);
+      if (value && !is_preceded_by_minus(sql, position)) {
+        normalized_sql.sql += '?';
+        normalized_sql.literals.emplace_back(*value);
+      } else {
+        normalized_sql.sql += number;
+      }
+      position = end;
+      continue;
+    }
+
+    normalized_sql.sql += c;
+    ++position;
+  }
+
+  return normalized_sql;
+}
+
+}  // namespace opossum
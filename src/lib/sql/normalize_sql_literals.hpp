@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+struct NormalizedSQL {
+  // The SQL string with each literal replaced by a `?`
+  std::string sql;
+
+  // The replaced literals, in the order of their `?`s
+  std::vector<AllTypeVariant> literals;
+};
+
+/**
+ * Replaces the numeric and string literals in @param sql with `?`s, so that queries that differ only in their literals
+ * share a cache entry. Literals are typed like the SQLTranslator types them: integers as int32_t (or int64_t, if they
+ * do not fit), decimals as double, strings as std::string.
+ *
+ * This is a lexical pass that does not validate the SQL. It leaves identifiers (e.g., `t1`), quoted identifiers and
+ * comments untouched, as well as numbers directly preceded by a minus, since `-?` is not a literal for the translator.
+ */
+NormalizedSQL normalize_sql_literals(const std::string& sql);
+
+}  // namespace opossum
@@ -0,0 +1,192 @@
+#include "parameterized_plan.hpp"
+
+#include <algorithm>
+#include <string>
+#include <unordered_set>
+
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/placeholder_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "operators/abstract_operator.hpp"
+#include "resolve_type.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool is_parameterizable_predicate_condition(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool expression_contains_placeholder(const std::shared_ptr<AbstractExpression>& expression) {
+  auto contains_placeholder = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    contains_placeholder |= sub_expression->type == ExpressionType::Placeholder;
+    return contains_placeholder ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return contains_placeholder;
+}
+
+bool expression_uses_parameters(const std::shared_ptr<AbstractExpression>& expression,
+                                const std::unordered_set<ParameterID>& parameter_ids) {
+  auto uses_parameters = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (const auto parameter_expression = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression)) {
+      uses_parameters |= parameter_ids.count(parameter_expression->parameter_id) > 0;
+    }
+    return uses_parameters ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return uses_parameters;
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool ParameterizedPlan::parameterize_placeholders(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                  const std::vector<ParameterID>& parameter_ids,
+                                                  const std::vector<AllTypeVariant>& literals) {
+  Assert(parameter_ids.size() == literals.size(), "Expected one literal per placeholder");
+
+  auto parameters = std::unordered_map<ParameterID, std::shared_ptr<AbstractExpression>>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_ids.size(); ++parameter_idx) {
+    const auto data_type = data_type_from_all_type_variant(literals[parameter_idx]);
+    parameters.emplace(parameter_ids[parameter_idx],
+                       std::make_shared<CorrelatedParameterExpression>(
+                           parameter_ids[parameter_idx],
+                           CorrelatedParameterExpression::ReferencedExpressionInfo{data_type, "?"}));
+  }
+
+  auto all_placeholders_replaced = true;
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      for (auto& expression : node->node_expressions) {
+        if (node->type == LQPNodeType::Predicate) {
+          visit_expression(expression, [&](auto& sub_expression) {
+            const auto predicate_expression = std::dynamic_pointer_cast<AbstractPredicateExpression>(sub_expression);
+            if (!predicate_expression ||
+                !is_parameterizable_predicate_condition(predicate_expression->predicate_condition)) {
+              return ExpressionVisitation::VisitArguments;
+            }
+
+            for (auto& argument : predicate_expression->arguments) {
+              if (argument->type != ExpressionType::Placeholder) continue;
+              const auto parameter_id = static_cast<const PlaceholderExpression&>(*argument).parameter_id;
+              argument = parameters.at(parameter_id);
+            }
+            return ExpressionVisitation::VisitArguments;
+          });
+        }
+
+        all_placeholders_replaced &= !expression_contains_placeholder(expression);
+      }
+
+      return all_placeholders_replaced ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+    });
+  }
+
+  return all_placeholders_replaced;
+}
+
+ParameterizedPlan::ParameterizedPlan(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                     const std::shared_ptr<AbstractOperator>& pqp,
+                                     const std::vector<ParameterID>& parameter_ids,
+                                     const std::vector<AllTypeVariant>& literals)
+    : lqp(lqp), pqp(pqp), parameter_ids(parameter_ids) {
+  Assert(parameter_ids.size() == literals.size(), "Expected one literal per parameter");
+  for (const auto& literal : literals) {
+    _parameter_data_types.emplace_back(data_type_from_all_type_variant(literal));
+  }
+
+  const auto parameter_id_set = std::unordered_set<ParameterID>{parameter_ids.begin(), parameter_ids.end()};
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type != LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+      if (!expression_uses_parameters(predicate_node->predicate(), parameter_id_set)) return LQPVisitation::VisitInputs;
+
+      // Predicates the statistics cannot estimate do not restrict the reuse of the plan
+      auto operator_predicates =
+          OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node->left_input());
+      if (operator_predicates) {
+        _predicate_estimates.emplace_back(PredicateEstimate{predicate_node->left_input()->get_statistics(),
+                                                            std::move(*operator_predicates),
+                                                            predicate_node->get_statistics()->row_count()});
+      }
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+}
+
+bool ParameterizedPlan::covers(const std::vector<AllTypeVariant>& literals) const {
+  // The parameters' types are part of the plan, e.g., `a = 1` and `a = 1.5` are normalized to the same SQL string
+  Assert(literals.size() == _parameter_data_types.size(), "Expected one literal per parameter");
+  for (auto parameter_idx = size_t{0}; parameter_idx < literals.size(); ++parameter_idx) {
+    if (data_type_from_all_type_variant(literals[parameter_idx]) != _parameter_data_types[parameter_idx]) return false;
+  }
+
+  const auto parameters = _parameters(literals);
+
+  const auto bind = [&](const AllParameterVariant& value) -> AllParameterVariant {
+    if (!is_parameter_id(value)) return value;
+    const auto parameter_iter = parameters.find(boost::get<ParameterID>(value));
+    if (parameter_iter == parameters.end()) return value;
+    return parameter_iter->second;
+  };
+
+  for (const auto& predicate_estimate : _predicate_estimates) {
+    auto statistics = *predicate_estimate.input_statistics;
+    for (const auto& operator_predicate : predicate_estimate.operator_predicates) {
+      auto value2 = std::optional<AllParameterVariant>{};
+      if (operator_predicate.value2) value2 = bind(*operator_predicate.value2);
+      statistics = statistics.estimate_predicate(operator_predicate.column_id, operator_predicate.predicate_condition,
+                                                 bind(operator_predicate.value), value2);
+    }
+
+    const auto optimized_row_count = std::max(predicate_estimate.row_count, 1.0f);
+    const auto bound_row_count = std::max(statistics.row_count(), 1.0f);
+    const auto deviation = std::max(optimized_row_count / bound_row_count, bound_row_count / optimized_row_count);
+    if (deviation > MAX_ROW_COUNT_DEVIATION) return false;
+  }
+
+  return true;
+}
+
+std::shared_ptr<AbstractOperator> ParameterizedPlan::instantiate(const std::vector<AllTypeVariant>& literals) const {
+  const auto pqp_copy = pqp->deep_copy();
+  pqp_copy->set_parameters(_parameters(literals));
+  return pqp_copy;
+}
+
+std::unordered_map<ParameterID, AllTypeVariant> ParameterizedPlan::_parameters(
+    const std::vector<AllTypeVariant>& literals) const {
+  Assert(literals.size() == parameter_ids.size(), "Expected one literal per parameter");
+
+  auto parameters = std::unordered_map<ParameterID, AllTypeVariant>{};
+  for (auto parameter_idx = size_t{0}; parameter_idx < parameter_ids.size(); ++parameter_idx) {
+    parameters.emplace(parameter_ids[parameter_idx], literals[parameter_idx]);
+  }
+  return parameters;
+}
+
+}  // namespace opossum
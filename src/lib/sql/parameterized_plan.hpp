@@ -0,0 +1,82 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "operators/operator_scan_predicate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AbstractOperator;
+class TableStatistics;
+
+/**
+ * The plans of a SELECT statement whose literals were replaced by parameters (see normalize_sql_literals()). Stored in
+ * the SQLParameterizedPlanCache, so that queries that differ only in their literals are translated and optimized once.
+ *
+ * The plans are optimized without knowing the values of the parameters, i.e., based on the estimations for
+ * placeholders. A plan is only reused for values for which the estimated row counts of the parameterized predicates
+ * are close to those the plan was optimized for. Other values (e.g., those outside of a column's value range) might
+ * profit from a different plan, so the statement is optimized on its own instead.
+ */
+class ParameterizedPlan final {
+ public:
+  // Maximum factor by which a predicate's estimated row count may deviate for the plan to be reused
+  static constexpr auto MAX_ROW_COUNT_DEVIATION = 2.0f;
+
+  /**
+   * Replaces the PlaceholderExpressions in @param lqp with CorrelatedParameterExpressions of the types of
+   * @param literals, which are bound by AbstractOperator::set_parameters() when the plan is instantiated.
+   * @param parameter_ids are the ParameterIDs of the placeholders, in the order of the literals.
+   *
+   * @return false if a placeholder is not an operand of a comparison in a PredicateNode. The SQLTranslator would have
+   *         used the literal differently (e.g., to name a column or as a LIMIT), so such statements are not
+   *         parameterized.
+   */
+  static bool parameterize_placeholders(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                        const std::vector<ParameterID>& parameter_ids,
+                                        const std::vector<AllTypeVariant>& literals);
+
+  /**
+   * @param lqp   the optimized LQP, after parameterize_placeholders()
+   * @param pqp   the PQP translated from @param lqp
+   * @param literals  the literals of the statement the plan was created for, which determine the parameters' types
+   */
+  ParameterizedPlan(const std::shared_ptr<AbstractLQPNode>& lqp, const std::shared_ptr<AbstractOperator>& pqp,
+                    const std::vector<ParameterID>& parameter_ids, const std::vector<AllTypeVariant>& literals);
+
+  /**
+   * @return whether the plan is suitable for @param literals, i.e., whether they have the types of the parameters and
+   *         the estimated row counts of all parameterized predicates are within MAX_ROW_COUNT_DEVIATION of those the
+   *         plan was optimized for
+   */
+  bool covers(const std::vector<AllTypeVariant>& literals) const;
+
+  /**
+   * @return a copy of the PQP with @param literals bound to its parameters
+   */
+  std::shared_ptr<AbstractOperator> instantiate(const std::vector<AllTypeVariant>& literals) const;
+
+  const std::shared_ptr<AbstractLQPNode> lqp;
+  const std::shared_ptr<AbstractOperator> pqp;
+  const std::vector<ParameterID> parameter_ids;
+
+ private:
+  // A PredicateNode using parameters, with the statistics of its input, which are kept from the time of optimization
+  struct PredicateEstimate {
+    std::shared_ptr<TableStatistics> input_statistics;
+    std::vector<OperatorScanPredicate> operator_predicates;
+    float row_count;
+  };
+
+  std::unordered_map<ParameterID, AllTypeVariant> _parameters(const std::vector<AllTypeVariant>& literals) const;
+
+  std::vector<DataType> _parameter_data_types;
+  std::vector<PredicateEstimate> _predicate_estimates;
+};
+
+}  // namespace opossum
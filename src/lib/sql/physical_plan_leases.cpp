@@ -0,0 +1,80 @@
+#include "physical_plan_leases.hpp"
+
+#include "expression/expression_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+void clear_outputs_recursively(const std::shared_ptr<AbstractOperator>& op) {
+  if (!op) return;
+  op->clear_output();
+  clear_outputs_recursively(op->mutable_input_left());
+  clear_outputs_recursively(op->mutable_input_right());
+}
+
+}  // namespace
+
+namespace opossum {
+
+bool PhysicalPlanLeases::is_reusable(const AbstractOperator& plan) {
+  switch (plan.type()) {
+    case OperatorType::Alias:
+    case OperatorType::GetTable:
+    case OperatorType::JoinHash:
+    case OperatorType::Sort:
+    case OperatorType::Validate:
+      break;
+
+    case OperatorType::Limit:
+      if (expression_has_execution_state(static_cast<const Limit&>(plan).row_count_expression())) return false;
+      break;
+
+    case OperatorType::Projection:
+      for (const auto& expression : static_cast<const Projection&>(plan).expressions) {
+        if (expression_has_execution_state(expression)) return false;
+      }
+      break;
+
+    case OperatorType::TableScan:
+      if (expression_has_execution_state(static_cast<const TableScan&>(plan).predicate())) return false;
+      break;
+
+    default:
+      // Other operators either modify data or keep state from previous executions (e.g., Aggregate)
+      return false;
+  }
+
+  if (plan.input_left() && !is_reusable(*plan.input_left())) return false;
+  if (plan.input_right() && !is_reusable(*plan.input_right())) return false;
+  return true;
+}
+
+bool PhysicalPlanLeases::try_lease(const std::shared_ptr<AbstractOperator>& plan) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_leased_plans.emplace(plan).second) return false;
+  }
+
+  // The outputs of the previous execution are kept until the plan is executed again (e.g., for visualizing the PQP)
+  clear_outputs_recursively(plan);
+  return true;
+}
+
+void PhysicalPlanLeases::release(const std::shared_ptr<AbstractOperator>& plan) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const auto erased_count = _leased_plans.erase(plan);
+  Assert(erased_count == 1, "Plan was not leased");
+}
+
+bool PhysicalPlanLeases::is_leased(const std::shared_ptr<AbstractOperator>& plan) const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _leased_plans.count(plan) > 0;
+}
+
+}  // namespace opossum
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+
+/**
+ * Executing a PQP stores state in its operators (e.g., their outputs), so a plan from the SQLPhysicalPlanCache is
+ * usually deep_copy()d before it is executed. For reusable plans (see is_reusable()), this copy is avoided on most
+ * cache hits: The cached plan itself is leased to at most one SQLPipelineStatement at a time, which executes it and
+ * releases it once the statement is destroyed. Statements that find the plan leased copy it as before.
+ */
+class PhysicalPlanLeases : public Singleton<PhysicalPlanLeases> {
+ public:
+  // Returns true if @param plan can be executed repeatedly, i.e., if it is read-only, has no parameters or subqueries
+  // and consists only of operators that reset their state on each execution
+  static bool is_reusable(const AbstractOperator& plan);
+
+  // Leases @param plan to the caller and clears the outputs of its previous execution. Returns false if the plan is
+  // already leased.
+  bool try_lease(const std::shared_ptr<AbstractOperator>& plan);
+
+  // Makes @param plan available to the next try_lease()
+  void release(const std::shared_ptr<AbstractOperator>& plan);
+
+  bool is_leased(const std::shared_ptr<AbstractOperator>& plan) const;
+
+ protected:
+  friend class Singleton;
+
+  PhysicalPlanLeases() = default;
+
+  mutable std::mutex _mutex;
+  std::unordered_set<std::shared_ptr<AbstractOperator>> _leased_plans;
+};
+
+}  // namespace opossum
@@ -0,0 +1,229 @@
+#include "result_chunk_stream.hpp"
+
+#include <chrono>
+#include <memory>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "concurrency/transaction_context.hpp"
+#include "expression/evaluation/expression_evaluator.hpp"
+#include "expression/expression_functional.hpp"
+#include "expression/expression_utils.hpp"
+#include "operators/get_table.hpp"
+#include "operators/limit.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "scheduler/resource_group.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+bool contains_subquery(const std::shared_ptr<AbstractExpression>& expression) {
+  auto found_subquery = false;
+  visit_expression(expression, [&](const auto& sub_expression) {
+    if (sub_expression->type == ExpressionType::PQPSubquery) found_subquery = true;
+    return found_subquery ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+  });
+  return found_subquery;
+}
+
+// The GetTable at the bottom of a streamable PQP
+std::shared_ptr<GetTable> leaf_get_table(const std::shared_ptr<AbstractOperator>& root) {
+  auto op = root;
+  while (op->mutable_input_left()) op = op->mutable_input_left();
+  return std::static_pointer_cast<GetTable>(op);
+}
+
+}  // namespace
+
+namespace opossum {
+
+ResultChunkStream::ResultChunkStream(const std::shared_ptr<const AbstractOperator>& physical_plan,
+                                     const size_t max_in_flight_chunks,
+                                     const std::shared_ptr<TransactionContext>& transaction_context,
+                                     const bool auto_commit, const QueryClass query_class,
+                                     const std::shared_ptr<const CancellationToken>& cancellation_token,
+                                     const std::shared_ptr<SQLPipelineStatementMetrics>& metrics)
+    : _physical_plan(physical_plan),
+      _max_in_flight_chunks(max_in_flight_chunks),
+      _transaction_context(transaction_context),
+      _auto_commit(auto_commit),
+      _query_class(query_class),
+      _cancellation_token(cancellation_token),
+      _metrics(metrics) {
+  Assert(is_streamable(*_physical_plan), "PQP cannot be streamed");
+  Assert(_max_in_flight_chunks > 0, "At least one chunk has to be in flight");
+
+  if (_physical_plan->type() == OperatorType::Limit) {
+    const auto& limit = static_cast<const Limit&>(*_physical_plan);
+    const auto row_count = ExpressionEvaluator{}.evaluate_expression_to_result<int64_t>(*limit.row_count_expression());
+    Assert(row_count->size() == 1 && !row_count->is_null(0), "Expected exactly one non-null row count for Limit");
+    Assert(row_count->value(0) >= 0, "Can't Limit to a negative number of Rows");
+    _remaining_row_count = static_cast<size_t>(row_count->value(0));
+  }
+
+  // The chunks are fixed here, so that chunks appended while the result is streamed are not read
+  const auto get_table = leaf_get_table(_physical_plan->deep_copy());
+  const auto stored_chunk_count = StorageManager::get().get_table(get_table->table_name())->chunk_count();
+
+  // Chunks that were pruned by the optimizer are not streamed. Without any chunks, the PQP is executed once, so that
+  // the consumer still receives the (empty) result.
+  const auto& excluded_chunk_ids = get_table->excluded_chunk_ids();
+  const auto excluded_chunk_ids_set =
+      std::unordered_set<ChunkID>(excluded_chunk_ids.cbegin(), excluded_chunk_ids.cend());
+  for (auto chunk_id = ChunkID{0}; chunk_id < stored_chunk_count; ++chunk_id) {
+    if (!excluded_chunk_ids_set.count(chunk_id)) _pending_chunk_ids.emplace_back(chunk_id);
+  }
+  if (_pending_chunk_ids.empty()) _pending_chunk_ids.emplace_back(INVALID_CHUNK_ID);
+
+  // Start producing the result before the consumer asks for it
+  _schedule_chunks();
+}
+
+ResultChunkStream::ResultChunkStream(const std::shared_ptr<const Table>& result_table)
+    : _result_table(result_table), _finished(!result_table) {}
+
+ResultChunkStream::~ResultChunkStream() {
+  // The stream was not consumed entirely. The executions that are in flight still use the transaction context.
+  for (const auto& in_flight_chunk : _in_flight_chunks) {
+    try {
+      CurrentScheduler::wait_for_tasks(in_flight_chunk.tasks);
+    } catch (const QueryCancelledException&) {
+      // The query of the calling thread was cancelled, which does not matter here
+    }
+  }
+}
+
+bool ResultChunkStream::is_streamable(const AbstractOperator& physical_plan) {
+  auto op = &physical_plan;
+  if (op->type() == OperatorType::Limit) op = op->input_left().get();
+
+  while (op) {
+    switch (op->type()) {
+      case OperatorType::GetTable:
+        return !op->input_left() && static_cast<const GetTable&>(*op).runtime_filter_count() == 0;
+
+      case OperatorType::Validate:
+      case OperatorType::Alias:
+        break;
+
+      case OperatorType::TableScan:
+        if (contains_subquery(static_cast<const TableScan&>(*op).predicate())) return false;
+        break;
+
+      case OperatorType::Projection:
+        for (const auto& expression : static_cast<const Projection&>(*op).expressions) {
+          if (contains_subquery(expression)) return false;
+        }
+        break;
+
+      default:
+        return false;
+    }
+
+    op = op->input_left().get();
+  }
+
+  return false;
+}
+
+std::shared_ptr<const Table> ResultChunkStream::next() {
+  if (_finished) return nullptr;
+
+  if (!_physical_plan) {
+    _finished = true;
+    return _result_table;
+  }
+
+  while (true) {
+    CancellationToken::check(_cancellation_token);
+    _schedule_chunks();
+
+    if (_in_flight_chunks.empty()) {
+      _finish();
+      return nullptr;
+    }
+
+    const auto in_flight_chunk = std::move(_in_flight_chunks.front());
+    _in_flight_chunks.pop_front();
+
+    const auto started = std::chrono::high_resolution_clock::now();
+    CurrentScheduler::wait_for_tasks(in_flight_chunk.tasks);
+    const auto done = std::chrono::high_resolution_clock::now();
+    if (_metrics) {
+      _metrics->execution_time_nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+    }
+
+    if (_cancellation_token && _cancellation_token->is_cancelled()) {
+      _in_flight_chunks.clear();
+      if (_transaction_context) _transaction_context->rollback();
+      _finished = true;
+      throw QueryCancelledException(_cancellation_token->cancellation_reason());
+    }
+
+    auto output = in_flight_chunk.root->get_output();
+
+    // Apply the Limit to the entire stream. Each execution only limits the rows of its chunk.
+    if (_remaining_row_count) {
+      if (output->row_count() > *_remaining_row_count) {
+        auto table_wrapper = std::make_shared<TableWrapper>(output);
+        auto limit = std::make_shared<Limit>(
+            table_wrapper, expression_functional::value_(static_cast<int64_t>(*_remaining_row_count)));
+        table_wrapper->execute();
+        limit->execute();
+        output = limit->get_output();
+      }
+      *_remaining_row_count -= output->row_count();
+      if (*_remaining_row_count == 0) _pending_chunk_ids.clear();
+    }
+
+    // The first part is returned even if it is empty, so that the consumer learns the result's columns
+    if (output->row_count() == 0 && _returned_first_part) continue;
+
+    _returned_first_part = true;
+    return output;
+  }
+}
+
+void ResultChunkStream::_schedule_chunks() {
+  while (_in_flight_chunks.size() < _max_in_flight_chunks && !_pending_chunk_ids.empty()) {
+    const auto chunk_id = _pending_chunk_ids.front();
+    _pending_chunk_ids.pop_front();
+
+    auto root = _physical_plan->deep_copy();
+
+    // Read only the chunk with chunk_id, or no chunk at all if the stored table has no chunks to stream
+    leaf_get_table(root)->set_included_chunk_ids(chunk_id == INVALID_CHUNK_ID ? std::vector<ChunkID>{}
+                                                                              : std::vector<ChunkID>{chunk_id});
+
+    auto tasks = OperatorTask::make_tasks_from_operator(root, CleanupTemporaries::Yes);
+    for (const auto& task : tasks) {
+      task->set_query_class(_query_class);
+      task->set_cancellation_token(_cancellation_token);
+    }
+
+    if (CurrentScheduler::is_set()) {
+      ResourceGroup::get(_query_class).schedule_query_tasks(tasks);
+    } else {
+      CurrentScheduler::schedule_tasks(tasks);
+    }
+
+    _in_flight_chunks.emplace_back(InFlightChunk{std::move(root), std::move(tasks)});
+  }
+}
+
+void ResultChunkStream::_finish() {
+  _finished = true;
+  if (_auto_commit) _transaction_context->commit();
+}
+
+}  // namespace opossum
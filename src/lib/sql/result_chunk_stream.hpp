@@ -0,0 +1,94 @@
+#pragma once
+
+#include <deque>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class CancellationToken;
+class OperatorTask;
+class TransactionContext;
+struct SQLPipelineStatementMetrics;
+
+/**
+ * Pull-based access to the result of a statement, so that consumers (e.g., the server) can process the first rows
+ * before the entire result was produced and do not need to hold the entire result in memory.
+ *
+ * If the PQP only consists of operators that process each chunk on its own, the PQP is executed once per chunk of the
+ * stored table it reads (see is_streamable()). The copy of the PQP for a chunk reads only that chunk, which is the only
+ * chunk included in its GetTable (see GetTable::set_included_chunk_ids()). Chunks appended to the stored table after
+ * the stream was created are not part of the result. At most max_in_flight_chunks of these executions are scheduled
+ * ahead of the consumer, which bounds the memory held for results that were not consumed yet. A Limit at the root of
+ * the PQP is applied to the entire stream.
+ *
+ * All other statements are executed at once and their result is returned as a whole.
+ */
+class ResultChunkStream : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_MAX_IN_FLIGHT_CHUNKS = size_t{4};
+
+  // Streams the result of @param physical_plan, which is not executed itself but copied for each chunk. The first
+  // copies are scheduled right away. They are executed within @param transaction_context, which is committed once the
+  // stream ends if @param auto_commit is set. The execution time is added to @param metrics.
+  ResultChunkStream(const std::shared_ptr<const AbstractOperator>& physical_plan, const size_t max_in_flight_chunks,
+                    const std::shared_ptr<TransactionContext>& transaction_context, const bool auto_commit,
+                    const QueryClass query_class, const std::shared_ptr<const CancellationToken>& cancellation_token,
+                    const std::shared_ptr<SQLPipelineStatementMetrics>& metrics);
+
+  // Returns the already computed @param result_table (which can be nullptr) as a single part
+  explicit ResultChunkStream(const std::shared_ptr<const Table>& result_table);
+
+  // Waits for the executions that are still scheduled
+  ~ResultChunkStream();
+
+  // @return whether the result of @param physical_plan can be produced chunk by chunk
+  static bool is_streamable(const AbstractOperator& physical_plan);
+
+  /**
+   * @return the next part of the result (a table with one or more chunks) or nullptr once the result was consumed. The
+   *         first call returns a table, possibly an empty one, for all statements that produce a result, so that the
+   *         consumer learns the result's columns. Throws a QueryCancelledException if the statement was cancelled.
+   */
+  std::shared_ptr<const Table> next();
+
+ private:
+  struct InFlightChunk {
+    std::shared_ptr<AbstractOperator> root;
+    std::vector<std::shared_ptr<OperatorTask>> tasks;
+  };
+
+  // Schedules the executions for the next chunks, until max_in_flight_chunks are in flight
+  void _schedule_chunks();
+
+  void _finish();
+
+  const std::shared_ptr<const AbstractOperator> _physical_plan;
+  const size_t _max_in_flight_chunks{DEFAULT_MAX_IN_FLIGHT_CHUNKS};
+  const std::shared_ptr<TransactionContext> _transaction_context;
+  const bool _auto_commit{false};
+  const QueryClass _query_class{QueryClass::Analytical};
+  const std::shared_ptr<const CancellationToken> _cancellation_token;
+  const std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
+
+  // The chunks of the stored table that are yet to be scheduled. Empty for results that are returned as a whole.
+  std::deque<ChunkID> _pending_chunk_ids;
+
+  std::deque<InFlightChunk> _in_flight_chunks;
+
+  // Rows that may still be returned if the PQP has a Limit at its root
+  std::optional<size_t> _remaining_row_count;
+
+  // For results returned as a whole
+  std::shared_ptr<const Table> _result_table;
+
+  bool _returned_first_part{false};
+  bool _finished{false};
+};
+
+}  // namespace opossum
@@ -3,58 +3,161 @@
 #include <boost/algorithm/string.hpp>
 
 #include <algorithm>
+#include <atomic>
+#include <exception>
+#include <optional>
+#include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "logical_query_plan/insert_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/update_node.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sql/sql_plan_cache.hpp"
 #include "utils/assert.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/tracing/probes.hpp"
 
-namespace opossum {
+namespace {
 
-SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
-                         const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
-                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries)
-    : _transaction_context(transaction_context), _optimizer(optimizer) {
-  DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
-              "The transaction context cannot have been committed already.");
-  DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
-              "Transaction context without MVCC enabled makes no sense");
+using namespace opossum;  // NOLINT
 
-  hsql::SQLParserResult parse_result;
+// The tables a statement reads and modifies, used to determine which statements of a pipeline depend on each other
+struct StatementTableAccess {
+  std::unordered_set<std::string> read_table_names;
+  std::unordered_set<std::string> modified_table_names;
 
-  const auto start = std::chrono::high_resolution_clock::now();
-  hsql::SQLParser::parse(sql, &parse_result);
+  // Set for all statements other than SELECT, INSERT, UPDATE, and DELETE, whose table accesses are not analyzed
+  bool is_barrier{false};
 
-  const auto done = std::chrono::high_resolution_clock::now();
-  _metrics.parse_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - start);
-  DTRACE_PROBE2(HYRISE, SQL_PARSING, sql.c_str(), _metrics.parse_time_nanos.count());
+  // Writes and barriers have to be executed after all earlier statements and before all later ones
+  bool orders_all_statements() const { return is_barrier || !modified_table_names.empty(); }
+};
 
-  AssertInput(parse_result.isValid(), create_sql_parser_error_message(sql, parse_result));
-  DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+StatementTableAccess analyze_table_access(SQLPipelineStatement& statement) {
+  auto table_access = StatementTableAccess{};
 
-  _sql_pipeline_statements.reserve(parse_result.size());
+  switch (statement.get_parsed_sql_statement()->getStatement(0)->type()) {
+    case hsql::kStmtSelect:
+    case hsql::kStmtInsert:
+    case hsql::kStmtUpdate:
+    case hsql::kStmtDelete:
+      break;
+    default:
+      table_access.is_barrier = true;
+      return table_access;
+  }
 
-  std::vector<std::shared_ptr<hsql::SQLParserResult>> parsed_statements;
-  for (auto* statement : parse_result.releaseStatements()) {
-    parsed_statements.emplace_back(std::make_shared<hsql::SQLParserResult>(statement));
+  auto contains_delete = false;
+  for (const auto& subplan_root : lqp_find_subplan_roots(statement.get_unoptimized_logical_plan())) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      switch (node->type) {
+        case LQPNodeType::StoredTable:
+          table_access.read_table_names.emplace(static_cast<const StoredTableNode&>(*node).table_name);
+          break;
+        case LQPNodeType::Insert:
+          table_access.modified_table_names.emplace(static_cast<const InsertNode&>(*node).table_name);
+          break;
+        case LQPNodeType::Update:
+          table_access.modified_table_names.emplace(static_cast<const UpdateNode&>(*node).table_name);
+          break;
+        case LQPNodeType::Delete:
+          contains_delete = true;
+          break;
+        default:
+          break;
+      }
+      return LQPVisitation::VisitInputs;
+    });
   }
 
-  auto seen_altering_statement = false;
+  // DeleteNodes do not name the table they delete from, so we assume that a DELETE modifies all tables it reads
+  if (contains_delete) {
+    table_access.modified_table_names.insert(table_access.read_table_names.begin(),
+                                             table_access.read_table_names.end());
+  }
+
+  return table_access;
+}
+
+// Parses @param sql and splits it into its statements
+std::shared_ptr<const std::vector<ParsedSQLStatement>> parse_sql(const std::string& sql) {
+  hsql::SQLParserResult parse_result;
+  hsql::SQLParser::parse(sql, &parse_result);
+
+  AssertInput(parse_result.isValid(), create_sql_parser_error_message(sql, parse_result));
+  DebugAssert(parse_result.size() > 0, "Cannot create empty SQLPipeline.");
+
+  auto parsed_statements = std::make_shared<std::vector<ParsedSQLStatement>>();
+  parsed_statements->reserve(parse_result.size());
 
   // We want to split the (multi-) statement SQL string into the strings for each statement. We can then use those
   // statement strings to cache query plans.
   // The sql parser only offers us the length of the string, so we need to split it manually.
   auto sql_string_offset = 0u;
 
-  for (auto& parsed_statement : parsed_statements) {
+  for (auto* statement : parse_result.releaseStatements()) {
+    auto parsed_statement = std::make_shared<hsql::SQLParserResult>(statement);
     parsed_statement->setIsValid(true);
 
-    // We will always have one at 0 because we set it ourselves
-    const auto* statement = parsed_statement->getStatement(0);
+    // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
+    const auto statement_string_length = statement->stringLength;
+    auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
+    sql_string_offset += statement_string_length;
+
+    parsed_statements->emplace_back(ParsedSQLStatement{std::move(statement_string), std::move(parsed_statement)});
+  }
+
+  return parsed_statements;
+}
+
+// Only strings that consist of SELECT statements are kept in the SQLParseTreeCache. Other statements (e.g., bulk
+// INSERTs with their values) are rarely repeated and would only evict the strings of queries from the cache.
+bool is_parse_tree_cacheable(const std::vector<ParsedSQLStatement>& parsed_statements) {
+  return std::all_of(parsed_statements.cbegin(), parsed_statements.cend(), [](const auto& parsed_statement) {
+    return parsed_statement.parsed_statement->getStatement(0)->isType(hsql::kStmtSelect);
+  });
+}
+
+}  // namespace
+
+namespace opossum {
 
-    switch (statement->type()) {
+SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context,
+                         const UseMvcc use_mvcc, const std::shared_ptr<LQPTranslator>& lqp_translator,
+                         const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                         const AutoParameterize auto_parameterize, const QueryClass query_class,
+                         const std::shared_ptr<const CancellationToken>& cancellation_token)
+    : _transaction_context(transaction_context), _optimizer(optimizer), _query_class(query_class) {
+  DebugAssert(!_transaction_context || _transaction_context->phase() == TransactionPhase::Active,
+              "The transaction context cannot have been committed already.");
+  DebugAssert(!_transaction_context || use_mvcc == UseMvcc::Yes,
+              "Transaction context without MVCC enabled makes no sense");
+
+  const auto start = std::chrono::high_resolution_clock::now();
+
+  auto parsed_statements = SQLParseTreeCache::get().try_get(sql);
+  _metrics.parse_tree_cache_hit = parsed_statements.has_value();
+  if (!parsed_statements) {
+    parsed_statements = parse_sql(sql);
+    if (is_parse_tree_cacheable(**parsed_statements)) SQLParseTreeCache::get().set(sql, *parsed_statements);
+  }
+
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics.parse_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - start);
+  DTRACE_PROBE2(HYRISE, SQL_PARSING, sql.c_str(), _metrics.parse_time_nanos.count());
+
+  _sql_pipeline_statements.reserve((*parsed_statements)->size());
+
+  auto seen_altering_statement = false;
+
+  for (const auto& [statement_string, parsed_statement] : **parsed_statements) {
+    switch (parsed_statement->getStatement(0)->type()) {
       // Check if statement alters the structure of the database in a way that following statements might depend upon.
       case hsql::StatementType::kStmtImport:
       case hsql::StatementType::kStmtCreate:
@@ -68,14 +171,9 @@ SQLPipeline::SQLPipeline(const std::string& sql, std::shared_ptr<TransactionCont
       }
     }
 
-    // Get the statement string from the original query string, so we can pass it to the SQLPipelineStatement
-    const auto statement_string_length = statement->stringLength;
-    const auto statement_string = boost::trim_copy(sql.substr(sql_string_offset, statement_string_length));
-    sql_string_offset += statement_string_length;
-
-    auto pipeline_statement =
-        std::make_shared<SQLPipelineStatement>(statement_string, std::move(parsed_statement), use_mvcc,
-                                               transaction_context, lqp_translator, optimizer, cleanup_temporaries);
+    auto pipeline_statement = std::make_shared<SQLPipelineStatement>(
+        statement_string, parsed_statement, use_mvcc, transaction_context, lqp_translator, optimizer,
+        cleanup_temporaries, auto_parameterize, query_class, cancellation_token);
     _sql_pipeline_statements.push_back(std::move(pipeline_statement));
   }
 
@@ -189,6 +287,12 @@ std::shared_ptr<const Table> SQLPipeline::get_result_table() {
   return tables.back();
 }
 
+std::shared_ptr<ResultChunkStream> SQLPipeline::get_result_stream(const size_t max_in_flight_chunks) {
+  Assert(statement_count() == 1, "Only the result of a single statement can be streamed");
+  Assert(!_pipeline_was_executed, "The pipeline's result was already retrieved as a table");
+  return _sql_pipeline_statements.front()->get_result_stream(max_in_flight_chunks);
+}
+
 const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables() {
   if (_pipeline_was_executed) {
     return _result_tables;
@@ -196,6 +300,13 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
 
   _result_tables.reserve(_sql_pipeline_statements.size());
 
+  // Statements that require the execution of earlier statements to be translated cannot be analyzed upfront
+  if (!_requires_execution && statement_count() > 1 && CurrentScheduler::is_set()) {
+    _execute_statements_concurrently();
+    _pipeline_was_executed = !_failed_pipeline_statement;
+    return _result_tables;
+  }
+
   for (auto& pipeline_statement : _sql_pipeline_statements) {
     pipeline_statement->get_result_table();
     if (_transaction_context && _transaction_context->aborted()) {
@@ -212,6 +323,95 @@ const std::vector<std::shared_ptr<const Table>>& SQLPipeline::get_result_tables(
   return _result_tables;
 }
 
+void SQLPipeline::_execute_statements_concurrently() {
+  const auto statement_count = _sql_pipeline_statements.size();
+
+  // This translates all statements into LQPs on the calling thread before any of them is executed
+  auto table_accesses = std::vector<StatementTableAccess>{};
+  table_accesses.reserve(statement_count);
+  for (const auto& pipeline_statement : _sql_pipeline_statements) {
+    table_accesses.emplace_back(analyze_table_access(*pipeline_statement));
+  }
+
+  // The first statement (in statement order) that threw an exception or aborted the transaction. Statements after it
+  // are skipped, as they would not have been executed one after another either.
+  auto first_failed_statement_idx = std::atomic<size_t>{statement_count};
+  auto exceptions = std::vector<std::exception_ptr>(statement_count);
+
+  const auto mark_failed = [&](const size_t statement_idx) {
+    auto failed_statement_idx = first_failed_statement_idx.load();
+    while (statement_idx < failed_statement_idx &&
+           !first_failed_statement_idx.compare_exchange_weak(failed_statement_idx, statement_idx)) {
+    }
+  };
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(statement_count);
+  for (auto statement_idx = size_t{0}; statement_idx < statement_count; ++statement_idx) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, statement_idx]() {
+      if (first_failed_statement_idx.load() < statement_idx) return;
+
+      try {
+        // The PQP (and, in auto-commit mode, the transaction) is only created now, i.e., after all statements this
+        // statement depends on have been executed
+        _sql_pipeline_statements[statement_idx]->get_result_table();
+      } catch (...) {
+        exceptions[statement_idx] = std::current_exception();
+        mark_failed(statement_idx);
+        return;
+      }
+
+      if (_transaction_context && _transaction_context->aborted()) mark_failed(statement_idx);
+    }));
+    tasks.back()->set_query_class(_query_class);
+    // The statements handle the cancellation themselves, a skipped JobTask would not report it
+    tasks.back()->set_cancellation_token(nullptr);
+  }
+
+  // Writes and barriers are chained, so it suffices to wait for the statements since the last one of them. Reads wait
+  // for the last write or barrier they conflict with.
+  auto ordering_statement_idxs = std::vector<size_t>{};
+  for (auto statement_idx = size_t{0}; statement_idx < statement_count; ++statement_idx) {
+    const auto& table_access = table_accesses[statement_idx];
+
+    if (table_access.orders_all_statements()) {
+      const auto first_predecessor_idx = ordering_statement_idxs.empty() ? size_t{0} : ordering_statement_idxs.back();
+      for (auto predecessor_idx = first_predecessor_idx; predecessor_idx < statement_idx; ++predecessor_idx) {
+        tasks[predecessor_idx]->set_as_predecessor_of(tasks[statement_idx]);
+      }
+      ordering_statement_idxs.emplace_back(statement_idx);
+      continue;
+    }
+
+    for (auto iter = ordering_statement_idxs.rbegin(); iter != ordering_statement_idxs.rend(); ++iter) {
+      const auto& predecessor_access = table_accesses[*iter];
+      const auto& modified_table_names = predecessor_access.modified_table_names;
+      const auto conflicts =
+          predecessor_access.is_barrier ||
+          std::any_of(table_access.read_table_names.begin(), table_access.read_table_names.end(),
+                      [&](const auto& table_name) { return modified_table_names.count(table_name) > 0; });
+      if (conflicts) {
+        tasks[*iter]->set_as_predecessor_of(tasks[statement_idx]);
+        break;
+      }
+    }
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+  const auto failed_statement_idx = first_failed_statement_idx.load();
+  if (failed_statement_idx < statement_count) {
+    if (exceptions[failed_statement_idx]) std::rethrow_exception(exceptions[failed_statement_idx]);
+
+    _failed_pipeline_statement = _sql_pipeline_statements[failed_statement_idx];
+    return;
+  }
+
+  for (const auto& pipeline_statement : _sql_pipeline_statements) {
+    _result_tables.emplace_back(pipeline_statement->get_result_table());
+  }
+}
+
 std::shared_ptr<TransactionContext> SQLPipeline::transaction_context() const { return _transaction_context; }
 
 std::shared_ptr<SQLPipelineStatement> SQLPipeline::failed_pipeline_statement() const {
@@ -253,7 +453,7 @@ std::string SQLPipelineMetrics::to_string() const {
 
   std::ostringstream info_string;
   info_string << "Execution info: [";
-  info_string << "PARSE: " << format_duration(parse_time_nanos) << ", ";
+  info_string << "PARSE: " << format_duration(parse_time_nanos) << (parse_tree_cache_hit ? " (cached), " : ", ");
   info_string << "SQL TRANSLATE: " << format_duration(total_sql_translate_nanos) << ", ";
   info_string << "OPTIMIZE: " << format_duration(total_optimize_nanos) << ", ";
   info_string << "LQP TRANSLATE: " << format_duration(total_lqp_translate_nanos) << ", ";
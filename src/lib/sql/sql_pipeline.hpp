@@ -7,6 +7,7 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/operator_task.hpp"
+#include "sql/result_chunk_stream.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "storage/chunk.hpp"
 #include "types.hpp"
@@ -20,6 +21,9 @@ struct SQLPipelineMetrics {
   // This is different from the other measured times as we only get this for all statements at once
   std::chrono::nanoseconds parse_time_nanos{0};
 
+  // Whether the SQL string was found in the SQLParseTreeCache, so that parse_time_nanos only covers the lookup
+  bool parse_tree_cache_hit{false};
+
   std::string to_string() const;
 };
 
@@ -35,7 +39,8 @@ class SQLPipeline : public Noncopyable {
   // Prefer using the SQLPipelineBuilder interface for constructing SQLPipelines conveniently
   SQLPipeline(const std::string& sql, std::shared_ptr<TransactionContext> transaction_context, const UseMvcc use_mvcc,
               const std::shared_ptr<LQPTranslator>& lqp_translator, const std::shared_ptr<Optimizer>& optimizer,
-              const CleanupTemporaries cleanup_temporaries);
+              const CleanupTemporaries cleanup_temporaries, const AutoParameterize auto_parameterize,
+              const QueryClass query_class, const std::shared_ptr<const CancellationToken>& cancellation_token);
 
   // Returns the SQL string for each statement.
   const std::vector<std::string>& get_sql_strings();
@@ -56,12 +61,20 @@ class SQLPipeline : public Noncopyable {
   // Returns all tasks for each statement that need to be executed for this query.
   const std::vector<std::vector<std::shared_ptr<OperatorTask>>>& get_tasks();
 
-  // Executes all tasks, waits for them to finish, and returns the resulting tables
+  // Executes all tasks, waits for them to finish, and returns the resulting tables.
+  // If a scheduler is active, statements that do not depend on each other are executed concurrently (see
+  // _execute_statements_concurrently()). The results, errors, and aborts are reported as if the statements had been
+  // executed one after another.
   const std::vector<std::shared_ptr<const Table>>& get_result_tables();
 
   // Shorthand for `get_result_tables().back()`
   std::shared_ptr<const Table> get_result_table();
 
+  // Returns the result of a pipeline with a single statement as a stream of chunks, see
+  // SQLPipelineStatement::get_result_stream(). Must not be combined with get_result_table(s)().
+  std::shared_ptr<ResultChunkStream> get_result_stream(
+      const size_t max_in_flight_chunks = ResultChunkStream::DEFAULT_MAX_IN_FLIGHT_CHUNKS);
+
   // Returns the TransactionContext that was passed to the SQLPipelineStatement, or nullptr if none was passed in.
   std::shared_ptr<TransactionContext> transaction_context() const;
 
@@ -77,10 +90,21 @@ class SQLPipeline : public Noncopyable {
   const SQLPipelineMetrics& metrics();
 
  private:
+  /**
+   * Executes the statements as JobTasks. Each statement waits only for the earlier statements it depends on:
+   *  - INSERT, UPDATE, and DELETE statements wait for all earlier statements,
+   *  - SELECT statements wait for earlier statements modifying one of the tables they read, and
+   *  - all other statements (e.g., SHOW TABLES or EXECUTE) are ordered with respect to all other statements.
+   * Thus, writes are executed in statement order and reads see exactly the writes that precede them. Statements are
+   * skipped once an earlier statement failed or aborted the transaction.
+   */
+  void _execute_statements_concurrently();
+
   std::vector<std::shared_ptr<SQLPipelineStatement>> _sql_pipeline_statements;
 
   const std::shared_ptr<TransactionContext> _transaction_context;
   const std::shared_ptr<Optimizer> _optimizer;
+  const QueryClass _query_class;
 
   // Execution results
   std::vector<std::string> _sql_strings;
@@ -35,11 +35,28 @@ SQLPipelineBuilder& SQLPipelineBuilder::dont_cleanup_temporaries() {
   return *this;
 }
 
+SQLPipelineBuilder& SQLPipelineBuilder::enable_auto_parameterization() {
+  _auto_parameterize = AutoParameterize::Yes;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_query_class(const QueryClass query_class) {
+  _query_class = query_class;
+  return *this;
+}
+
+SQLPipelineBuilder& SQLPipelineBuilder::with_cancellation_token(
+    const std::shared_ptr<const CancellationToken>& cancellation_token) {
+  _cancellation_token = cancellation_token;
+  return *this;
+}
+
 SQLPipeline SQLPipelineBuilder::create_pipeline() const {
   DTRACE_PROBE1(HYRISE, CREATE_PIPELINE, reinterpret_cast<uintptr_t>(this));
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
-  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries);
+  auto pipeline = SQLPipeline(_sql, _transaction_context, _use_mvcc, lqp_translator, optimizer, _cleanup_temporaries,
+                              _auto_parameterize, _query_class, _cancellation_token);
   DTRACE_PROBE3(HYRISE, PIPELINE_CREATION_DONE, pipeline.get_sql_strings().size(), _sql.c_str(),
                 reinterpret_cast<uintptr_t>(this));
   return pipeline;
@@ -50,8 +67,8 @@ SQLPipelineStatement SQLPipelineBuilder::create_pipeline_statement(
   auto lqp_translator = _lqp_translator ? _lqp_translator : std::make_shared<LQPTranslator>();
   auto optimizer = _optimizer ? _optimizer : Optimizer::create_default_optimizer();
 
-  return {_sql,      std::move(parsed_sql), _use_mvcc, _transaction_context, lqp_translator,
-          optimizer, _cleanup_temporaries};
+  return {_sql,      std::move(parsed_sql),  _use_mvcc,          _transaction_context, lqp_translator,
+          optimizer, _cleanup_temporaries, _auto_parameterize, _query_class,         _cancellation_token};
 }
 
 }  // namespace opossum
@@ -10,6 +10,7 @@
 
 namespace opossum {
 
+class CancellationToken;
 class Optimizer;
 
 /**
@@ -28,6 +29,7 @@ class Optimizer;
  *  - MVCC is enabled
  *  - The default Optimizer (Optimizer::create_default_optimizer()) is used.
  *  - No JIT operators
+ *  - No auto-parameterization, i.e., plans are cached by the exact SQL string
  *
  * Favour this interface over calling the SQLPipeline[Statement] constructors with their long parameter list.
  * See SQLPipeline[Statement] doc for these classes, in short SQLPipeline ist for queries with multiple statement,
@@ -52,6 +54,24 @@ class SQLPipelineBuilder final {
    */
   SQLPipelineBuilder& dont_cleanup_temporaries();
 
+  /*
+   * Replace the literals of SELECT statements by parameters, so that statements differing only in their literals share
+   * their plans. See SQLPipelineStatement.
+   */
+  SQLPipelineBuilder& enable_auto_parameterization();
+
+  /*
+   * Schedule the tasks of all statements in the ResourceGroup of @param query_class. By default, queries are
+   * Analytical.
+   */
+  SQLPipelineBuilder& with_query_class(const QueryClass query_class);
+
+  /*
+   * Stop the execution of the statements once @param cancellation_token is cancelled (see CancellationToken). The
+   * statement being executed then throws a QueryCancelledException and rolls back its transaction.
+   */
+  SQLPipelineBuilder& with_cancellation_token(const std::shared_ptr<const CancellationToken>& cancellation_token);
+
   SQLPipeline create_pipeline() const;
 
   /**
@@ -68,6 +88,9 @@ class SQLPipelineBuilder final {
   std::shared_ptr<LQPTranslator> _lqp_translator;
   std::shared_ptr<Optimizer> _optimizer;
   CleanupTemporaries _cleanup_temporaries{true};
+  AutoParameterize _auto_parameterize{AutoParameterize::No};
+  QueryClass _query_class{QueryClass::Analytical};
+  std::shared_ptr<const CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
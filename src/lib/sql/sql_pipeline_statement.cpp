@@ -10,11 +10,20 @@
 #include "create_sql_parser_error_message.hpp"
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_read_write_operator.hpp"
 #include "optimizer/optimizer.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
+#include "sql/normalize_sql_literals.hpp"
+#include "sql/parameterized_plan.hpp"
+#include "sql/physical_plan_leases.hpp"
+#include "sql/result_chunk_stream.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
@@ -25,7 +34,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
                                            const std::shared_ptr<TransactionContext>& transaction_context,
                                            const std::shared_ptr<LQPTranslator>& lqp_translator,
                                            const std::shared_ptr<Optimizer>& optimizer,
-                                           const CleanupTemporaries cleanup_temporaries)
+                                           const CleanupTemporaries cleanup_temporaries,
+                                           const AutoParameterize auto_parameterize,
+                                           const QueryClass query_class,
+                                           const std::shared_ptr<const CancellationToken>& cancellation_token)
     : _sql_string(sql),
       _use_mvcc(use_mvcc),
       _auto_commit(_use_mvcc == UseMvcc::Yes && !transaction_context),
@@ -34,7 +46,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
       _optimizer(optimizer),
       _parsed_sql_statement(std::move(parsed_sql)),
       _metrics(std::make_shared<SQLPipelineStatementMetrics>()),
-      _cleanup_temporaries(cleanup_temporaries) {
+      _cleanup_temporaries(cleanup_temporaries),
+      _auto_parameterize(auto_parameterize),
+      _query_class(query_class),
+      _cancellation_token(cancellation_token) {
   Assert(!_parsed_sql_statement || _parsed_sql_statement->size() == 1,
          "SQLPipelineStatement must hold exactly one SQL statement");
   DebugAssert(!_sql_string.empty(), "An SQLPipelineStatement should always contain a SQL statement string for caching");
@@ -44,6 +59,10 @@ SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_p
               "Transaction context without MVCC enabled makes no sense");
 }
 
+SQLPipelineStatement::~SQLPipelineStatement() {
+  if (_physical_plan_is_leased) PhysicalPlanLeases::get().release(_physical_plan);
+}
+
 const std::string& SQLPipelineStatement::get_sql_string() { return _sql_string; }
 
 const std::shared_ptr<hsql::SQLParserResult>& SQLPipelineStatement::get_parsed_sql_statement() {
@@ -130,23 +149,33 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     return _physical_plan;
   }
 
-  // If we need a transaction context but haven't passed one in, this is the latest point where we can create it
-  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
-    _transaction_context = TransactionManager::get().new_transaction_context();
-  }
-
   // Stores when the actual compilation started/ended
   auto started = std::chrono::high_resolution_clock::now();
   auto done = started;  // dummy value needed for initialization
 
-  if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
+  // Only instantiate a parameterized plan if the optimized LQP was not requested for the literals already
+  const auto parameterized_physical_plan =
+      _auto_parameterize == AutoParameterize::Yes && !_optimized_logical_plan ? _instantiate_parameterized_plan()
+                                                                              : nullptr;
+
+  if (parameterized_physical_plan) {
+    _physical_plan = parameterized_physical_plan;
+
+  } else if (const auto cached_physical_plan = SQLPhysicalPlanCache::get().try_get(_sql_string)) {
     if ((*cached_physical_plan)->transaction_context_is_set()) {
       Assert(_use_mvcc == UseMvcc::Yes, "Trying to use MVCC cached query without a transaction context.");
     } else {
       Assert(_use_mvcc == UseMvcc::No, "Trying to use non-MVCC cached query with a transaction context.");
     }
 
-    _physical_plan = (*cached_physical_plan)->deep_copy();
+    // Reusable plans are executed without copying them unless another statement currently executes them
+    const auto& physical_plan = *cached_physical_plan;
+    if (PhysicalPlanLeases::is_reusable(*physical_plan) && PhysicalPlanLeases::get().try_lease(physical_plan)) {
+      _physical_plan = physical_plan;
+      _physical_plan_is_leased = true;
+    } else {
+      _physical_plan = physical_plan->deep_copy();
+    }
     _metrics->query_plan_cache_hit = true;
 
   } else {
@@ -160,14 +189,31 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
 
   done = std::chrono::high_resolution_clock::now();
 
+  // If we need a transaction context but haven't passed one in, this is the latest point where we can create it.
+  // Statements that do not modify data get a (cheaper) read-only transaction context.
+  if (!_transaction_context && _use_mvcc == UseMvcc::Yes) {
+    if (_physical_plan_is_read_only(_physical_plan)) {
+      _transaction_context = TransactionManager::get().new_read_only_transaction_context();
+    } else {
+      _transaction_context = TransactionManager::get().new_transaction_context();
+    }
+  }
+
   if (_use_mvcc == UseMvcc::Yes) _physical_plan->set_transaction_context_recursively(_transaction_context);
 
-  // Cache newly created plan for the according sql statement (only if not already cached)
-  if (!_metrics->query_plan_cache_hit) {
+  // Cache newly created plan for the according sql statement
+  // (only if not already cached). The cached plan is the one this statement executes, so it is leased right away.
+  if (!_metrics->query_plan_cache_hit && !parameterized_physical_plan) {
+    if (PhysicalPlanLeases::is_reusable(*_physical_plan)) {
+      _physical_plan_is_leased = PhysicalPlanLeases::get().try_lease(_physical_plan);
+    }
     SQLPhysicalPlanCache::get().set(_sql_string, _physical_plan);
   }
 
-  _metrics->lqp_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  // The parameterized plan's translation and instantiation times are recorded by _instantiate_parameterized_plan()
+  if (!parameterized_physical_plan) {
+    _metrics->lqp_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+  }
 
   return _physical_plan;
 }
@@ -178,6 +224,10 @@ const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_task
   }
 
   _tasks = OperatorTask::make_tasks_from_operator(get_physical_plan(), _cleanup_temporaries);
+  for (const auto& task : _tasks) {
+    task->set_query_class(_query_class);
+    task->set_cancellation_token(_cancellation_token);
+  }
   return _tasks;
 }
 
@@ -186,13 +236,38 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
+  // Don't bother optimizing a statement that was cancelled before it was executed
+  CancellationToken::check(_cancellation_token);
+
+  if (const auto cached_result = _try_get_cached_result()) {
+    _result_table = cached_result;
+    return _result_table;
+  }
+
   const auto& tasks = get_tasks();
 
+  // The tables are looked up before the execution, so that a table replaced in the meantime invalidates the result
+  const auto cache_result = _auto_commit && SQLResultCache::get().capacity() > 0 &&
+                            get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect);
+  const auto result_cache_tables = cache_result ? SQLResultCache::lqp_find_stored_tables(get_optimized_logical_plan())
+                                                : std::vector<std::pair<std::string, std::shared_ptr<const Table>>>{};
+
   const auto started = std::chrono::high_resolution_clock::now();
 
   DTRACE_PROBE3(HYRISE, TASKS_PER_STATEMENT, reinterpret_cast<uintptr_t>(&tasks), _sql_string.c_str(),
                 reinterpret_cast<uintptr_t>(this));
-  CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  if (CurrentScheduler::is_set()) {
+    ResourceGroup::get(_query_class).schedule_query_tasks(tasks);
+    CurrentScheduler::wait_for_tasks(tasks);
+  } else {
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+  }
+
+  if (_cancellation_token && _cancellation_token->is_cancelled()) {
+    // Some tasks were skipped, so the writes of the statement might be incomplete
+    if (_transaction_context) _transaction_context->rollback();
+    throw QueryCancelledException(_cancellation_token->cancellation_reason());
+  }
 
   if (_auto_commit) {
     _transaction_context->commit();
@@ -205,6 +280,22 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  if (cache_result && _result_table) {
+    SQLResultCache::get().set(_sql_string, _result_table, result_cache_tables,
+                              _transaction_context->snapshot_commit_id());
+  }
+
+  // Feed the actual cardinalities back into the optimizer. If the estimations the plan is based on were far off, the
+  // plan is evicted from the caches, so that the next execution is optimized using the actual cardinalities.
+  auto& cardinality_feedback = CardinalityFeedback::get();
+  if (cardinality_feedback.is_enabled()) {
+    const auto max_q_error = cardinality_feedback.record(get_physical_plan());
+    if (max_q_error > cardinality_feedback.q_error_threshold()) {
+      SQLLogicalPlanCache::get().erase(_sql_string);
+      SQLPhysicalPlanCache::get().erase(_sql_string);
+    }
+  }
+
   DTRACE_PROBE8(HYRISE, SUMMARY, _sql_string.c_str(), _metrics->sql_translate_time_nanos.count(),
                 _metrics->optimize_time_nanos.count(), _metrics->lqp_translate_time_nanos.count(),
                 _metrics->execution_time_nanos.count(), _metrics->query_plan_cache_hit, get_tasks().size(),
@@ -212,6 +303,130 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   return _result_table;
 }
 
+const std::shared_ptr<ResultChunkStream>& SQLPipelineStatement::get_result_stream(const size_t max_in_flight_chunks) {
+  if (_result_stream) {
+    return _result_stream;
+  }
+
+  CancellationToken::check(_cancellation_token);
+
+  // Streamed results are not materialized and thus not cached, but cached results are used
+  if (const auto cached_result = _try_get_cached_result()) {
+    _result_stream = std::make_shared<ResultChunkStream>(cached_result);
+    return _result_stream;
+  }
+
+  const auto& physical_plan = get_physical_plan();
+  if (ResultChunkStream::is_streamable(*physical_plan)) {
+    _result_stream =
+        std::make_shared<ResultChunkStream>(physical_plan, max_in_flight_chunks, _transaction_context, _auto_commit,
+                                            _query_class, _cancellation_token, _metrics);
+  } else {
+    _result_stream = std::make_shared<ResultChunkStream>(get_result_table());
+  }
+
+  return _result_stream;
+}
+
+bool SQLPipelineStatement::_physical_plan_is_read_only(const std::shared_ptr<const AbstractOperator>& op) {
+  if (!op) return true;
+  if (std::dynamic_pointer_cast<const AbstractReadWriteOperator>(op)) return false;
+  return _physical_plan_is_read_only(op->input_left()) && _physical_plan_is_read_only(op->input_right());
+}
+
+std::shared_ptr<AbstractOperator> SQLPipelineStatement::_instantiate_parameterized_plan() {
+  if (!get_parsed_sql_statement()->getStatement(0)->isType(hsql::kStmtSelect)) return nullptr;
+
+  const auto normalized_sql = normalize_sql_literals(_sql_string);
+  if (normalized_sql.literals.empty()) return nullptr;
+
+  auto parameterized_plan = std::shared_ptr<ParameterizedPlan>{};
+  auto cache_hit = false;
+
+  if (const auto cached_plan = SQLParameterizedPlanCache::get().try_get(normalized_sql.sql)) {
+    // Statements that could not be parameterized are cached as nullptr
+    if (!*cached_plan) return nullptr;
+
+    // MVCC-enabled and MVCC-disabled plans will evict each other
+    if (lqp_is_validated((*cached_plan)->lqp) == (_use_mvcc == UseMvcc::Yes)) {
+      parameterized_plan = *cached_plan;
+      cache_hit = true;
+    }
+  }
+
+  if (!parameterized_plan) {
+    const auto started = std::chrono::high_resolution_clock::now();
+
+    auto parse_result = hsql::SQLParserResult{};
+    hsql::SQLParser::parse(normalized_sql.sql, &parse_result);
+    if (!parse_result.isValid() || parse_result.size() != 1) {
+      SQLParameterizedPlanCache::get().set(normalized_sql.sql, nullptr);
+      return nullptr;
+    }
+
+    // Translating the placeholders might fail where the literals are fine, e.g., if the SQLTranslator needs the data
+    // type of a placeholder. Such statements are not parameterized.
+    auto sql_translator = SQLTranslator{_use_mvcc};
+    auto lqp = std::shared_ptr<AbstractLQPNode>{};
+    try {
+      lqp = sql_translator.translate_parser_result(parse_result).front();
+    } catch (const std::exception&) {
+      SQLParameterizedPlanCache::get().set(normalized_sql.sql, nullptr);
+      return nullptr;
+    }
+
+    const auto parameter_ids = sql_translator.parameter_ids_of_value_placeholders();
+    if (parameter_ids.size() != normalized_sql.literals.size() ||
+        !ParameterizedPlan::parameterize_placeholders(lqp, parameter_ids, normalized_sql.literals)) {
+      SQLParameterizedPlanCache::get().set(normalized_sql.sql, nullptr);
+      return nullptr;
+    }
+
+    const auto translated = std::chrono::high_resolution_clock::now();
+    _metrics->sql_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(translated - started);
+
+    const auto optimized_lqp = _optimizer->optimize(lqp);
+
+    const auto optimized = std::chrono::high_resolution_clock::now();
+    _metrics->optimize_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(optimized - translated);
+
+    const auto pqp = _lqp_translator->translate_node(optimized_lqp);
+
+    const auto done = std::chrono::high_resolution_clock::now();
+    _metrics->lqp_translate_time_nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(done - optimized);
+
+    parameterized_plan =
+        std::make_shared<ParameterizedPlan>(optimized_lqp, pqp, parameter_ids, normalized_sql.literals);
+    SQLParameterizedPlanCache::get().set(normalized_sql.sql, parameterized_plan);
+  }
+
+  // The plan was optimized for other selectivities, so the statement is optimized on its own
+  if (!parameterized_plan->covers(normalized_sql.literals)) return nullptr;
+
+  _optimized_logical_plan = parameterized_plan->lqp;
+  _metrics->query_plan_cache_hit = cache_hit;
+
+  const auto started = std::chrono::high_resolution_clock::now();
+  const auto physical_plan = parameterized_plan->instantiate(normalized_sql.literals);
+  const auto done = std::chrono::high_resolution_clock::now();
+  _metrics->lqp_translate_time_nanos += std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
+
+  return physical_plan;
+}
+
+std::shared_ptr<const Table> SQLPipelineStatement::_try_get_cached_result() {
+  // Statements in a transaction of their own see the latest committed data, just like the up-to-date cached result.
+  // Only SELECT statements are cached, so there is no need to parse the statement before the lookup.
+  if (!_auto_commit) return nullptr;
+
+  auto& result_cache = SQLResultCache::get();
+  if (result_cache.capacity() == 0) return nullptr;
+
+  const auto cached_result = result_cache.try_get(_sql_string);
+  if (cached_result) _metrics->result_cache_hit = true;
+  return cached_result;
+}
+
 const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_context() const {
   return _transaction_context;
 }
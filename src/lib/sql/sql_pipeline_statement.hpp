@@ -11,6 +11,9 @@
 
 namespace opossum {
 
+class CancellationToken;
+class ResultChunkStream;
+
 // Holds relevant information about the execution of an SQLPipelineStatement.
 struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds sql_translate_time_nanos{};
@@ -19,6 +22,7 @@ struct SQLPipelineStatementMetrics {
   std::chrono::nanoseconds execution_time_nanos{};
 
   bool query_plan_cache_hit = false;
+  bool result_cache_hit = false;
 };
 
 /**
@@ -33,6 +37,12 @@ struct SQLPipelineStatementMetrics {
  * NOTE:
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the optimized
  *  LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be different.
+ *
+ * NOTE:
+ *  With AutoParameterize::Yes, the literals of SELECT statements are replaced by parameters (see
+ *  normalize_sql_literals()) and the plans are cached in the SQLParameterizedPlanCache, keyed by the normalized SQL
+ *  string. Statements that differ only in their literals then share their plans, which are instantiated with the
+ *  statement's literals. The optimized LQP is the parameterized one in this case.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -40,7 +50,12 @@ class SQLPipelineStatement : public Noncopyable {
   SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
                        const UseMvcc use_mvcc, const std::shared_ptr<TransactionContext>& transaction_context,
                        const std::shared_ptr<LQPTranslator>& lqp_translator,
-                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries);
+                       const std::shared_ptr<Optimizer>& optimizer, const CleanupTemporaries cleanup_temporaries,
+                       const AutoParameterize auto_parameterize, const QueryClass query_class,
+                       const std::shared_ptr<const CancellationToken>& cancellation_token);
+
+  // Makes a leased physical plan available to other statements again (see PhysicalPlanLeases)
+  ~SQLPipelineStatement();
 
   // Returns the raw SQL string.
   const std::string& get_sql_string();
@@ -56,22 +71,46 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Returns the PQP for this statement.
   // The physical plan is either retrieved from the SQLPhysicalPlanCache or, if unavailable, translated from the
-  // optimized LQP.
+  // optimized LQP. Plans from the cache are copied unless they are reusable and not executed by another statement
+  // (see PhysicalPlanLeases). In that case, the plan is only valid until this statement is destroyed.
   const std::shared_ptr<AbstractOperator>& get_physical_plan();
 
   // Returns all tasks that need to be executed for this query.
   const std::vector<std::shared_ptr<OperatorTask>>& get_tasks();
 
   // Executes all tasks, waits for them to finish, and returns the resulting table.
+  // If a scheduler is active, the tasks are executed once the statement is admitted by the ResourceGroup of its
+  // QueryClass.
+  // Throws a QueryCancelledException and rolls back the transaction if the statement's CancellationToken is cancelled
+  // before or during the execution.
+  // SELECT statements that run in their own transaction are served from the SQLResultCache if it is enabled and holds
+  // an up-to-date result. Otherwise, their result is cached after the execution.
   const std::shared_ptr<const Table>& get_result_table();
 
+  // Executes the statement and returns its result as a stream of chunks (see ResultChunkStream). At most
+  // @param max_in_flight_chunks chunks are produced ahead of the consumer. Results of PQPs that cannot be streamed are
+  // produced with get_result_table() and returned at once. Must not be combined with get_result_table().
+  const std::shared_ptr<ResultChunkStream>& get_result_stream(const size_t max_in_flight_chunks);
+
   // Returns the TransactionContext that was either passed to or created by the SQLPipelineStatement.
-  // This can be a nullptr if no transaction management is wanted.
+  // This can be a nullptr if no transaction management is wanted. If the SQLPipelineStatement created the context
+  // itself and the statement does not modify data, it is a (possibly shared) read-only context.
   const std::shared_ptr<TransactionContext>& transaction_context() const;
 
   const std::shared_ptr<SQLPipelineStatementMetrics>& metrics() const;
 
  private:
+  // Returns true if the plan does not contain any read-write operators (e.g., Insert or Delete)
+  static bool _physical_plan_is_read_only(const std::shared_ptr<const AbstractOperator>& op);
+
+  // Returns the PQP instantiated from the SQLParameterizedPlanCache (or a newly created ParameterizedPlan), or nullptr
+  // if the statement cannot be parameterized or the parameterized plan is not suitable for its literals
+  std::shared_ptr<AbstractOperator> _instantiate_parameterized_plan();
+
+  // Returns the up-to-date result from the SQLResultCache, or nullptr if there is none or the statement cannot use the
+  // cache
+  std::shared_ptr<const Table> _try_get_cached_result();
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
@@ -89,8 +128,11 @@ class SQLPipelineStatement : public Noncopyable {
   std::shared_ptr<AbstractLQPNode> _unoptimized_logical_plan;
   std::shared_ptr<AbstractLQPNode> _optimized_logical_plan;
   std::shared_ptr<AbstractOperator> _physical_plan;
+  // Whether _physical_plan is the instance from the SQLPhysicalPlanCache, leased to this statement
+  bool _physical_plan_is_leased = false;
   std::vector<std::shared_ptr<OperatorTask>> _tasks;
   std::shared_ptr<const Table> _result_table;
+  std::shared_ptr<ResultChunkStream> _result_stream;
   // Assume there is an output table. Only change if nullptr is returned from execution.
   bool _query_has_output = true;
 
@@ -98,6 +140,14 @@ class SQLPipelineStatement : public Noncopyable {
 
   // Delete temporary tables
   const CleanupTemporaries _cleanup_temporaries;
+
+  const AutoParameterize _auto_parameterize;
+
+  // All tasks of the statement, including the JobTasks spawned by its operators, are scheduled in this class
+  const QueryClass _query_class;
+
+  // Set on all tasks of the statement. nullptr if the statement cannot be cancelled.
+  const std::shared_ptr<const CancellationToken> _cancellation_token;
 };
 
 }  // namespace opossum
@@ -2,15 +2,34 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "SQLParserResult.h"
 #include "cache/cache.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class AbstractLQPNode;
+class ParameterizedPlan;
 
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
 using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
 
+// Keyed by the SQL string with its literals replaced by placeholders. Holds nullptr for statements that could not be
+// parameterized, so that they are not translated twice on each execution.
+using SQLParameterizedPlanCache = Cache<std::shared_ptr<ParameterizedPlan>, std::string>;
+
+// A single statement of the SQL string passed to an SQLPipeline
+struct ParsedSQLStatement {
+  std::string sql_string;
+  std::shared_ptr<hsql::SQLParserResult> parsed_statement;
+};
+
+// Keyed by the entire SQL string passed to an SQLPipeline, so that strings that were seen before are not parsed again
+// and their statements go straight to the plan caches above. Looking up a string only costs hashing and comparing it,
+// which is much cheaper than parsing long (e.g., generated) SQL strings. The parse results are not modified after
+// parsing and are shared between pipelines. Only strings of SELECT statements are cached, see SQLPipeline.
+using SQLParseTreeCache = Cache<std::shared_ptr<const std::vector<ParsedSQLStatement>>, std::string>;
+
 }  // namespace opossum
@@ -0,0 +1,106 @@
+#include "sql_result_cache.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+void SQLResultCache::resize(const size_t capacity) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.resize(capacity);
+}
+
+size_t SQLResultCache::capacity() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cache.capacity();
+}
+
+std::shared_ptr<const Table> SQLResultCache::try_get(const std::string& sql) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_cache.has(sql)) return nullptr;
+
+  const auto entry = _cache.get(sql);
+  if (!_is_up_to_date(*entry)) {
+    _cache.erase(sql);
+    return nullptr;
+  }
+
+  return entry->result_table;
+}
+
+void SQLResultCache::set(const std::string& sql, const std::shared_ptr<const Table>& result_table,
+                         const std::vector<std::pair<std::string, std::shared_ptr<const Table>>>& tables,
+                         const CommitID snapshot_commit_id) {
+  DebugAssert(result_table, "Only statements with a result can be cached");
+
+  auto entry = std::make_shared<Entry>();
+  entry->result_table = result_table;
+  entry->snapshot_commit_id = snapshot_commit_id;
+  for (const auto& [table_name, table] : tables) {
+    entry->tables.emplace_back(table_name, table);
+  }
+
+  // The entry might be outdated already if a table was modified during the execution
+  if (!_is_up_to_date(*entry)) return;
+
+  const auto memory_usage = static_cast<double>(std::max(result_table->estimate_memory_usage(), size_t{1}));
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_cache.capacity() == 0) return;
+  _cache.set(sql, entry, memory_usage, memory_usage);
+}
+
+size_t SQLResultCache::size() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _cache.size();
+}
+
+void SQLResultCache::clear() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _cache.clear();
+}
+
+std::vector<std::pair<std::string, std::shared_ptr<const Table>>> SQLResultCache::lqp_find_stored_tables(
+    const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto tables = std::vector<std::pair<std::string, std::shared_ptr<const Table>>>{};
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      if (node->type != LQPNodeType::StoredTable) return LQPVisitation::VisitInputs;
+
+      const auto& table_name = std::static_pointer_cast<StoredTableNode>(node)->table_name;
+      const auto table_iter = std::find_if(tables.cbegin(), tables.cend(),
+                                           [&](const auto& table) { return table.first == table_name; });
+      if (table_iter == tables.cend()) tables.emplace_back(table_name, StorageManager::get().get_table(table_name));
+
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return tables;
+}
+
+bool SQLResultCache::_is_up_to_date(const Entry& entry) {
+  const auto& storage_manager = StorageManager::get();
+
+  for (const auto& [table_name, weak_table] : entry.tables) {
+    const auto table = weak_table.lock();
+    if (!table || !storage_manager.has_table(table_name) || storage_manager.get_table(table_name) != table) {
+      return false;
+    }
+
+    if (table->last_modification_commit_id() > entry.snapshot_commit_id) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cache/gdfs_cache.hpp"
+#include "types.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class Table;
+
+/**
+ * Cache for the results of SELECT statements, keyed by the SQL string (like the SQLPhysicalPlanCache). A cached result
+ * is returned only as long as none of the stored tables it was computed from was modified by a transaction that
+ * committed after the result's snapshot (see Table::last_modification_commit_id()), i.e., as long as executing the
+ * statement again would return the same result. Tables that were dropped or replaced invalidate the result as well.
+ *
+ * SQLPipelineStatement consults the cache for statements that run in their own transaction. Modifications that
+ * bypass the transaction management (e.g., Table::append()) are not noticed.
+ *
+ * Entries are evicted by the GDFS policy, using the memory footprint of the result as the entry's size. Thus, large
+ * results are evicted before small ones that are requested as often. The cache is disabled (i.e., has a capacity of
+ * zero entries) by default.
+ */
+class SQLResultCache : public Singleton<SQLResultCache> {
+ public:
+  // Sets the maximum number of cached results, evicting results if necessary. 0 disables the cache.
+  void resize(const size_t capacity);
+  size_t capacity() const;
+
+  // @return the cached result of @param sql, or nullptr if there is none or it is outdated
+  std::shared_ptr<const Table> try_get(const std::string& sql);
+
+  /**
+   * Caches @param result_table for @param sql. It was computed from the stored @param tables (see
+   * lqp_find_stored_tables()) in a transaction with the snapshot @param snapshot_commit_id.
+   */
+  void set(const std::string& sql, const std::shared_ptr<const Table>& result_table,
+           const std::vector<std::pair<std::string, std::shared_ptr<const Table>>>& tables,
+           const CommitID snapshot_commit_id);
+
+  size_t size() const;
+  void clear();
+
+  // @return the names of all stored tables @param lqp reads from, including those read by its subqueries, and the
+  //         tables currently stored under these names
+  static std::vector<std::pair<std::string, std::shared_ptr<const Table>>> lqp_find_stored_tables(
+      const std::shared_ptr<AbstractLQPNode>& lqp);
+
+ protected:
+  friend class Singleton;
+  SQLResultCache() = default;
+
+ private:
+  struct Entry {
+    std::shared_ptr<const Table> result_table;
+    std::vector<std::pair<std::string, std::weak_ptr<const Table>>> tables;
+    CommitID snapshot_commit_id;
+  };
+
+  static bool _is_up_to_date(const Entry& entry);
+
+  mutable std::mutex _mutex;
+  GDFSCache<std::string, std::shared_ptr<const Entry>> _cache{0};
+};
+
+}  // namespace opossum
@@ -0,0 +1,160 @@
+#include "cardinality_feedback.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "operators/abstract_operator.hpp"
+#include "statistics/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+struct OperatorMeasurement {
+  // The operator closest to the root of the PQP, i.e., the one producing the output of the LQP node
+  std::shared_ptr<const AbstractOperator> op;
+  std::chrono::nanoseconds walltime{0};
+};
+
+// Collects, for each LQP node, the measurements of the operators that were translated from it
+void collect_measurements(
+    const std::shared_ptr<const AbstractOperator>& op,
+    std::unordered_set<std::shared_ptr<const AbstractOperator>>& visited_ops,
+    std::unordered_map<std::shared_ptr<AbstractLQPNode>, OperatorMeasurement>& measurement_by_lqp_node) {
+  if (!op || !visited_ops.emplace(op).second) return;
+
+  if (op->lqp_node()) {
+    auto& measurement = measurement_by_lqp_node[op->lqp_node()];
+    if (!measurement.op) measurement.op = op;
+    measurement.walltime += op->performance_data().walltime;
+  }
+
+  collect_measurements(op->input_left(), visited_ops, measurement_by_lqp_node);
+  collect_measurements(op->input_right(), visited_ops, measurement_by_lqp_node);
+}
+
+bool lqp_contains_parameters(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto contains_parameters = false;
+
+  visit_lqp(lqp, [&](const auto& node) {
+    for (const auto& node_expression : node->node_expressions) {
+      visit_expression(node_expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::Placeholder ||
+            sub_expression->type == ExpressionType::CorrelatedParameter) {
+          contains_parameters = true;
+        } else if (sub_expression->type == ExpressionType::LQPSubquery) {
+          const auto& subquery_expression = static_cast<const LQPSubqueryExpression&>(*sub_expression);
+          contains_parameters |= lqp_contains_parameters(subquery_expression.lqp);
+        }
+
+        return contains_parameters ? ExpressionVisitation::DoNotVisitArguments : ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return contains_parameters ? LQPVisitation::DoNotVisitInputs : LQPVisitation::VisitInputs;
+  });
+
+  return contains_parameters;
+}
+
+}  // namespace
+
+namespace opossum {
+
+void CardinalityFeedback::set_enabled(const bool enabled) { _enabled = enabled; }
+
+bool CardinalityFeedback::is_enabled() const { return _enabled; }
+
+void CardinalityFeedback::set_q_error_threshold(const float q_error_threshold) {
+  Assert(q_error_threshold >= 1.0f, "A q-error is never below 1");
+  _q_error_threshold = q_error_threshold;
+}
+
+float CardinalityFeedback::q_error_threshold() const { return _q_error_threshold; }
+
+float CardinalityFeedback::record(const std::shared_ptr<const AbstractOperator>& pqp) {
+  auto visited_ops = std::unordered_set<std::shared_ptr<const AbstractOperator>>{};
+  auto measurement_by_lqp_node = std::unordered_map<std::shared_ptr<AbstractLQPNode>, OperatorMeasurement>{};
+  collect_measurements(pqp, visited_ops, measurement_by_lqp_node);
+
+  // Estimate the cardinalities before any of them is updated. This needs to happen without holding the lock, since
+  // get_statistics() calls apply().
+  auto max_q_error = 1.0f;
+  auto new_entries = std::vector<std::pair<std::shared_ptr<AbstractLQPNode>, Entry>>{};
+
+  for (auto& [lqp_node, measurement] : measurement_by_lqp_node) {
+    if (!_is_recorded_node_type(lqp_node->type)) continue;
+
+    // Operators that were not executed (e.g., because the transaction was aborted) have no walltime
+    const auto& performance_data = measurement.op->performance_data();
+    if (performance_data.walltime.count() == 0) continue;
+
+    if (lqp_contains_parameters(lqp_node)) continue;
+
+    const auto actual_row_count = static_cast<float>(performance_data.output_row_count);
+    const auto estimated_row_count = std::max(lqp_node->get_statistics()->row_count(), 1.0f);
+    const auto q_error = std::max(estimated_row_count / std::max(actual_row_count, 1.0f),
+                                  std::max(actual_row_count, 1.0f) / estimated_row_count);
+    max_q_error = std::max(max_q_error, q_error);
+
+    // The subplan is copied, so that the key is not affected by changes to the executed LQP
+    new_entries.emplace_back(lqp_node->deep_copy(), Entry{actual_row_count, measurement.walltime});
+  }
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  for (auto& [lqp, entry] : new_entries) {
+    const auto entry_iter = _entries.find(lqp);
+    if (entry_iter != _entries.end()) {
+      entry_iter->second = entry;
+    } else if (_entries.size() < DEFAULT_CAPACITY) {
+      _entries.emplace(std::move(lqp), entry);
+    }
+  }
+  _entry_count = _entries.size();
+
+  return max_q_error;
+}
+
+std::optional<CardinalityFeedback::Entry> CardinalityFeedback::lookup(
+    const std::shared_ptr<AbstractLQPNode>& lqp) const {
+  if (_entry_count == 0) return std::nullopt;
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  const auto entry_iter = _entries.find(lqp);
+  if (entry_iter == _entries.end()) return std::nullopt;
+  return entry_iter->second;
+}
+
+std::shared_ptr<TableStatistics> CardinalityFeedback::apply(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                                            const std::shared_ptr<TableStatistics>& statistics) const {
+  if (!_enabled || _entry_count == 0 || !_is_recorded_node_type(lqp->type)) return statistics;
+
+  const auto entry = lookup(lqp);
+  if (!entry) return statistics;
+
+  // The ColumnStatistics are kept, so that predicates further up are still estimated based on the value distributions
+  return std::make_shared<TableStatistics>(statistics->table_type(), entry->row_count,
+                                           statistics->column_statistics());
+}
+
+size_t CardinalityFeedback::size() const { return _entry_count; }
+
+void CardinalityFeedback::clear() {
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _entries.clear();
+  _entry_count = 0;
+}
+
+bool CardinalityFeedback::_is_recorded_node_type(const LQPNodeType node_type) {
+  return node_type == LQPNodeType::Predicate || node_type == LQPNodeType::Join || node_type == LQPNodeType::Aggregate ||
+         node_type == LQPNodeType::Union || node_type == LQPNodeType::Validate;
+}
+
+}  // namespace opossum
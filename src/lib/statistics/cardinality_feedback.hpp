@@ -0,0 +1,86 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "utils/singleton.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class TableStatistics;
+
+/**
+ * Store for the actual cardinalities (and runtimes) of executed LQP subplans, so that the optimizer uses them instead
+ * of the estimations the next time it encounters the same subplan. Subplans are identified via AbstractLQPNode::hash()
+ * and AbstractLQPNode::operator==, i.e., a subplan of a different query matches as well if it is equal.
+ *
+ * SQLPipelineStatement records the cardinalities after executing a query. If any estimation of the plan was off by
+ * more than q_error_threshold(), the cached plans of the query are evicted, so that it is re-optimized with the
+ * recorded cardinalities on its next execution. AbstractLQPNode::get_statistics() consults the store.
+ *
+ * Subplans containing placeholders or correlated parameters are not recorded, since their cardinality depends on the
+ * parameter values. The feedback is disabled by default.
+ */
+class CardinalityFeedback : public Singleton<CardinalityFeedback> {
+ public:
+  struct Entry {
+    float row_count{0.0f};
+
+    // Sum of the walltimes of the operators the subplan's root node was translated into
+    std::chrono::nanoseconds walltime{0};
+  };
+
+  static constexpr auto DEFAULT_Q_ERROR_THRESHOLD = 10.0f;
+  static constexpr auto DEFAULT_CAPACITY = size_t{10'000};
+
+  void set_enabled(const bool enabled);
+  bool is_enabled() const;
+
+  void set_q_error_threshold(const float q_error_threshold);
+  float q_error_threshold() const;
+
+  /**
+   * Records the actual row counts and walltimes of all executed operators in @param pqp that were translated from a
+   * Predicate-, Join-, Aggregate-, Union- or ValidateNode. Once DEFAULT_CAPACITY subplans are stored, only the entries
+   * of already known subplans are updated.
+   * @return  the highest q-error (max(estimated / actual, actual / estimated)) of the cardinality estimations of these
+   *          operators, as the optimizer saw them before recording; 1.0 if nothing was recorded
+   */
+  float record(const std::shared_ptr<const AbstractOperator>& pqp);
+
+  std::optional<Entry> lookup(const std::shared_ptr<AbstractLQPNode>& lqp) const;
+
+  /**
+   * @return @param statistics with the recorded row count of @param lqp, or @param statistics unchanged if nothing was
+   *         recorded for it
+   */
+  std::shared_ptr<TableStatistics> apply(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                         const std::shared_ptr<TableStatistics>& statistics) const;
+
+  size_t size() const;
+  void clear();
+
+ protected:
+  friend class Singleton;
+  CardinalityFeedback() = default;
+
+ private:
+  static bool _is_recorded_node_type(const LQPNodeType node_type);
+
+  std::atomic_bool _enabled{false};
+  std::atomic<float> _q_error_threshold{DEFAULT_Q_ERROR_THRESHOLD};
+
+  // Checked before locking the mutex, so that get_statistics() is not slowed down while the store is empty
+  std::atomic<size_t> _entry_count{0};
+
+  mutable std::shared_mutex _mutex;
+  std::unordered_map<std::shared_ptr<AbstractLQPNode>, Entry, LQPNodeSharedPtrHash, LQPNodeSharedPtrEqual> _entries;
+};
+
+}  // namespace opossum
@@ -163,6 +163,61 @@ double AbstractHistogram<T>::_share_of_bin_less_than_value(const BinID bin_id, c
   }
 }
 
+template <typename T>
+double AbstractHistogram<T>::_share_of_bin_between_values(const BinID bin_id, const T& value_min,
+                                                          const T& value_max) const {
+  if (value_max < value_min) return 0.0;
+
+  const auto share_below_min =
+      value_min <= _bin_minimum(bin_id) ? 0.0 : _share_of_bin_less_than_value(bin_id, value_min);
+  const auto share_up_to_max =
+      value_max >= _bin_maximum(bin_id) ? 1.0 : _share_of_bin_less_than_value(bin_id, _get_next_value(value_max));
+
+  return std::clamp(share_up_to_max - share_below_min, 0.0, 1.0);
+}
+
+template <typename T>
+float AbstractHistogram<T>::estimate_equi_join_cardinality(const AbstractHistogram<T>& right_histogram,
+                                                           const float left_distinct_scale,
+                                                           const float right_distinct_scale) const {
+  auto cardinality = 0.0;
+
+  // Both histograms are sorted by their bins, so we can walk through them like a merge join
+  auto left_bin_id = BinID{0};
+  auto right_bin_id = BinID{0};
+
+  while (left_bin_id < bin_count() && right_bin_id < right_histogram.bin_count()) {
+    const auto left_bin_max = _bin_maximum(left_bin_id);
+    const auto right_bin_max = right_histogram._bin_maximum(right_bin_id);
+
+    const auto overlap_min = std::max(_bin_minimum(left_bin_id), right_histogram._bin_minimum(right_bin_id));
+    const auto overlap_max = std::min(left_bin_max, right_bin_max);
+
+    if (overlap_min <= overlap_max) {
+      const auto left_share = _share_of_bin_between_values(left_bin_id, overlap_min, overlap_max);
+      const auto right_share = right_histogram._share_of_bin_between_values(right_bin_id, overlap_min, overlap_max);
+
+      const auto left_height = left_share * _bin_height(left_bin_id);
+      const auto right_height = right_share * right_histogram._bin_height(right_bin_id);
+
+      if (left_height > 0.0 && right_height > 0.0) {
+        const auto left_distinct_count =
+            std::max(left_share * _bin_distinct_count(left_bin_id) * left_distinct_scale, 1.0);
+        const auto right_distinct_count = std::max(
+            right_share * right_histogram._bin_distinct_count(right_bin_id) * right_distinct_scale, 1.0);
+
+        cardinality += left_height * right_height / std::max(left_distinct_count, right_distinct_count);
+      }
+    }
+
+    // Advance the bin(s) that end first
+    if (!(right_bin_max < left_bin_max)) ++left_bin_id;
+    if (!(left_bin_max < right_bin_max)) ++right_bin_id;
+  }
+
+  return static_cast<float>(cardinality);
+}
+
 template <typename T>
 bool AbstractHistogram<T>::_can_prune(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                                       const std::optional<AllTypeVariant>& variant_value2) const {
@@ -90,6 +90,19 @@ class AbstractHistogram : public AbstractFilter {
   float estimate_cardinality(const PredicateCondition predicate_type, const AllTypeVariant& variant_value,
                              const std::optional<AllTypeVariant>& variant_value2 = std::nullopt) const;
 
+  /**
+   * Returns the estimated cardinality of an equi-join between the values represented by this histogram and the values
+   * represented by @param right_histogram. It is estimated by aligning the bins of both histograms: Within the
+   * overlapping range of two bins, values are assumed to be distributed uniformly and the distinct values of the side
+   * with fewer distinct values are assumed to find a join partner.
+   * If a histogram was built from a sample, its distinct counts underestimate those of the entire column. The
+   * distinct scale factors (i.e., the distinct count of the column divided by the distinct count of the histogram)
+   * compensate for this. The result refers to the number of values represented by the histograms, not by the columns.
+   */
+  float estimate_equi_join_cardinality(const AbstractHistogram<T>& right_histogram,
+                                       const float left_distinct_scale = 1.0f,
+                                       const float right_distinct_scale = 1.0f) const;
+
   /**
    * Returns whether a given predicate type and its parameter(s) can be pruned.
    * This method is specialized for strings to handle predicates uniquely applicable to string columns.
@@ -173,6 +186,11 @@ class AbstractHistogram : public AbstractFilter {
    */
   double _share_of_bin_less_than_value(const BinID bin_id, const T value) const;
 
+  /**
+   * Returns the share of values in a bin that are in the range [value_min, value_max].
+   */
+  double _share_of_bin_between_values(const BinID bin_id, const T& value_min, const T& value_max) const;
+
   /**
    * Returns the width of a bin.
    * This method is specialized for strings to return a numerical width.
@@ -113,7 +113,13 @@ std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::
     const std::shared_ptr<const BaseSegment>& segment, const BinID max_bin_count,
     const std::optional<std::string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
   const auto value_counts = AbstractHistogram<T>::_gather_value_distribution(segment);
+  return from_value_distribution(value_counts, max_bin_count, supported_characters, string_prefix_length);
+}
 
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_value_distribution(
+    const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+    const std::optional<std::string>& supported_characters, const std::optional<uint32_t>& string_prefix_length) {
   if (value_counts.empty()) {
     return nullptr;
   }
@@ -62,6 +62,16 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
       const std::optional<std::string>& supported_characters = std::nullopt,
       const std::optional<uint32_t>& string_prefix_length = std::nullopt);
 
+  /**
+   * Create a histogram based on a list of distinct values and their number of occurrences, sorted by value.
+   * This is used to build histograms for data that is not stored in a single segment, e.g., for a sample of a table's
+   * column. Returns nullptr if value_counts is empty. For the other parameters, see from_segment().
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_value_distribution(
+      const std::vector<std::pair<T, HistogramCountType>>& value_counts, const BinID max_bin_count,
+      const std::optional<std::string>& supported_characters = std::nullopt,
+      const std::optional<uint32_t>& string_prefix_length = std::nullopt);
+
   HistogramType histogram_type() const override;
   std::string histogram_name() const override;
   HistogramCountType total_distinct_count() const override;
@@ -1,7 +1,11 @@
 #include "column_statistics.hpp"
 
+#include <algorithm>
 #include <sstream>
 
+#include "chunk_statistics/histograms/abstract_histogram.hpp"
+#include "chunk_statistics/histograms/histogram_utils.hpp"
+#include "expression/evaluation/like_matcher.hpp"
 #include "resolve_type.hpp"
 #include "table_statistics.hpp"
 #include "type_cast.hpp"
@@ -18,15 +22,37 @@ ColumnDataType ColumnStatistics<ColumnDataType>::max() const {
   return _max;
 }
 
+template <typename ColumnDataType>
+const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& ColumnStatistics<ColumnDataType>::histogram() const {
+  return _histogram;
+}
+
 template <typename ColumnDataType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnDataType>::clone() const {
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max);
+  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio(), distinct_count(), _min, _max,
+                                                            _histogram);
 }
 
 template <typename ColumnDataType>
 FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_value(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
+  // The histogram only gives us a better selectivity. The min/max based estimation is still used to narrow down the
+  // statistics of the output column.
+  auto estimate = _estimate_predicate_with_value_without_histogram(predicate_condition, variant_value, value2);
+
+  if (const auto histogram_selectivity =
+          _estimate_selectivity_with_histogram(predicate_condition, variant_value, value2)) {
+    estimate.selectivity = *histogram_selectivity;
+  }
+
+  return estimate;
+}
+
+template <typename ColumnDataType>
+FilterByValueEstimate ColumnStatistics<ColumnDataType>::_estimate_predicate_with_value_without_histogram(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
   const auto value = type_cast_variant<ColumnDataType>(variant_value);
 
   switch (predicate_condition) {
@@ -79,7 +105,7 @@ FilterByValueEstimate ColumnStatistics<ColumnDataType>::estimate_predicate_with_
  * Specialization for strings as they cannot be used in subtractions.
  */
 template <>
-FilterByValueEstimate ColumnStatistics<std::string>::estimate_predicate_with_value(
+FilterByValueEstimate ColumnStatistics<std::string>::_estimate_predicate_with_value_without_histogram(
     const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
     const std::optional<AllTypeVariant>& value2) const {
   // if column has no distinct values, it can only have null values which cannot be selected with this predicate
@@ -95,6 +121,12 @@ FilterByValueEstimate ColumnStatistics<std::string>::estimate_predicate_with_val
     case PredicateCondition::NotEquals: {
       return estimate_not_equals_with_value(casted_value);
     }
+    case PredicateCondition::Like: {
+      return {non_null_value_ratio() * TableStatistics::DEFAULT_LIKE_SELECTIVITY, without_null_values()};
+    }
+    case PredicateCondition::NotLike: {
+      return {non_null_value_ratio() * (1.0f - TableStatistics::DEFAULT_LIKE_SELECTIVITY), without_null_values()};
+    }
     // TODO(anybody) implement other table-scan operators for string.
     default: { return {non_null_value_ratio(), without_null_values()}; }
   }
@@ -297,7 +329,9 @@ FilterByColumnComparisonEstimate ColumnStatistics<ColumnDataType>::estimate_pred
                                                                       overlapping_range_min, overlapping_range_max);
       auto new_right_column_stats = std::make_shared<ColumnStatistics>(0.0f, overlapping_distinct_count,
                                                                        overlapping_range_min, overlapping_range_max);
-      return {combined_non_null_ratio * equal_values_ratio, new_left_column_stats, new_right_column_stats};
+      const auto selectivity = _estimate_equi_join_selectivity_with_histograms(right_column_statistics)
+                                   .value_or(combined_non_null_ratio * equal_values_ratio);
+      return {selectivity, new_left_column_stats, new_right_column_stats};
     }
     case PredicateCondition::NotEquals: {
       auto new_left_column_stats = std::make_shared<ColumnStatistics>(0.0f, distinct_count(), _min, _max);
@@ -342,10 +376,89 @@ FilterByColumnComparisonEstimate ColumnStatistics<std::string>::estimate_predica
     return {0.f, without_null_values(), right_column_statistics.without_null_values()};
   }
 
+  if (predicate_condition == PredicateCondition::Equals) {
+    if (const auto selectivity = _estimate_equi_join_selectivity_with_histograms(right_column_statistics)) {
+      return {*selectivity, without_null_values(), right_column_statistics.without_null_values()};
+    }
+  }
+
   return {non_null_value_ratio() * right_column_statistics.non_null_value_ratio(), without_null_values(),
           right_column_statistics.without_null_values()};
 }
 
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_selectivity_with_histogram(
+    const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+    const std::optional<AllTypeVariant>& value2) const {
+  if (!_histogram || distinct_count() == 0.0f) return std::nullopt;
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      break;
+    case PredicateCondition::Like:
+    case PredicateCondition::NotLike:
+      if (!std::is_same_v<ColumnDataType, std::string>) return std::nullopt;
+      break;
+    default:
+      return std::nullopt;
+  }
+
+  if (variant_is_null(variant_value) || (value2 && variant_is_null(*value2))) return std::nullopt;
+
+  if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+    // String histograms only support a certain set of characters. For all other values, we fall back to the min/max
+    // based estimation. The histogram does not handle single character wildcards well, so we fall back for those, too.
+    static const auto supported_characters = histogram::get_default_or_check_string_histogram_prefix_settings().first;
+    const auto is_like = predicate_condition == PredicateCondition::Like ||
+                         predicate_condition == PredicateCondition::NotLike;
+    const auto allowed_characters = supported_characters + (is_like ? "%" : "");
+
+    const auto value = type_cast_variant<std::string>(variant_value);
+    if (value.empty() || value.find_first_not_of(allowed_characters) != std::string::npos) return std::nullopt;
+    if (value2 && type_cast_variant<std::string>(*value2).find_first_not_of(allowed_characters) != std::string::npos) {
+      return std::nullopt;
+    }
+  }
+
+  auto selectivity = _histogram->estimate_selectivity(predicate_condition, variant_value, value2);
+
+  // If the histogram was built from a sample, it has seen fewer distinct values than there are in the column. This
+  // makes the estimations for single values too high, so we scale them down.
+  const auto distinct_scale = static_cast<float>(_histogram->total_distinct_count()) / distinct_count();
+  if (predicate_condition == PredicateCondition::Equals) {
+    selectivity *= distinct_scale;
+  } else if (predicate_condition == PredicateCondition::NotEquals) {
+    selectivity = 1.0f - (1.0f - selectivity) * distinct_scale;
+  }
+
+  return non_null_value_ratio() * std::clamp(selectivity, 0.0f, 1.0f);
+}
+
+template <typename ColumnDataType>
+std::optional<float> ColumnStatistics<ColumnDataType>::_estimate_equi_join_selectivity_with_histograms(
+    const ColumnStatistics<ColumnDataType>& right_column_statistics) const {
+  const auto& right_histogram = right_column_statistics._histogram;
+  if (!_histogram || !right_histogram) return std::nullopt;
+  if (distinct_count() == 0.0f || right_column_statistics.distinct_count() == 0.0f) return std::nullopt;
+
+  const auto left_distinct_scale = distinct_count() / static_cast<float>(_histogram->total_distinct_count());
+  const auto right_distinct_scale =
+      right_column_statistics.distinct_count() / static_cast<float>(right_histogram->total_distinct_count());
+
+  const auto cardinality =
+      _histogram->estimate_equi_join_cardinality(*right_histogram, left_distinct_scale, right_distinct_scale);
+  const auto selectivity = cardinality / (static_cast<float>(_histogram->total_count()) *
+                                          static_cast<float>(right_histogram->total_count()));
+
+  return non_null_value_ratio() * right_column_statistics.non_null_value_ratio() * std::clamp(selectivity, 0.0f, 1.0f);
+}
+
 template <typename ColumnDataType>
 std::string ColumnStatistics<ColumnDataType>::description() const {
   std::stringstream stream;
@@ -11,17 +11,26 @@
 
 namespace opossum {
 
+template <typename T>
+class AbstractHistogram;
+
 /**
  * @tparam ColumnDataType   the DataType of the values in the Column that these statistics represent
+ *
+ * Optionally, the statistics hold a histogram of the (non-null) values in the column. If present, it is used instead
+ * of the min/max/distinct count based assumptions to estimate the selectivity of predicates with values and of
+ * equi-joins. The histogram may be built from a sample of the column (see ColumnStatisticsSketch).
  */
 template <typename ColumnDataType>
 class ColumnStatistics : public BaseColumnStatistics {
  public:
   ColumnStatistics(const float null_value_ratio, const float distinct_count, const ColumnDataType min,
-                   const ColumnDataType max)
+                   const ColumnDataType max,
+                   const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram = nullptr)
       : BaseColumnStatistics(data_type_from_type<ColumnDataType>(), null_value_ratio, distinct_count),
         _min(min),
-        _max(max) {
+        _max(max),
+        _histogram(histogram) {
     Assert(null_value_ratio >= 0.0f && null_value_ratio <= 1.0f, "NullValueRatio out of range");
   }
 
@@ -40,6 +49,7 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnDataType min() const;
   ColumnDataType max() const;
+  const std::shared_ptr<const AbstractHistogram<ColumnDataType>>& histogram() const;
   /** @} */
 
   /**
@@ -89,8 +99,21 @@ class ColumnStatistics : public BaseColumnStatistics {
   /** @} */
 
  private:
+  // The part of estimate_predicate_with_value() that relies on min/max/distinct count only
+  FilterByValueEstimate _estimate_predicate_with_value_without_histogram(
+      const PredicateCondition predicate_condition, const AllTypeVariant& variant_value,
+      const std::optional<AllTypeVariant>& value2) const;
+
+  // Returns std::nullopt if there is no histogram or it cannot handle the predicate
+  std::optional<float> _estimate_selectivity_with_histogram(const PredicateCondition predicate_condition,
+                                                            const AllTypeVariant& variant_value,
+                                                            const std::optional<AllTypeVariant>& value2) const;
+  std::optional<float> _estimate_equi_join_selectivity_with_histograms(
+      const ColumnStatistics<ColumnDataType>& right_column_statistics) const;
+
   ColumnDataType _min;
   ColumnDataType _max;
+  std::shared_ptr<const AbstractHistogram<ColumnDataType>> _histogram;
 };
 
 }  // namespace opossum
@@ -0,0 +1,232 @@
+#include "column_statistics_sketch.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "chunk_statistics/histograms/histogram_utils.hpp"
+#include "column_statistics.hpp"
+#include "generate_column_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterate.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+template <typename T>
+void ColumnStatisticsSketch<T>::add_segment(const BaseSegment& segment, const size_t seed) {
+  const auto segment_row_count = static_cast<ChunkOffset>(segment.size());
+  if (segment_row_count == 0) return;
+
+  auto segment_sketch = ColumnStatisticsSketch<T>{};
+  segment_sketch._row_count = segment_row_count;
+
+  // Choose the sampled blocks. Small segments are sampled entirely.
+  const auto block_count = (segment_row_count + SAMPLE_BLOCK_SIZE - 1) / SAMPLE_BLOCK_SIZE;
+  auto block_is_sampled = std::vector<bool>(block_count, true);
+  auto sampled_row_count = segment_row_count;
+
+  if (segment_row_count > SEGMENT_SAMPLE_SIZE) {
+    auto block_ids = std::vector<ChunkOffset>(block_count);
+    std::iota(block_ids.begin(), block_ids.end(), ChunkOffset{0});
+    std::shuffle(block_ids.begin(), block_ids.end(), std::mt19937{static_cast<std::mt19937::result_type>(seed)});
+
+    std::fill(block_is_sampled.begin(), block_is_sampled.end(), false);
+    sampled_row_count = 0;
+    for (auto block_idx = ChunkOffset{0}; block_idx < SEGMENT_SAMPLE_SIZE / SAMPLE_BLOCK_SIZE; ++block_idx) {
+      const auto block_id = block_ids[block_idx];
+      block_is_sampled[block_id] = true;
+      sampled_row_count += std::min(SAMPLE_BLOCK_SIZE, segment_row_count - block_id * SAMPLE_BLOCK_SIZE);
+    }
+  }
+
+  segment_sketch._sample_rate = static_cast<double>(sampled_row_count) / static_cast<double>(segment_row_count);
+
+  if (const auto dictionary_segment = dynamic_cast<const DictionarySegment<T>*>(&segment)) {
+    // The dictionary contains each distinct value once and is sorted, so the rows only need to be looked at for the
+    // sample
+    const auto& dictionary = *dictionary_segment->dictionary();
+    for (const auto& value : dictionary) {
+      segment_sketch._hyper_log_log.add(value);
+    }
+    if (!dictionary.empty()) {
+      segment_sketch._min = dictionary.front();
+      segment_sketch._max = dictionary.back();
+    }
+
+    auto sampled_positions = std::make_shared<PosList>();
+    sampled_positions->guarantee_single_chunk();
+    sampled_positions->reserve(sampled_row_count);
+    for (auto block_id = ChunkOffset{0}; block_id < block_count; ++block_id) {
+      if (!block_is_sampled[block_id]) continue;
+
+      const auto block_end = std::min(segment_row_count, (block_id + 1) * SAMPLE_BLOCK_SIZE);
+      for (auto chunk_offset = block_id * SAMPLE_BLOCK_SIZE; chunk_offset < block_end; ++chunk_offset) {
+        sampled_positions->emplace_back(RowID{ChunkID{0}, chunk_offset});
+      }
+    }
+
+    auto sampled_null_value_count = size_t{0};
+    segment_iterate_filtered<T>(segment, sampled_positions, [&](const auto& position) {
+      if (position.is_null()) {
+        ++sampled_null_value_count;
+      } else {
+        segment_sketch._add_sampled_value(position.value());
+      }
+    });
+
+    segment_sketch._null_value_count =
+        static_cast<float>(static_cast<double>(sampled_null_value_count) / segment_sketch._sample_rate);
+  } else {
+    auto null_value_count = size_t{0};
+    segment_iterate<T>(segment, [&](const auto& position) {
+      if (position.is_null()) {
+        ++null_value_count;
+        return;
+      }
+
+      const auto& value = position.value();
+      segment_sketch._hyper_log_log.add(value);
+      if (!segment_sketch._min || value < *segment_sketch._min) segment_sketch._min = value;
+      if (!segment_sketch._max || value > *segment_sketch._max) segment_sketch._max = value;
+
+      if (block_is_sampled[position.chunk_offset() / SAMPLE_BLOCK_SIZE]) segment_sketch._add_sampled_value(value);
+    });
+
+    segment_sketch._null_value_count = static_cast<float>(null_value_count);
+  }
+
+  merge(segment_sketch);
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::merge(const BaseColumnStatisticsSketch& base_other) {
+  DebugAssert(dynamic_cast<const ColumnStatisticsSketch<T>*>(&base_other), "Cannot merge sketches of different types");
+  const auto& other = static_cast<const ColumnStatisticsSketch<T>&>(base_other);
+
+  _row_count += other._row_count;
+  _null_value_count += other._null_value_count;
+  _hyper_log_log.merge(other._hyper_log_log);
+  if (other._min && (!_min || *other._min < *_min)) _min = other._min;
+  if (other._max && (!_max || *other._max > *_max)) _max = other._max;
+
+  _histogram_is_supported &= other._histogram_is_supported;
+  if (!_histogram_is_supported) {
+    _sampled_value_counts.clear();
+    _sampled_row_count = 0;
+    return;
+  }
+
+  // Bring both samples to the lower sampling rate before adding them up. Only the (usually small) sample of other is
+  // thinned, unless this sketch is the one with the higher rate.
+  auto other_sample = ColumnStatisticsSketch<T>{};
+  other_sample._sampled_value_counts = other._sampled_value_counts;
+  other_sample._sampled_row_count = other._sampled_row_count;
+  other_sample._sample_rate = other._sample_rate;
+
+  const auto merged_sample_rate = std::min(_sample_rate, other._sample_rate);
+  if (_sample_rate > merged_sample_rate) _thin_sample(merged_sample_rate / _sample_rate);
+  if (other_sample._sample_rate > merged_sample_rate) {
+    other_sample._thin_sample(merged_sample_rate / other_sample._sample_rate);
+  }
+
+  for (const auto& [value, count] : other_sample._sampled_value_counts) {
+    _sampled_value_counts[value] += count;
+  }
+  _sampled_row_count += other_sample._sampled_row_count;
+  _sample_rate = merged_sample_rate;
+
+  while (_sampled_row_count > 2 * HISTOGRAM_SAMPLE_SIZE) {
+    _thin_sample(0.5);
+  }
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnStatisticsSketch> ColumnStatisticsSketch<T>::clone() const {
+  return std::make_shared<ColumnStatisticsSketch<T>>(*this);
+}
+
+template <typename T>
+std::shared_ptr<BaseColumnStatistics> ColumnStatisticsSketch<T>::to_column_statistics() const {
+  const auto row_count = static_cast<float>(_row_count);
+  const auto null_value_ratio = _row_count > 0 ? std::min(_null_value_count / row_count, 1.0f) : 0.0f;
+
+  // In contrast to the exact distinct count, the HyperLogLog's estimation may exceed the number of non-null values
+  const auto distinct_count = std::min(_hyper_log_log.distinct_count(), std::max(row_count - _null_value_count, 0.0f));
+
+  const auto histogram = _row_count >= HISTOGRAM_MIN_ROW_COUNT && _histogram_is_supported
+                             ? generate_column_histogram(_sampled_value_counts)
+                             : nullptr;
+
+  if (!_min) {
+    if constexpr (std::is_same_v<T, std::string>) {
+      return std::make_shared<ColumnStatistics<T>>(null_value_ratio, distinct_count, T{}, T{}, histogram);
+    } else {
+      return std::make_shared<ColumnStatistics<T>>(null_value_ratio, distinct_count, std::numeric_limits<T>::min(),
+                                                   std::numeric_limits<T>::max(), histogram);
+    }
+  }
+
+  return std::make_shared<ColumnStatistics<T>>(null_value_ratio, distinct_count, *_min, *_max, histogram);
+}
+
+template <typename T>
+size_t ColumnStatisticsSketch<T>::row_count() const {
+  return _row_count;
+}
+
+template <typename T>
+double ColumnStatisticsSketch<T>::sample_rate() const {
+  return _sample_rate;
+}
+
+template <typename T>
+const std::map<T, HistogramCountType>& ColumnStatisticsSketch<T>::sampled_value_counts() const {
+  return _sampled_value_counts;
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::_add_sampled_value(const T& value) {
+  if (!_histogram_is_supported) return;
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    static const auto supported_characters = histogram::get_default_or_check_string_histogram_prefix_settings().first;
+    if (value.empty() || value.find_first_not_of(supported_characters) != std::string::npos) {
+      _histogram_is_supported = false;
+      _sampled_value_counts.clear();
+      _sampled_row_count = 0;
+      return;
+    }
+  }
+
+  ++_sampled_value_counts[value];
+  ++_sampled_row_count;
+}
+
+template <typename T>
+void ColumnStatisticsSketch<T>::_thin_sample(const double keep_ratio) {
+  // A fixed seed keeps the statistics (and thus the plans) reproducible
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(_sampled_row_count)};
+
+  _sampled_row_count = 0;
+  for (auto iter = _sampled_value_counts.begin(); iter != _sampled_value_counts.end();) {
+    iter->second = std::binomial_distribution<HistogramCountType>{iter->second, keep_ratio}(generator);
+    _sampled_row_count += iter->second;
+
+    if (iter->second == 0) {
+      iter = _sampled_value_counts.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+
+  _sample_rate *= keep_ratio;
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(ColumnStatisticsSketch);
+
+}  // namespace opossum
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+
+#include "hyper_log_log.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatistics;
+class BaseSegment;
+
+/**
+ * Mergeable summary of the values of a column, from which its ColumnStatistics are built. The sketch of a column is
+ * the merge of the sketches of its segments, so that the statistics of a table can be updated when chunks are added
+ * without looking at the existing chunks again (see TableStatisticsSketch).
+ */
+class BaseColumnStatisticsSketch {
+ public:
+  virtual ~BaseColumnStatisticsSketch() = default;
+
+  // @param seed determines the rows sampled from the segment, so that the sketch of a segment is reproducible
+  virtual void add_segment(const BaseSegment& segment, const size_t seed) = 0;
+
+  virtual void merge(const BaseColumnStatisticsSketch& other) = 0;
+
+  virtual std::shared_ptr<BaseColumnStatisticsSketch> clone() const = 0;
+
+  virtual std::shared_ptr<BaseColumnStatistics> to_column_statistics() const = 0;
+};
+
+/**
+ * Of each segment, a random sample of blocks of SAMPLE_BLOCK_SIZE consecutive rows (SEGMENT_SAMPLE_SIZE rows in
+ * total) is taken. Sampling blocks instead of single rows keeps the accesses to the segment sequential. The sample is
+ * used for the histogram and, for DictionarySegments, for the null value ratio. The distinct count is estimated with a
+ * HyperLogLog, which is fed from the dictionary for DictionarySegments, so that their rows are not scanned. For other
+ * segments, all rows are scanned for the distinct count, min/max, and the null value ratio.
+ *
+ * Merging sketches with different sampling rates thins the sample with the higher rate, so that the histogram is not
+ * skewed towards small segments. The merged sample is halved whenever it grows beyond 2 * HISTOGRAM_SAMPLE_SIZE rows.
+ */
+template <typename T>
+class ColumnStatisticsSketch : public BaseColumnStatisticsSketch {
+ public:
+  static constexpr auto SAMPLE_BLOCK_SIZE = ChunkOffset{1'000};
+  static constexpr auto SEGMENT_SAMPLE_SIZE = ChunkOffset{10'000};
+
+  void add_segment(const BaseSegment& segment, const size_t seed) override;
+  void merge(const BaseColumnStatisticsSketch& other) override;
+  std::shared_ptr<BaseColumnStatisticsSketch> clone() const override;
+  std::shared_ptr<BaseColumnStatistics> to_column_statistics() const override;
+
+  size_t row_count() const;
+  double sample_rate() const;
+  const std::map<T, HistogramCountType>& sampled_value_counts() const;
+
+ private:
+  void _add_sampled_value(const T& value);
+
+  // Keeps each sampled row with the probability @param keep_ratio
+  void _thin_sample(const double keep_ratio);
+
+  size_t _row_count{0};
+  float _null_value_count{0.0f};
+  HyperLogLog _hyper_log_log;
+  std::optional<T> _min;
+  std::optional<T> _max;
+
+  // Fraction of the rows that are represented by _sampled_value_counts
+  double _sample_rate{1.0};
+  size_t _sampled_row_count{0};
+  std::map<T, HistogramCountType> _sampled_value_counts;
+
+  // String histograms only support a limited set of characters
+  bool _histogram_is_supported{true};
+};
+
+}  // namespace opossum
@@ -1,64 +1,35 @@
 #pragma once
 
-#include <boost/container/pmr/monotonic_buffer_resource.hpp>
-#include <boost/container/scoped_allocator.hpp>
-#include <unordered_set>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
 
-#include "base_column_statistics.hpp"
-#include "column_statistics.hpp"
-#include "resolve_type.hpp"
-#include "storage/segment_iterate.hpp"
-#include "storage/table.hpp"
+#include "chunk_statistics/histograms/equal_distinct_count_histogram.hpp"
 
 namespace opossum {
 
-/**
- * Generate the statistics of a single column. Used by generate_table_statistics()
- */
-template <typename ColumnDataType>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics(const Table& table, const ColumnID column_id) {
-  // distinct_set is thrown away at the end of this method, so we don't want proper heap allocations for the strings
-  // stored within. The initial size of the buffer is a completely random guess, but better than zero.
-
-  auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(table.row_count() * sizeof(ColumnDataType));
-  auto distinct_set =
-      std::unordered_set<ColumnDataType, std::hash<ColumnDataType>, std::equal_to<ColumnDataType>,
-                         PolymorphicAllocator<ColumnDataType>>(PolymorphicAllocator<ColumnDataType>{&temp_buffer});
-  distinct_set.reserve(table.row_count());
-
-  auto null_value_count = size_t{0};
-
-  auto min = std::numeric_limits<ColumnDataType>::max();
-  auto max = std::numeric_limits<ColumnDataType>::lowest();
+// Histograms are only built for tables with at least HISTOGRAM_MIN_ROW_COUNT rows. For smaller tables, the estimations
+// based on min/max/distinct count are good enough and building the histogram is not worth it.
+constexpr auto HISTOGRAM_MIN_ROW_COUNT = size_t{1'000};
 
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); ++chunk_id) {
-    const auto base_segment = table.get_chunk(chunk_id)->get_segment(column_id);
+// For larger tables, the histogram is built from a random sample of HISTOGRAM_SAMPLE_SIZE to 2 * HISTOGRAM_SAMPLE_SIZE
+// rows, which consists of blocks of consecutive rows (see ColumnStatisticsSketch).
+constexpr auto HISTOGRAM_SAMPLE_SIZE = size_t{100'000};
 
-    segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
-      if (position.is_null()) {
-        ++null_value_count;
-      } else {
-        distinct_set.insert(position.value());
-        min = std::min(min, position.value());
-        max = std::max(max, position.value());
-      }
-    });
-  }
+constexpr auto HISTOGRAM_BIN_COUNT = BinID{100};
 
-  const auto null_value_ratio =
-      table.row_count() > 0 ? static_cast<float>(null_value_count) / static_cast<float>(table.row_count()) : 0.0f;
-  const auto distinct_count = static_cast<float>(distinct_set.size());
-
-  if (distinct_count == 0.0f) {
-    min = std::numeric_limits<ColumnDataType>::min();
-    max = std::numeric_limits<ColumnDataType>::max();
-  }
+/**
+ * Builds the histogram stored in the ColumnStatistics from the (sampled) values of a column
+ */
+template <typename ColumnDataType>
+std::shared_ptr<const AbstractHistogram<ColumnDataType>> generate_column_histogram(
+    const std::map<ColumnDataType, HistogramCountType>& sampled_value_counts) {
+  if (sampled_value_counts.empty()) return nullptr;
 
-  return std::make_shared<ColumnStatistics<ColumnDataType>>(null_value_ratio, distinct_count, min, max);
+  const auto value_counts = std::vector<std::pair<ColumnDataType, HistogramCountType>>{sampled_value_counts.begin(),
+                                                                                       sampled_value_counts.end()};
+  return EqualDistinctCountHistogram<ColumnDataType>::from_value_distribution(value_counts, HISTOGRAM_BIN_COUNT);
 }
 
-template <>
-std::shared_ptr<BaseColumnStatistics> generate_column_statistics<std::string>(const Table& table,
-                                                                              const ColumnID column_id);
-
 }  // namespace opossum
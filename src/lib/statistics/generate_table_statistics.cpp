@@ -1,30 +1,31 @@
 #include "generate_table_statistics.hpp"
 
-#include <unordered_set>
+#include <memory>
 
-#include "base_column_statistics.hpp"
-#include "column_statistics.hpp"
-#include "generate_column_statistics.hpp"
-#include "resolve_type.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
+#include "table_statistics_sketch.hpp"
 
 namespace opossum {
 
-TableStatistics generate_table_statistics(const Table& table) {
-  std::vector<std::shared_ptr<const BaseColumnStatistics>> column_statistics;
-  column_statistics.reserve(table.column_count());
+TableStatistics generate_table_statistics(const Table& table) { return *TableStatisticsSketch{table}.update(table); }
 
-  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
-    const auto column_data_type = table.column_data_types()[column_id];
+void update_table_statistics(Table& table) {
+  auto table_statistics_sketch = table.table_statistics_sketch();
+  if (!table_statistics_sketch) {
+    table_statistics_sketch = std::make_shared<TableStatisticsSketch>(table);
+    table.set_table_statistics_sketch(table_statistics_sketch);
+  }
+
+  const auto table_statistics = table_statistics_sketch->update(table);
 
-    resolve_data_type(column_data_type, [&](auto type) {
-      using ColumnDataType = typename decltype(type)::type;
-      column_statistics.emplace_back(generate_column_statistics<ColumnDataType>(table, column_id));
-    });
+  const auto previous_table_statistics = table.table_statistics();
+  if (previous_table_statistics) {
+    table_statistics->increase_invalid_row_count(static_cast<uint64_t>(previous_table_statistics->row_count()) -
+                                                 previous_table_statistics->approx_valid_row_count());
   }
 
-  return {table.type(), static_cast<float>(table.row_count()), column_statistics};
+  table.set_table_statistics(table_statistics);
 }
 
 }  // namespace opossum
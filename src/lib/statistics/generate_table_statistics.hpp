@@ -10,8 +10,16 @@ namespace opossum {
 class Table;
 
 /**
- * Generate statistics about a Table by analysing its entire data. This may be slow, use with caution.
+ * Generate statistics about a Table from samples of its chunks and HyperLogLog sketches of their distinct values (see
+ * ColumnStatisticsSketch). Segments that are not dictionary-encoded are still scanned entirely.
  */
 TableStatistics generate_table_statistics(const Table& table);
 
+/**
+ * Update the statistics of a Table, e.g., after the Insert operator filled a chunk. Chunks that were immutable during
+ * the previous update are not looked at again (see TableStatisticsSketch). The first call generates the statistics of
+ * the table and is not thread-safe, subsequent calls are. The invalid row count of the previous statistics is kept.
+ */
+void update_table_statistics(Table& table);
+
 }  // namespace opossum
@@ -0,0 +1,93 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Finalizer of the splitmix64 generator, which distributes the bits of the input evenly
+uint64_t mix_hash(uint64_t hash) {
+  hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+  return hash ^ (hash >> 31);
+}
+
+}  // namespace
+
+namespace opossum {
+
+void HyperLogLog::add_hash(const size_t hash) {
+  const auto mixed_hash = mix_hash(hash);
+
+  if (!_registers.empty()) {
+    _add_to_registers(mixed_hash);
+    return;
+  }
+
+  _hashes.emplace(mixed_hash);
+  if (_hashes.size() >= REGISTER_COUNT) _convert_to_registers();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._registers.empty()) {
+    for (const auto mixed_hash : other._hashes) {
+      if (_registers.empty()) {
+        _hashes.emplace(mixed_hash);
+        if (_hashes.size() >= REGISTER_COUNT) _convert_to_registers();
+      } else {
+        _add_to_registers(mixed_hash);
+      }
+    }
+    return;
+  }
+
+  if (_registers.empty()) _convert_to_registers();
+
+  for (auto register_idx = size_t{0}; register_idx < REGISTER_COUNT; ++register_idx) {
+    _registers[register_idx] = std::max(_registers[register_idx], other._registers[register_idx]);
+  }
+}
+
+float HyperLogLog::distinct_count() const {
+  if (_registers.empty()) return static_cast<float>(_hashes.size());
+
+  const auto register_count = static_cast<double>(REGISTER_COUNT);
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0};
+  for (const auto rank : _registers) {
+    inverse_sum += std::ldexp(1.0, -rank);
+    if (rank == 0) ++zero_register_count;
+  }
+
+  const auto alpha = 0.7213 / (1.0 + 1.079 / register_count);
+  const auto estimate = alpha * register_count * register_count / inverse_sum;
+
+  // For small cardinalities, many registers are still zero and linear counting is more accurate. The 64-bit hashes
+  // make a correction for large cardinalities unnecessary.
+  if (estimate <= 2.5 * register_count && zero_register_count > 0) {
+    return static_cast<float>(register_count * std::log(register_count / static_cast<double>(zero_register_count)));
+  }
+
+  return static_cast<float>(estimate);
+}
+
+void HyperLogLog::_add_to_registers(const uint64_t mixed_hash) {
+  // The first PRECISION bits select the register, which stores the maximum position of the first set bit in the
+  // remaining bits. The guard bit limits that position for hashes with only zeros in the remaining bits.
+  const auto register_idx = mixed_hash >> (64 - PRECISION);
+  const auto remaining_bits = (mixed_hash << PRECISION) | (uint64_t{1} << (PRECISION - 1));
+  const auto rank = static_cast<uint8_t>(__builtin_clzll(remaining_bits) + 1);
+
+  _registers[register_idx] = std::max(_registers[register_idx], rank);
+}
+
+void HyperLogLog::_convert_to_registers() {
+  _registers.resize(REGISTER_COUNT, 0);
+  for (const auto mixed_hash : _hashes) {
+    _add_to_registers(mixed_hash);
+  }
+  _hashes = {};
+}
+
+}  // namespace opossum
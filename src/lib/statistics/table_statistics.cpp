@@ -35,15 +35,25 @@ TableStatistics TableStatistics::estimate_predicate(const ColumnID column_id,
    * This function mostly dispatches the matching ColumnStatistics::estimate_*() function
    */
 
-  // Estimate "a BETWEEN 5 and 6" by combining "a >= 5" with "a <= 6"
+  // Estimate "a BETWEEN 5 and 6" by combining "a >= 5" with "a <= 6". If both bounds are values, the column statistics
+  // can estimate the range in one step. This way, a histogram (if present) is used for both bounds.
   if (predicate_condition == PredicateCondition::Between) {
     DebugAssert(value2, "Expected second value to be passed in for BETWEEN");
+    if (is_variant(value) && is_variant(*value2)) {
+      auto predicated_column_statistics = _column_statistics;
+      const auto estimate = _column_statistics[column_id]->estimate_predicate_with_value(
+          predicate_condition, boost::get<AllTypeVariant>(value), boost::get<AllTypeVariant>(*value2));
+      predicated_column_statistics[column_id] = estimate.column_statistics;
+      return {TableType::References, _row_count * estimate.selectivity, predicated_column_statistics};
+    }
+
     auto table_statistics = estimate_predicate(column_id, PredicateCondition::GreaterThanEquals, value);
     return table_statistics.estimate_predicate(column_id, PredicateCondition::LessThanEquals, *value2);
   }
 
-  // TODO(anybody) we don't do (Not)Like estimations yet, thus resort to magic numbers
-  if (predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) {
+  // (Not)Like can only be estimated for string columns and values. Otherwise, resort to magic numbers.
+  if ((predicate_condition == PredicateCondition::Like || predicate_condition == PredicateCondition::NotLike) &&
+      !(is_variant(value) && _column_statistics[column_id]->data_type() == DataType::String)) {
     const auto selectivity =
         predicate_condition == PredicateCondition::Like ? DEFAULT_LIKE_SELECTIVITY : 1.0f - DEFAULT_LIKE_SELECTIVITY;
     return {TableType::References, _row_count * selectivity, _column_statistics};
@@ -0,0 +1,79 @@
+#include "table_statistics_sketch.hpp"
+
+#include <memory>
+#include <vector>
+
+#include "column_statistics_sketch.hpp"
+#include "resolve_type.hpp"
+#include "storage/table.hpp"
+#include "tasks/chunk_compression_task.hpp"
+#include "table_statistics.hpp"
+
+namespace opossum {
+
+TableStatisticsSketch::TableStatisticsSketch(const Table& table) {
+  _column_sketches.reserve(table.column_count());
+  for (const auto column_data_type : table.column_data_types()) {
+    resolve_data_type(column_data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _column_sketches.emplace_back(std::make_shared<ColumnStatisticsSketch<ColumnDataType>>());
+    });
+  }
+}
+
+std::shared_ptr<TableStatistics> TableStatisticsSketch::update(const Table& table) {
+  const auto chunk_count = table.chunk_count();
+
+  auto column_sketches = std::vector<std::shared_ptr<BaseColumnStatisticsSketch>>{};
+  column_sketches.reserve(_column_sketches.size());
+  auto merged_chunk_count = ChunkID{0};
+  auto row_count = size_t{0};
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    for (; _merged_chunk_count < chunk_count; ++_merged_chunk_count) {
+      const auto chunk = table.get_chunk(_merged_chunk_count);
+      if (chunk->is_mutable()) break;
+
+      // Insert marks a full chunk as immutable before it writes the values, so an immutable chunk might still change
+      // until all its rows are committed
+      if (chunk->has_mvcc_data() && !ChunkCompressionTask::chunk_is_completed(chunk, table.max_chunk_size())) break;
+
+      for (auto column_id = ColumnID{0}; column_id < _column_sketches.size(); ++column_id) {
+        _column_sketches[column_id]->add_segment(*chunk->get_segment(column_id), _merged_chunk_count);
+      }
+      _merged_row_count += chunk->size();
+    }
+
+    for (const auto& column_sketch : _column_sketches) {
+      column_sketches.emplace_back(column_sketch->clone());
+    }
+    merged_chunk_count = _merged_chunk_count;
+    row_count = _merged_row_count;
+  }
+
+  // Only the remaining chunks are sketched, the copy of the table's sketch already covers the others
+  for (auto chunk_id = merged_chunk_count; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    for (auto column_id = ColumnID{0}; column_id < column_sketches.size(); ++column_id) {
+      column_sketches[column_id]->add_segment(*chunk->get_segment(column_id), chunk_id);
+    }
+    row_count += chunk->size();
+  }
+
+  auto column_statistics = std::vector<std::shared_ptr<const BaseColumnStatistics>>{};
+  column_statistics.reserve(column_sketches.size());
+  for (const auto& column_sketch : column_sketches) {
+    column_statistics.emplace_back(column_sketch->to_column_statistics());
+  }
+
+  return std::make_shared<TableStatistics>(table.type(), static_cast<float>(row_count), column_statistics);
+}
+
+ChunkID TableStatisticsSketch::merged_chunk_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _merged_chunk_count;
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnStatisticsSketch;
+class Table;
+class TableStatistics;
+
+/**
+ * Maintains the statistics of a table incrementally. Once a chunk is immutable and, for tables with MVCC, completed
+ * (i.e., full and all its rows are committed, see ChunkCompressionTask::chunk_is_completed()), its segments are
+ * sketched (see ColumnStatisticsSketch) and merged into the sketch of the table, so that later updates do not look at
+ * the chunk again. The sketch covers a prefix of the table's chunks. The remaining chunks may still change (e.g., by
+ * Inserts that are still writing to them) and are sketched anew on every update.
+ *
+ * Encoding an immutable chunk does not change its values, so the sketch remains valid.
+ */
+class TableStatisticsSketch final {
+ public:
+  explicit TableStatisticsSketch(const Table& table);
+
+  // Thread-safe. The invalid row count of the returned statistics is zero.
+  std::shared_ptr<TableStatistics> update(const Table& table);
+
+  // Number of chunks merged into the sketch
+  ChunkID merged_chunk_count() const;
+
+ private:
+  mutable std::mutex _mutex;
+  ChunkID _merged_chunk_count{0};
+  size_t _merged_row_count{0};
+  std::vector<std::shared_ptr<BaseColumnStatisticsSketch>> _column_sketches;
+};
+
+}  // namespace opossum
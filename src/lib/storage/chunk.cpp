@@ -36,6 +36,11 @@ bool Chunk::is_mutable() const { return _is_mutable; }
 
 void Chunk::mark_immutable() { _is_mutable = false; }
 
+bool Chunk::try_mark_for_encoding() {
+  auto expected = false;
+  return _is_marked_for_encoding.compare_exchange_strong(expected, true);
+}
+
 void Chunk::replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment) {
   std::atomic_store(&_segments.at(column_id), segment);
 }
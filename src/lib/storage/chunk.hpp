@@ -57,6 +57,13 @@ class Chunk : private Noncopyable {
 
   void mark_immutable();
 
+  /**
+   * Used to make sure that an immutable chunk is encoded only once, even if multiple concurrently committing
+   * transactions find it to be completed (see Insert and ChunkCompressionTask).
+   * @return true if the caller is the first one to claim the chunk for encoding, false otherwise.
+   */
+  bool try_mark_for_encoding();
+
   // Atomically replaces the current segment at column_id with the passed segment
   void replace_segment(size_t column_id, const std::shared_ptr<BaseSegment>& segment);
 
@@ -161,7 +168,8 @@ class Chunk : private Noncopyable {
   std::shared_ptr<ChunkAccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
   std::shared_ptr<ChunkStatistics> _statistics;
-  bool _is_mutable = true;
+  std::atomic_bool _is_mutable{true};
+  std::atomic_bool _is_marked_for_encoding{false};
 };
 
 }  // namespace opossum
@@ -46,8 +46,9 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   chunk->mark_immutable();
   chunk->set_statistics(std::make_shared<ChunkStatistics>(column_statistics));
 
+  // shrink() locks the MVCC data exclusively, so we must not hold a scoped lock here
   if (chunk->has_mvcc_data()) {
-    chunk->get_scoped_mvcc_data_lock()->shrink();
+    chunk->mvcc_data()->shrink();
   }
 }
 
@@ -0,0 +1,76 @@
+#include "table_index.hpp"
+
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "table_index_impl.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+TableIndex::TableIndex(const DataType data_type, const ColumnID column_id)
+    : _column_id(column_id), _impl(make_shared_by_data_type<BaseTableIndexImpl, TableIndexImpl>(data_type)) {}
+
+ColumnID TableIndex::column_id() const { return _column_id; }
+
+DataType TableIndex::data_type() const { return _impl->data_type(); }
+
+void TableIndex::insert(const ChunkID chunk_id, const Chunk& chunk, const ChunkOffset begin_offset,
+                        const ChunkOffset end_offset) {
+  DebugAssert(begin_offset <= end_offset && end_offset <= chunk.size(), "Invalid range of rows to index");
+  if (begin_offset == end_offset) return;
+
+  const auto segment = chunk.get_segment(_column_id);
+  Assert(segment->data_type() == _impl->data_type(), "Segment does not match the data type of the TableIndex");
+
+  std::unique_lock<std::shared_mutex> lock(_mutex);
+  _impl->insert(chunk_id, *segment, begin_offset, end_offset);
+}
+
+bool TableIndex::is_applicable(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                               const AllTypeVariant& value2) const {
+  const auto has_column_type = [&](const AllTypeVariant& variant) {
+    return variant_is_null(variant) || data_type_from_all_type_variant(variant) == _impl->data_type();
+  };
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return has_column_type(value);
+
+    case PredicateCondition::Between:
+      return has_column_type(value) && has_column_type(value2);
+
+    default:
+      return false;
+  }
+}
+
+void TableIndex::append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                                PosList& matches, const AllTypeVariant& value2) const {
+  // Comparisons with NULL never match
+  if (variant_is_null(value)) return;
+  if (predicate_condition == PredicateCondition::Between && variant_is_null(value2)) return;
+
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  _impl->append_matches(predicate_condition, value, matches, value2);
+}
+
+size_t TableIndex::row_count() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return _impl->row_count();
+}
+
+size_t TableIndex::memory_consumption() const {
+  std::shared_lock<std::shared_mutex> lock(_mutex);
+  return sizeof(TableIndex) + _impl->memory_consumption();
+}
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <memory>
+#include <shared_mutex>
+
+#include "all_type_variant.hpp"
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseTableIndexImpl;
+class Chunk;
+
+/**
+ * Unlike the indexes derived from BaseIndex, which are created per chunk (see Chunk::create_index()), a TableIndex
+ * maps the values of a column to the RowIDs of the matching rows in all chunks of a table. Thus, a lookup costs
+ * O(log n) in the table's row count, independent of the number of chunks. The values are kept in a B-tree.
+ *
+ * The index is maintained by the Table (see Table::create_table_index()): rows are added when chunks are appended and
+ * when the Insert operator writes rows. Rows are never removed, as deleted and rolled back rows stay in the table
+ * (invalidated by their MvccData). Consumers filter them with a Validate, just as for scans. The values of existing
+ * rows never change: the Update operator invalidates the old rows and inserts the new ones, which are indexed by the
+ * Insert. Replacing segments (e.g., by the ChunkEncoder) does not change the rows' values or RowIDs and thus requires
+ * no maintenance.
+ *
+ * Lookups and additions may run concurrently.
+ * Note: Only single columns are supported. NULL values are not indexed.
+ */
+class TableIndex : private Noncopyable {
+ public:
+  TableIndex(const DataType data_type, const ColumnID column_id);
+
+  ColumnID column_id() const;
+  DataType data_type() const;
+
+  // Adds the rows in [begin_offset, end_offset) of @param chunk, which is the chunk with @param chunk_id
+  void insert(const ChunkID chunk_id, const Chunk& chunk, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset);
+
+  // Returns whether append_matches() can answer the predicate, i.e., whether the condition is a comparison and the
+  // values (NULL aside) are of the indexed column's type. Values of other types would have to be cast lossily.
+  bool is_applicable(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                     const AllTypeVariant& value2 = NullValue{}) const;
+
+  /**
+   * Appends the RowIDs of all rows whose value v satisfies `v <predicate_condition> value` to @param matches, ordered
+   * by v. For PredicateCondition::Between, the rows with value <= v <= value2 are appended. As in SQL, comparisons
+   * with NULL never match.
+   */
+  void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value, PosList& matches,
+                      const AllTypeVariant& value2 = NullValue{}) const;
+
+  // Returns the number of indexed (i.e., non-NULL) rows
+  size_t row_count() const;
+
+  size_t memory_consumption() const;
+
+ protected:
+  const ColumnID _column_id;
+  const std::shared_ptr<BaseTableIndexImpl> _impl;
+
+  // Insertions lock exclusively, lookups lock shared
+  mutable std::shared_mutex _mutex;
+};
+
+}  // namespace opossum
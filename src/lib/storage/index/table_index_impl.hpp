@@ -0,0 +1,136 @@
+#pragma once
+
+#ifdef __clang__
+#pragma clang diagnostic ignored "-Wall"
+#include <btree_map.h>
+#pragma clang diagnostic pop
+#elif __GNUC__
+#pragma GCC system_header
+#include <btree_map.h>
+#endif
+
+#include <memory>
+
+#include "all_type_variant.hpp"
+#include "resolve_type.hpp"
+#include "storage/base_segment.hpp"
+#include "storage/pos_list.hpp"
+#include "storage/segment_iterate.hpp"
+#include "type_cast.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// See TableIndex, which synchronizes the accesses to its implementation
+class BaseTableIndexImpl : private Noncopyable {
+ public:
+  virtual ~BaseTableIndexImpl() = default;
+
+  virtual DataType data_type() const = 0;
+  virtual void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+                      const ChunkOffset end_offset) = 0;
+  virtual void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                              PosList& matches, const AllTypeVariant& value2) const = 0;
+  virtual size_t row_count() const = 0;
+  virtual size_t memory_consumption() const = 0;
+};
+
+/**
+ * Implementation: https://code.google.com/archive/p/cpp-btree/
+ */
+template <typename T>
+class TableIndexImpl : public BaseTableIndexImpl {
+ public:
+  DataType data_type() const final { return data_type_from_type<T>(); }
+
+  void insert(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset begin_offset,
+              const ChunkOffset end_offset) final {
+    auto chunk_offset = begin_offset;
+    const auto insert_position = [&](const auto& position) {
+      if (!position.is_null()) _btree.insert({position.value(), RowID{chunk_id, chunk_offset}});
+      ++chunk_offset;
+    };
+
+    if (begin_offset == 0 && end_offset == segment.size()) {
+      segment_iterate<T>(segment, insert_position);
+      return;
+    }
+
+    // Only some rows are added (e.g., those written by an Insert into a mutable chunk)
+    auto position_filter = std::make_shared<PosList>();
+    position_filter->guarantee_single_chunk();
+    position_filter->reserve(end_offset - begin_offset);
+    for (auto row_offset = begin_offset; row_offset < end_offset; ++row_offset) {
+      position_filter->emplace_back(RowID{chunk_id, row_offset});
+    }
+    segment_iterate_filtered<T>(segment, position_filter, insert_position);
+  }
+
+  void append_matches(const PredicateCondition predicate_condition, const AllTypeVariant& value, PosList& matches,
+                      const AllTypeVariant& value2) const final {
+    const auto typed_value = type_cast_variant<T>(value);
+
+    auto range_begin = _btree.cbegin();
+    auto range_end = _btree.cend();
+
+    switch (predicate_condition) {
+      case PredicateCondition::Equals: {
+        range_begin = _btree.lower_bound(typed_value);
+        range_end = _btree.upper_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::NotEquals: {
+        // First, get all values less than the search value, then all values greater than it
+        _append_range(_btree.cbegin(), _btree.lower_bound(typed_value), matches);
+        range_begin = _btree.upper_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::LessThan: {
+        range_end = _btree.lower_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::LessThanEquals: {
+        range_end = _btree.upper_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::GreaterThan: {
+        range_begin = _btree.upper_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::GreaterThanEquals: {
+        range_begin = _btree.lower_bound(typed_value);
+        break;
+      }
+      case PredicateCondition::Between: {
+        const auto typed_value2 = type_cast_variant<T>(value2);
+        if (typed_value2 < typed_value) return;
+        range_begin = _btree.lower_bound(typed_value);
+        range_end = _btree.upper_bound(typed_value2);
+        break;
+      }
+      default:
+        Fail("Unsupported comparison type encountered");
+    }
+
+    _append_range(range_begin, range_end, matches);
+  }
+
+  size_t row_count() const final { return _btree.size(); }
+
+  size_t memory_consumption() const final { return _btree.bytes_used(); }
+
+ protected:
+  using BTree = btree::btree_multimap<T, RowID>;
+
+  static void _append_range(const typename BTree::const_iterator& range_begin,
+                            const typename BTree::const_iterator& range_end, PosList& matches) {
+    for (auto it = range_begin; it != range_end; ++it) {
+      matches.emplace_back(it->second);
+    }
+  }
+
+  BTree _btree;
+};
+
+}  // namespace opossum
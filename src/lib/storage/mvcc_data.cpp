@@ -1,5 +1,6 @@
 #include "mvcc_data.hpp"
 
+#include <mutex>
 #include <shared_mutex>
 
 #include "utils/assert.hpp"
@@ -11,6 +12,7 @@ MvccData::MvccData(const size_t size) { grow_by(size, 0); }
 size_t MvccData::size() const { return _size; }
 
 void MvccData::shrink() {
+  std::unique_lock<std::shared_mutex> lock{_mutex};
   tids.shrink_to_fit();
   begin_cids.shrink_to_fit();
   end_cids.shrink_to_fit();
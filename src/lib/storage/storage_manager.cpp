@@ -24,7 +24,7 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  table->set_table_statistics(std::make_shared<TableStatistics>(generate_table_statistics(*table)));
+  update_table_statistics(*table);
   _tables.emplace(name, std::move(table));
 }
 
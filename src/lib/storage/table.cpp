@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "resolve_type.hpp"
+#include "storage/index/table_index.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_segment.hpp"
@@ -93,6 +94,9 @@ void Table::append(const std::vector<AllTypeVariant>& values) {
   }
 
   _chunks.back()->append(values);
+
+  const auto chunk_id = static_cast<ChunkID>(_chunks.size() - 1);
+  index_rows(chunk_id, _chunks.back()->size() - 1, _chunks.back()->size());
 }
 
 void Table::append_mutable_chunk() {
@@ -168,6 +172,7 @@ void Table::append_chunk(const Segments& segments, const std::optional<Polymorph
   }
 
   _chunks.emplace_back(std::make_shared<Chunk>(segments, mvcc_data, alloc, access_counter));
+  index_rows(static_cast<ChunkID>(_chunks.size() - 1), 0, chunk_size);
 }
 
 void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
@@ -189,12 +194,58 @@ void Table::append_chunk(const std::shared_ptr<Chunk>& chunk) {
               "Chunk does not have the same MVCC setting as the table.");
 
   _chunks.emplace_back(chunk);
+  index_rows(static_cast<ChunkID>(_chunks.size() - 1), 0, chunk->size());
 }
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
+CommitID Table::last_modification_commit_id() const { return _last_modification_commit_id; }
+
+void Table::record_modification(const CommitID commit_id) const {
+  // Transactions may commit their records concurrently and in any order
+  auto last_modification_commit_id = _last_modification_commit_id.load();
+  while (last_modification_commit_id < commit_id &&
+         !_last_modification_commit_id.compare_exchange_weak(last_modification_commit_id, commit_id)) {
+  }
+}
+
+void Table::set_chunk_encoding_spec(const std::optional<ChunkEncodingSpec>& chunk_encoding_spec) {
+  Assert(_type == TableType::Data, "Only data tables can be encoded");
+  Assert(!chunk_encoding_spec || chunk_encoding_spec->size() == column_count(),
+         "Number of segment encoding specs must match the table's column count.");
+  _chunk_encoding_spec = chunk_encoding_spec;
+}
+
+const std::optional<ChunkEncodingSpec>& Table::chunk_encoding_spec() const { return _chunk_encoding_spec; }
+
 std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 
+void Table::create_table_index(const ColumnID column_id) {
+  Assert(_type == TableType::Data, "TableIndexes can only be created on data tables");
+  Assert(column_id < column_count(), "column_id invalid");
+  Assert(!get_table_index(column_id), "There is a TableIndex on this column already");
+
+  auto table_index = std::make_shared<TableIndex>(column_data_type(column_id), column_id);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count(); ++chunk_id) {
+    const auto& chunk = *_chunks[chunk_id];
+    table_index->insert(chunk_id, chunk, 0, chunk.size());
+  }
+  _table_indexes.emplace_back(std::move(table_index));
+}
+
+std::shared_ptr<const TableIndex> Table::get_table_index(const ColumnID column_id) const {
+  for (const auto& table_index : _table_indexes) {
+    if (table_index->column_id() == column_id) return table_index;
+  }
+  return nullptr;
+}
+
+void Table::index_rows(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset) {
+  for (const auto& table_index : _table_indexes) {
+    table_index->insert(chunk_id, *_chunks[chunk_id], begin_offset, end_offset);
+  }
+}
+
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
@@ -206,6 +257,10 @@ size_t Table::estimate_memory_usage() const {
     bytes += column_definition.name.size();
   }
 
+  for (const auto& table_index : _table_indexes) {
+    bytes += table_index->memory_consumption();
+  }
+
   // TODO(anybody) Statistics and Indices missing from Memory Usage Estimation
   // TODO(anybody) TableLayout missing
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
@@ -9,6 +10,7 @@
 #include "base_segment.hpp"
 #include "chunk.hpp"
 #include "proxy_chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/index/index_info.hpp"
 #include "storage/table_column_definition.hpp"
 #include "type_cast.hpp"
@@ -18,7 +20,9 @@
 
 namespace opossum {
 
+class TableIndex;
 class TableStatistics;
+class TableStatisticsSketch;
 
 /**
  * A Table is partitioned horizontally into a number of chunks.
@@ -144,9 +148,37 @@ class Table : private Noncopyable {
 
   std::unique_lock<std::mutex> acquire_append_mutex();
 
-  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
+  // The statistics are replaced while the table is being used, e.g., by update_table_statistics(), so that they are
+  // accessed atomically
+  void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) {
+    std::atomic_store(&_table_statistics, table_statistics);
+  }
+
+  std::shared_ptr<TableStatistics> table_statistics() const { return std::atomic_load(&_table_statistics); }
+
+  // Used by update_table_statistics() to update the statistics without looking at chunks that were immutable before
+  void set_table_statistics_sketch(const std::shared_ptr<TableStatisticsSketch>& table_statistics_sketch) {
+    _table_statistics_sketch = table_statistics_sketch;
+  }
 
-  std::shared_ptr<TableStatistics> table_statistics() const { return _table_statistics; }
+  const std::shared_ptr<TableStatisticsSketch>& table_statistics_sketch() const { return _table_statistics_sketch; }
+
+  /**
+   * If an encoding spec is set, chunks that were filled up by the Insert operator are encoded automatically, using
+   * this spec, as soon as all of their rows have been committed or rolled back. Unset by default, i.e., full chunks
+   * stay unencoded until they are encoded manually (e.g., via the ChunkCompressionTask).
+   */
+  void set_chunk_encoding_spec(const std::optional<ChunkEncodingSpec>& chunk_encoding_spec);
+  const std::optional<ChunkEncodingSpec>& chunk_encoding_spec() const;
+
+  /**
+   * The highest CommitID of the transactions that inserted or deleted rows of this table, 0 if it was not modified by
+   * a transaction. Used to decide whether a result computed from the table (e.g., in the SQLResultCache) is outdated.
+   * Like the MvccData of the chunks, this is updated by the read-write operators while committing, even though they
+   * hold the table as const.
+   */
+  CommitID last_modification_commit_id() const;
+  void record_modification(const CommitID commit_id) const;
 
   std::vector<IndexInfo> get_indexes() const;
 
@@ -161,6 +193,19 @@ class Table : private Noncopyable {
     _indexes.emplace_back(i);
   }
 
+  /**
+   * Unlike the indexes above, which are created per chunk, a TableIndex maps the values of a column to the RowIDs in
+   * all chunks (see TableIndex). It is built from the current rows and kept up to date by append_chunk(), append(), and
+   * the Insert operator (via index_rows()). Like create_index(), this must not run concurrently with modifications.
+   */
+  void create_table_index(const ColumnID column_id);
+
+  // Returns the TableIndex on @param column_id, or nullptr if there is none
+  std::shared_ptr<const TableIndex> get_table_index(const ColumnID column_id) const;
+
+  // Adds the rows in [begin_offset, end_offset) of the chunk with @param chunk_id to all TableIndexes
+  void index_rows(const ChunkID chunk_id, const ChunkOffset begin_offset, const ChunkOffset end_offset);
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -173,7 +218,11 @@ class Table : private Noncopyable {
   const uint32_t _max_chunk_size;
   std::vector<std::shared_ptr<Chunk>> _chunks;
   std::shared_ptr<TableStatistics> _table_statistics;
+  std::shared_ptr<TableStatisticsSketch> _table_statistics_sketch;
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexInfo> _indexes;
+  std::vector<std::shared_ptr<TableIndex>> _table_indexes;
+  std::optional<ChunkEncodingSpec> _chunk_encoding_spec;
+  mutable std::atomic<CommitID> _last_modification_commit_id{0};
 };
 }  // namespace opossum
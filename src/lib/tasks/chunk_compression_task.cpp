@@ -29,14 +29,19 @@ void ChunkCompressionTask::_on_execute() {
 
     auto chunk = table->get_chunk(chunk_id);
 
-    DebugAssert(_chunk_is_completed(chunk, table->max_chunk_size()),
+    DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    if (table->chunk_encoding_spec()) {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types(), *table->chunk_encoding_spec());
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+    }
   }
 }
 
-bool ChunkCompressionTask::_chunk_is_completed(const std::shared_ptr<Chunk>& chunk, const uint32_t max_chunk_size) {
+bool ChunkCompressionTask::chunk_is_completed(const std::shared_ptr<const Chunk>& chunk,
+                                              const uint32_t max_chunk_size) {
   if (chunk->size() != max_chunk_size) return false;
 
   auto mvcc_data = chunk->get_scoped_mvcc_data_lock();
@@ -1,27 +1,53 @@
 #include "bind_server_prepared_statement_task.hpp"
 
-#include "concurrency/transaction_manager.hpp"
+#include <algorithm>
+
 #include "expression/value_expression.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
-#include "logical_query_plan/lqp_utils.hpp"
-#include "scheduler/current_scheduler.hpp"
-#include "sql/sql_pipeline.hpp"
+#include "optimizer/optimizer.hpp"
+#include "server/server_prepared_statement.hpp"
+#include "sql/parameterized_plan.hpp"
 #include "storage/prepared_plan.hpp"
 
 namespace opossum {
 
 void BindServerPreparedStatementTask::_on_execute() {
   try {
-    Assert(_params.size() == _prepared_plan->parameter_ids.size(), "Prepared statement parameter count mismatch");
+    const auto& prepared_plan = *_prepared_statement->prepared_plan;
+    Assert(_params.size() == prepared_plan.parameter_ids.size(), "Prepared statement parameter count mismatch");
+
+    // The types of the parameters are part of the ParameterizedPlan, so it is only created for non-NULL parameters
+    const auto has_null_parameter =
+        std::any_of(_params.begin(), _params.end(), [](const auto& param) { return variant_is_null(param); });
+    if (!_prepared_statement->is_parameterized && !has_null_parameter) {
+      _prepared_statement->is_parameterized = true;
+
+      const auto lqp = prepared_plan.lqp->deep_copy();
+      if (ParameterizedPlan::parameterize_placeholders(lqp, prepared_plan.parameter_ids, _params)) {
+        const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(lqp);
+        const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
+        _prepared_statement->parameterized_plan =
+            std::make_shared<ParameterizedPlan>(optimized_lqp, pqp, prepared_plan.parameter_ids, _params);
+      }
+    }
+
+    // Fast path: no translation or optimization, only a copy of the PQP
+    const auto& parameterized_plan = _prepared_statement->parameterized_plan;
+    if (parameterized_plan && parameterized_plan->covers(_params)) {
+      _promise.set_value(parameterized_plan->instantiate(_params));
+      return;
+    }
 
+    // Otherwise, the statement is optimized for the given parameters
     auto parameter_expressions = std::vector<std::shared_ptr<AbstractExpression>>{_params.size()};
     for (auto parameter_idx = size_t{0}; parameter_idx < _params.size(); ++parameter_idx) {
       parameter_expressions[parameter_idx] = std::make_shared<ValueExpression>(_params[parameter_idx]);
     }
 
-    const auto lqp = _prepared_plan->instantiate(parameter_expressions);
-    const auto pqp = LQPTranslator{}.translate_node(lqp);
+    const auto lqp = prepared_plan.instantiate(parameter_expressions);
+    const auto optimized_lqp = Optimizer::create_default_optimizer()->optimize(lqp);
+    const auto pqp = LQPTranslator{}.translate_node(optimized_lqp);
 
     _promise.set_value(pqp);
   } catch (const std::exception&) {
@@ -7,19 +7,20 @@
 namespace opossum {
 
 class AbstractOperator;
-class PreparedPlan;
+struct ServerPreparedStatement;
 
 // This task is used to bind the actual variables of a prepared statements and return the corresponding query plan.
+// The task might create the ParameterizedPlan of the statement, so the statement must not be bound concurrently.
 class BindServerPreparedStatementTask : public AbstractServerTask<std::shared_ptr<AbstractOperator>> {
  public:
-  BindServerPreparedStatementTask(const std::shared_ptr<PreparedPlan>& prepared_plan,
+  BindServerPreparedStatementTask(const std::shared_ptr<ServerPreparedStatement>& prepared_statement,
                                   std::vector<AllTypeVariant> params)
-      : _prepared_plan(prepared_plan), _params(std::move(params)) {}
+      : _prepared_statement(prepared_statement), _params(std::move(params)) {}
 
  protected:
   void _on_execute() override;
 
-  std::shared_ptr<PreparedPlan> _prepared_plan;
+  std::shared_ptr<ServerPreparedStatement> _prepared_statement;
   std::vector<AllTypeVariant> _params;
 };
 
@@ -3,6 +3,7 @@
 #include "concurrency/transaction_context.hpp"
 #include "concurrency/transaction_manager.hpp"
 #include "operators/abstract_operator.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
 
@@ -11,7 +12,14 @@ namespace opossum {
 void ExecuteServerPreparedStatementTask::_on_execute() {
   try {
     const auto tasks = OperatorTask::make_tasks_from_operator(_prepared_plan, CleanupTemporaries::Yes);
+    for (const auto& task : tasks) {
+      task->set_cancellation_token(_cancellation_token);
+    }
     CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+
+    // Some operators might have been skipped. The session rolls back the transaction.
+    CancellationToken::check(_cancellation_token);
+
     auto result_table = tasks.back()->get_operator()->get_output();
     _promise.set_value(std::move(result_table));
   } catch (const std::exception&) {
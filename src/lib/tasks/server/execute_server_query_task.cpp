@@ -6,7 +6,11 @@ namespace opossum {
 
 void ExecuteServerQueryTask::_on_execute() {
   try {
-    _sql_pipeline->get_result_table();
+    if (_sql_pipeline->statement_count() == 1) {
+      _sql_pipeline->get_result_stream(_max_in_flight_chunks);
+    } else {
+      _sql_pipeline->get_result_table();
+    }
     // Indicate that execution is finished. The result is accessed from outside so we need an empty promise.
     _promise.set_value();
   } catch (...) {
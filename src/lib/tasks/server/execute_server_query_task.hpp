@@ -6,15 +6,19 @@ namespace opossum {
 
 class SQLPipeline;
 
-// This task is used in the SimpleQueryCommand mode where we have a simple pipeline that needs to be executed.
+// This task is used in the SimpleQueryCommand mode where we have a simple pipeline that needs to be executed. The
+// result of a pipeline with a single statement is streamed: The task only starts the execution of the first
+// @param max_in_flight_chunks chunks, which are retrieved with FetchServerResultChunksTasks.
 class ExecuteServerQueryTask : public AbstractServerTask<void> {
  public:
-  explicit ExecuteServerQueryTask(std::shared_ptr<SQLPipeline> sql_pipeline) : _sql_pipeline(sql_pipeline) {}
+  ExecuteServerQueryTask(std::shared_ptr<SQLPipeline> sql_pipeline, const size_t max_in_flight_chunks)
+      : _sql_pipeline(sql_pipeline), _max_in_flight_chunks(max_in_flight_chunks) {}
 
  protected:
   void _on_execute() override;
 
   std::shared_ptr<SQLPipeline> _sql_pipeline;
+  const size_t _max_in_flight_chunks;
 };
 
 }  // namespace opossum
@@ -0,0 +1,15 @@
+#include "fetch_server_result_chunks_task.hpp"
+
+#include "sql/result_chunk_stream.hpp"
+
+namespace opossum {
+
+void FetchServerResultChunksTask::_on_execute() {
+  try {
+    _promise.set_value(_result_stream->next());
+  } catch (...) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class ResultChunkStream;
+class Table;
+
+// This task retrieves the next part of a streamed query result, which may have to be executed first. The future holds
+// nullptr once the entire result was retrieved.
+class FetchServerResultChunksTask : public AbstractServerTask<std::shared_ptr<const Table>> {
+ public:
+  explicit FetchServerResultChunksTask(std::shared_ptr<ResultChunkStream> result_stream)
+      : _result_stream(std::move(result_stream)) {}
+
+ protected:
+  void _on_execute() override;
+
+  std::shared_ptr<ResultChunkStream> _result_stream;
+};
+
+}  // namespace opossum
@@ -0,0 +1,16 @@
+#include "serialize_server_data_rows_task.hpp"
+
+#include "server/data_row_serializer.hpp"
+
+namespace opossum {
+
+void SerializeServerDataRowsTask::_on_execute() {
+  try {
+    _data_row_serializer->serialize_next_batch(_min_batch_size);
+    _promise.set_value();
+  } catch (const std::exception&) {
+    _promise.set_exception(boost::current_exception());
+  }
+}
+
+}  // namespace opossum
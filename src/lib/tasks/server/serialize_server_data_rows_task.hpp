@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+
+#include "abstract_server_task.hpp"
+
+namespace opossum {
+
+class DataRowSerializer;
+
+// This task serializes the next batch of a query result, so that the serialization does not block the io_service that
+// the session runs on. The batch can be retrieved from the serializer once the task is done.
+class SerializeServerDataRowsTask : public AbstractServerTask<void> {
+ public:
+  SerializeServerDataRowsTask(std::shared_ptr<DataRowSerializer> data_row_serializer, const size_t min_batch_size)
+      : _data_row_serializer(std::move(data_row_serializer)), _min_batch_size(min_batch_size) {}
+
+ protected:
+  void _on_execute() override;
+
+  std::shared_ptr<DataRowSerializer> _data_row_serializer;
+  const size_t _min_batch_size;
+};
+
+}  // namespace opossum
@@ -0,0 +1,14 @@
+#include "table_statistics_update_task.hpp"
+
+#include <memory>
+
+#include "statistics/generate_table_statistics.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+TableStatisticsUpdateTask::TableStatisticsUpdateTask(const std::shared_ptr<Table>& table) : _table{table} {}
+
+void TableStatisticsUpdateTask::_on_execute() { update_table_statistics(*_table); }
+
+}  // namespace opossum
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+
+#include "scheduler/abstract_task.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * @brief Updates the statistics of a table, see update_table_statistics()
+ *
+ * The Insert operator schedules this task once it committed rows that filled up a chunk, so that the statistics are
+ * refreshed in the background instead of in the commit path of the transaction. Queries planned before the task
+ * finished still use the previous statistics, which are replaced atomically (see Table::set_table_statistics()).
+ */
+class TableStatisticsUpdateTask : public AbstractTask {
+ public:
+  explicit TableStatisticsUpdateTask(const std::shared_ptr<Table>& table);
+
+ protected:
+  void _on_execute() override;
+
+ private:
+  const std::shared_ptr<Table> _table;
+};
+}  // namespace opossum
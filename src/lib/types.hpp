@@ -164,6 +164,13 @@ enum class SchedulePriority {
   High = 0      // Schedule task at the beginning of the queue
 };
 
+// The workload class of a query. Each class has its own ResourceGroup, which determines its share of the workers and
+// how many of its queries are executed concurrently.
+enum class QueryClass {
+  Transactional = 0,  // Short-running queries, e.g., point lookups
+  Analytical = 1      // Long-running queries that touch large parts of the data
+};
+
 enum class PredicateCondition {
   Equals,
   NotEquals,
@@ -204,6 +211,8 @@ enum class UseMvcc : bool { Yes = true, No = false };
 
 enum class CleanupTemporaries : bool { Yes = true, No = false };
 
+enum class AutoParameterize : bool { Yes = true, No = false };
+
 // Used as a template parameter that is passed whenever we conditionally erase the type of a template. This is done to
 // reduce the compile time at the cost of the runtime performance. Examples are iterators, which are replaced by
 // AnySegmentIterators that use virtual method calls.
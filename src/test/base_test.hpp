@@ -12,7 +12,10 @@
 #include "operators/abstract_operator.hpp"
 #include "operators/table_scan.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "scheduler/resource_group.hpp"
 #include "sql/sql_plan_cache.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "statistics/cardinality_feedback.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/dictionary_segment.hpp"
 #include "storage/numa_placement_manager.hpp"
@@ -89,6 +92,15 @@ class BaseTestWithParam
 
     SQLPhysicalPlanCache::get().clear();
     SQLLogicalPlanCache::get().clear();
+    SQLParameterizedPlanCache::get().clear();
+    SQLParseTreeCache::get().clear();
+    SQLResultCache::get().resize(0);
+
+    CardinalityFeedback::get().clear();
+    CardinalityFeedback::get().set_enabled(false);
+    CardinalityFeedback::get().set_q_error_threshold(CardinalityFeedback::DEFAULT_Q_ERROR_THRESHOLD);
+
+    ResourceGroup::reset();
   }
 
   static std::shared_ptr<AbstractExpression> get_column_expression(const std::shared_ptr<AbstractOperator>& op,
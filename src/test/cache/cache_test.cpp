@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -6,6 +9,7 @@
 #include "cache/lru_cache.hpp"
 #include "cache/lru_k_cache.hpp"
 #include "cache/random_cache.hpp"
+#include "cache/sharded_cache.hpp"
 
 namespace opossum {
 
@@ -253,12 +257,83 @@ TEST(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+// Sharded cache with TinyLFU admission
+TEST(CachePolicyTest, ShardedCacheAdmission) {
+  ShardedCache<int, int> cache(2);
+
+  cache.set(1, 2);  // Miss, insert.
+  cache.set(2, 4);  // Miss, insert.
+  cache.set(3, 6);  // Miss, 3 was not accessed more often than 1. Not admitted.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+
+  ASSERT_FALSE(cache.try_get(3));  // Miss, but the access is recorded.
+  ASSERT_FALSE(cache.try_get(3));  // Miss, but the access is recorded.
+  cache.set(3, 6);                 // Miss, 3 was accessed more often than 2. Evict 2.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.try_get(1), 2);  // Hit.
+  ASSERT_EQ(cache.try_get(3), 6);  // Hit.
+
+  cache.set(1, 5);  // Hit, update.
+  ASSERT_EQ(cache.get(1), 5);
+}
+
+TEST(CachePolicyTest, ShardedCacheShards) {
+  using IntCache = ShardedCache<int, int>;
+  ASSERT_EQ(IntCache(0).shard_count(), 1u);
+  ASSERT_EQ(IntCache(31).shard_count(), 1u);
+  ASSERT_EQ(IntCache(32).shard_count(), 2u);
+  ASSERT_EQ(IntCache(1'000).shard_count(), 32u);
+  ASSERT_EQ(IntCache(1'000'000).shard_count(), IntCache::MAX_SHARD_COUNT);
+
+  // The capacity is exact, even if it cannot be split evenly between the shards
+  ShardedCache<int, int> cache(1'000);
+  for (auto key = 0; key < 2'000; ++key) cache.set(key, key);
+  ASSERT_LE(cache.size(), 1'000u);
+
+  cache.resize(100);
+  ASSERT_EQ(cache.capacity(), 100u);
+  ASSERT_LE(cache.size(), 100u);
+}
+
+TEST(CachePolicyTest, ShardedCacheConcurrentAccess) {
+  Cache<int, int> cache;
+  cache.replace_cache_impl<ShardedCache<int, int>>(256);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0; thread_idx < 8; ++thread_idx) {
+    threads.emplace_back([&, thread_idx]() {
+      for (auto iteration = 0; iteration < 10'000; ++iteration) {
+        const auto key = (iteration * 7 + thread_idx) % 1'000;
+        const auto value = cache.try_get(key);
+        if (value) {
+          ASSERT_EQ(*value, key * 2);
+        } else {
+          cache.set(key, key * 2);
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) thread.join();
+
+  ASSERT_GT(cache.size(), 0u);
+  ASSERT_LE(cache.size(), 256u);
+  for (const auto& [key, value] : cache) {
+    ASSERT_EQ(value, key * 2);
+  }
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
 // Here, all cache types are defined.
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ShardedCache<int, int>>;
 TYPED_TEST_CASE(CacheTest, CacheTypes, );  // NOLINT(whitespace/parens)
 
 TYPED_TEST(CacheTest, Size) {
@@ -287,6 +362,29 @@ TYPED_TEST(CacheTest, Clear) {
   ASSERT_FALSE(cache.has(2));
 }
 
+TYPED_TEST(CacheTest, Erase) {
+  TypeParam cache(3);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+  cache.set(3, 6);
+
+  ASSERT_TRUE(cache.erase(1));
+  ASSERT_FALSE(cache.erase(1));
+
+  ASSERT_EQ(cache.size(), 2u);
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_EQ(cache.get(2), 4);
+  ASSERT_EQ(cache.get(3), 6);
+
+  // The freed slot can be reused without evicting other entries
+  cache.set(4, 8);
+  ASSERT_EQ(cache.size(), 3u);
+  ASSERT_TRUE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_EQ(cache.get(4), 8);
+}
+
 TYPED_TEST(CacheTest, ResizeGrow) {
   TypeParam cache(3);
 
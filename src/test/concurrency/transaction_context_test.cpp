@@ -1,3 +1,4 @@
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -108,4 +109,48 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, ReadOnlyContextsShareSnapshot) {
+  auto read_only_context_1 = manager().new_read_only_transaction_context();
+  auto read_only_context_2 = manager().new_read_only_transaction_context();
+
+  EXPECT_TRUE(read_only_context_1->is_read_only());
+  EXPECT_EQ(read_only_context_1, read_only_context_2);
+  EXPECT_EQ(read_only_context_1->snapshot_commit_id(), manager().last_commit_id());
+
+  // Committing a read-only context is a no-op, the context stays usable for other read-only transactions
+  auto committed = false;
+  EXPECT_TRUE(read_only_context_1->commit_async([&committed](TransactionID) { committed = true; }));
+  EXPECT_TRUE(committed);
+  EXPECT_EQ(read_only_context_1->phase(), TransactionPhase::Active);
+
+  // Once another transaction commits, new read-only transactions get a fresh snapshot
+  auto context = manager().new_transaction_context();
+  context->commit();
+
+  auto read_only_context_3 = manager().new_read_only_transaction_context();
+  EXPECT_NE(read_only_context_1, read_only_context_3);
+  EXPECT_EQ(read_only_context_3->snapshot_commit_id(), manager().last_commit_id());
+}
+
+TEST_F(TransactionContextTest, ReadOnlyContextsToleratesConfiguredStaleness) {
+  manager().set_max_read_only_snapshot_staleness(std::chrono::hours{1});
+
+  auto read_only_context_1 = manager().new_read_only_transaction_context();
+
+  auto context = manager().new_transaction_context();
+  context->commit();
+
+  auto read_only_context_2 = manager().new_read_only_transaction_context();
+  EXPECT_EQ(read_only_context_1, read_only_context_2);
+  EXPECT_LT(read_only_context_2->snapshot_commit_id(), manager().last_commit_id());
+}
+
+TEST_F(TransactionContextTest, ReadOnlyContextRejectsReadWriteOperators) {
+  auto read_only_context = manager().new_read_only_transaction_context();
+
+  auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+  commit_op->set_transaction_context(read_only_context);
+  EXPECT_THROW(commit_op->execute(), std::logic_error);
+}
+
 }  // namespace opossum
@@ -0,0 +1,103 @@
+#include <sstream>
+
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_calibrated.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class CostModelCalibratedTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    const auto make_node = [](const std::string& name, const float row_count) {
+      const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.0f, row_count, 1, row_count);
+      const auto table_statistics = std::make_shared<TableStatistics>(
+          TableType::Data, row_count, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics});
+
+      const auto node = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, name);
+      node->set_statistics(table_statistics);
+      return node;
+    };
+
+    small_node_a = make_node("small_a", 10.0f);
+    small_node_b = make_node("small_b", 10.0f);
+    large_node_a = make_node("large_a", 1'000'000.0f);
+    large_node_b = make_node("large_b", 1'000'000.0f);
+
+    small_a = small_node_a->get_column("a");
+    small_b = small_node_b->get_column("a");
+    large_a = large_node_a->get_column("a");
+    large_b = large_node_b->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> small_node_a, small_node_b, large_node_a, large_node_b;
+  LQPColumnReference small_a, small_b, large_a, large_b;
+  CostModelCalibrated cost_model;
+};
+
+TEST_F(CostModelCalibratedTest, EquiJoins) {
+  const auto inner_join = JoinNode::make(JoinMode::Inner, equals_(small_a, large_a), small_node_a, large_node_a);
+  EXPECT_EQ(cost_model.select_join_implementation(inner_join), OperatorType::JoinHash);
+  EXPECT_LT(cost_model.estimate_join_cost(inner_join, OperatorType::JoinHash),
+            cost_model.estimate_join_cost(inner_join, OperatorType::JoinSortMerge));
+
+  const auto semi_join = JoinNode::make(JoinMode::Semi, equals_(small_a, large_a), small_node_a, large_node_a);
+  EXPECT_EQ(cost_model.applicable_join_implementations(semi_join), std::vector<OperatorType>{OperatorType::JoinHash});
+
+  // JoinHash does not support full outer joins
+  const auto outer_join = JoinNode::make(JoinMode::Outer, equals_(small_a, large_a), small_node_a, large_node_a);
+  EXPECT_EQ(cost_model.select_join_implementation(outer_join), OperatorType::JoinSortMerge);
+}
+
+TEST_F(CostModelCalibratedTest, NonEquiJoins) {
+  // For tiny inputs, the quadratic runtime of the JoinNestedLoop does not matter
+  const auto small_join = JoinNode::make(JoinMode::Inner, less_than_(small_a, small_b), small_node_a, small_node_b);
+  EXPECT_EQ(cost_model.select_join_implementation(small_join), OperatorType::JoinNestedLoop);
+
+  const auto large_join = JoinNode::make(JoinMode::Inner, less_than_(large_a, large_b), large_node_a, large_node_b);
+  EXPECT_EQ(cost_model.select_join_implementation(large_join), OperatorType::JoinSortMerge);
+
+  // JoinSortMerge supports NotEquals only for inner joins
+  const auto left_join = JoinNode::make(JoinMode::Left, not_equals_(large_a, large_b), large_node_a, large_node_b);
+  EXPECT_EQ(cost_model.applicable_join_implementations(left_join),
+            std::vector<OperatorType>{OperatorType::JoinNestedLoop});
+}
+
+TEST_F(CostModelCalibratedTest, CrossJoinsAreNoJoinImplementations) {
+  const auto cross_join = JoinNode::make(JoinMode::Cross, small_node_a, large_node_a);
+  EXPECT_TRUE(cost_model.applicable_join_implementations(cross_join).empty());
+  EXPECT_GT(cost_model.estimate_plan_cost(cross_join), 0.0f);
+}
+
+TEST_F(CostModelCalibratedTest, CalibratedCoefficientsAreUsed) {
+  // Make JoinSortMerge free, so that it is chosen over JoinHash
+  auto coefficients = CostModelCoefficients::defaults();
+  coefficients.operators[OperatorType::JoinSortMerge] = CostFunctionCoefficients{};
+  const auto calibrated_cost_model = CostModelCalibrated{coefficients};
+
+  const auto join = JoinNode::make(JoinMode::Inner, equals_(small_a, large_a), small_node_a, large_node_a);
+  EXPECT_EQ(calibrated_cost_model.select_join_implementation(join), OperatorType::JoinSortMerge);
+}
+
+TEST_F(CostModelCalibratedTest, ImportExportCoefficients) {
+  auto coefficients = CostModelCoefficients::defaults();
+  coefficients.table_scan[EncodingType::RunLength] = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+  coefficients.operators[OperatorType::JoinIndex] = {7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f};
+
+  auto stream = std::stringstream{};
+  export_cost_model_coefficients(coefficients, stream);
+  const auto imported_coefficients = import_cost_model_coefficients(stream);
+
+  EXPECT_EQ(imported_coefficients.table_scan, coefficients.table_scan);
+  EXPECT_EQ(imported_coefficients.operators, coefficients.operators);
+  EXPECT_EQ(imported_coefficients.fallback, coefficients.fallback);
+}
+
+}  // namespace opossum
@@ -636,6 +636,26 @@ TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelated) {
                                        {std::nullopt, std::nullopt, std::nullopt, std::nullopt}));
 }
 
+TEST_F(ExpressionEvaluatorToValuesTest, InSubqueryCorrelatedWithRepeatedParameters) {
+  // PQP that returns the column "a" added to the current value in "c". Results are reused for rows with the same
+  // parameter values, which includes NULLs.
+  //
+  // row   list returned from sub query
+  //  0      (34, 35, 36, 37)
+  //  1      (NULL, NULL, NULL, NULL)
+  //  2      (35, 36, 37, 38)
+  //  3      (NULL, NULL, NULL, NULL)
+  const auto table_wrapper = std::make_shared<TableWrapper>(table_a);
+  const auto add_c = add_(correlated_parameter_(ParameterID{0}, c), PQPColumnExpression::from_table(*table_a, "a"));
+  const auto pqp = std::make_shared<Projection>(table_wrapper, expression_vector(add_c));
+  const auto subquery = pqp_subquery_(pqp, DataType::Int, true, std::make_pair(ParameterID{0}, ColumnID{2}));
+
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(34, subquery), {1, std::nullopt, 0, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(35, subquery), {1, std::nullopt, 1, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *in_(add_(a, 33), subquery), {1, std::nullopt, 1, std::nullopt}));
+  EXPECT_TRUE(test_expression<int32_t>(table_a, *not_in_(38, subquery), {1, std::nullopt, 0, std::nullopt}));
+}
+
 TEST_F(ExpressionEvaluatorToValuesTest, NotInListLiterals) {
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_())), {std::nullopt}));
   EXPECT_TRUE(test_expression<int32_t>(*not_in_(null_(), list_(null_(), 3)), {std::nullopt}));
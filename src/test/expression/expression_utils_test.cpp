@@ -50,4 +50,19 @@ TEST_F(ExpressionUtilsTest, ExpressionCommonType) {
   EXPECT_EQ(expression_common_type(DataType::String, DataType::String), DataType::String);
 }
 
+TEST_F(ExpressionUtilsTest, ExpressionCopyForPQP) {
+  // Expressions without execution state are shared
+  const auto immutable_expression = and_(greater_than_(a_a, 5), less_than_(a_b, 6));
+  EXPECT_FALSE(expression_has_execution_state(immutable_expression));
+  EXPECT_EQ(expression_copy_for_pqp(immutable_expression), immutable_expression);
+
+  // Expressions with parameters are copied, so that the copies can be bound to different values
+  const auto parameter = correlated_parameter_(ParameterID{0}, a_c);
+  const auto parameterized_expression = and_(greater_than_(a_a, 5), less_than_(a_b, parameter));
+  EXPECT_TRUE(expression_has_execution_state(parameterized_expression));
+  const auto copied_expression = expression_copy_for_pqp(parameterized_expression);
+  EXPECT_NE(copied_expression, parameterized_expression);
+  EXPECT_EQ(*copied_expression, *parameterized_expression);
+}
+
 }  // namespace opossum
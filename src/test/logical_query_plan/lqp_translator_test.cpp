@@ -30,7 +30,10 @@
 #include "operators/aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
+#include "operators/join_adaptive.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -363,19 +366,24 @@ TEST_F(LQPTranslatorTest, JoinNonEqui) {
   const auto pqp = LQPTranslator{}.translate_node(lqp);
 
   /**
-   * Check PQP
+   * Check PQP. Both a sort merge and a nested loop join are applicable, so the decision is made at runtime. For inputs
+   * this small, the cost model prefers the nested loop join.
    */
-  const auto join_sort_merge = std::dynamic_pointer_cast<JoinSortMerge>(pqp);
-  ASSERT_TRUE(join_sort_merge);
-  EXPECT_EQ(join_sort_merge->column_ids().first, ColumnID{1});
-  EXPECT_EQ(join_sort_merge->column_ids().second, ColumnID{0});
-  EXPECT_EQ(join_sort_merge->predicate_condition(), PredicateCondition::GreaterThan);
+  const auto join_adaptive = std::dynamic_pointer_cast<JoinAdaptive>(pqp);
+  ASSERT_TRUE(join_adaptive);
+  EXPECT_EQ(join_adaptive->column_ids().first, ColumnID{1});
+  EXPECT_EQ(join_adaptive->column_ids().second, ColumnID{0});
+  EXPECT_EQ(join_adaptive->predicate_condition(), PredicateCondition::GreaterThan);
 
-  const auto get_table_int_float2 = std::dynamic_pointer_cast<const GetTable>(join_sort_merge->input_left());
+  const auto get_table_int_float2 = std::dynamic_pointer_cast<const GetTable>(join_adaptive->input_left());
   ASSERT_TRUE(get_table_int_float2);
   EXPECT_EQ(get_table_int_float2->table_name(), "table_int_float2");
 
-  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_sort_merge->input_right());
+  join_adaptive->mutable_input_left()->execute();
+  join_adaptive->mutable_input_right()->execute();
+  EXPECT_EQ(join_adaptive->select_join_implementation(), OperatorType::JoinNestedLoop);
+
+  const auto get_table_int_float = std::dynamic_pointer_cast<const GetTable>(join_adaptive->input_right());
   ASSERT_TRUE(get_table_int_float);
   EXPECT_EQ(get_table_int_float->table_name(), "table_int_float");
 }
@@ -563,6 +571,66 @@ TEST_F(LQPTranslatorTest, JoinNode) {
   EXPECT_EQ(join_op->mode(), JoinMode::Outer);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeIndex) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto int_float_chunked_node = StoredTableNode::make("int_float_chunked");
+  const auto int_float_chunked_a = int_float_chunked_node->get_column("a");
+
+  const auto join_node = JoinNode::make(JoinMode::Inner, equals_(int_float_a, int_float_chunked_a), int_float_node,
+                                        int_float_chunked_node);
+
+  // Without an index on the right input, JoinIndex is not an option
+  const auto join_without_index = std::dynamic_pointer_cast<JoinAdaptive>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_without_index);
+  join_without_index->mutable_input_left()->execute();
+  join_without_index->mutable_input_right()->execute();
+  EXPECT_EQ(join_without_index->select_join_implementation(), OperatorType::JoinHash);
+
+  const auto table = StorageManager::get().get_table("int_float_chunked");
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+
+  /**
+   * Check PQP
+   */
+  const auto join_op = std::dynamic_pointer_cast<JoinAdaptive>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_op);
+  EXPECT_EQ(join_op->column_ids(), ColumnIDPair(ColumnID{0}, ColumnID{0}));
+  EXPECT_EQ(join_op->predicate_condition(), PredicateCondition::Equals);
+
+  join_op->mutable_input_left()->execute();
+  join_op->mutable_input_right()->execute();
+  EXPECT_EQ(join_op->select_join_implementation(), OperatorType::JoinIndex);
+}
+
+TEST_F(LQPTranslatorTest, JoinNodeRuntimeFilter) {
+  const auto int_float_chunked_node = StoredTableNode::make("int_float_chunked");
+  const auto int_float_chunked_a = int_float_chunked_node->get_column("a");
+
+  // clang-format off
+  const auto semi_join_node =
+  JoinNode::make(JoinMode::Semi, equals_(int_float_chunked_a, int_float2_a),
+    PredicateNode::make(greater_than_(int_float_chunked_a, 0),
+      int_float_chunked_node),
+    int_float2_node);
+  // clang-format on
+
+  const auto join_op = LQPTranslator{}.translate_node(semi_join_node);
+  const auto get_table_op = std::dynamic_pointer_cast<const GetTable>(join_op->input_left()->input_left());
+  ASSERT_TRUE(get_table_op);
+  EXPECT_EQ(get_table_op->runtime_filter_count(), 1u);
+  EXPECT_EQ(get_table_op->input_left(), join_op->input_right());
+
+  // Outer joins need all rows of the chunked table, so they are not pruned
+  const auto outer_join_node = JoinNode::make(JoinMode::Left, equals_(int_float_chunked_a, int_float2_a),
+                                              int_float_chunked_node, int_float2_node);
+  const auto outer_join_op = LQPTranslator{}.translate_node(outer_join_node);
+  EXPECT_EQ(std::dynamic_pointer_cast<const GetTable>(outer_join_op->input_left())->runtime_filter_count(), 0u);
+}
+
 TEST_F(LQPTranslatorTest, ShowTablesNode) {
   /**
    * Build LQP and translate to PQP
@@ -638,7 +706,7 @@ TEST_F(LQPTranslatorTest, JoinAndPredicates) {
   const auto a = PQPColumnExpression::from_table(*table_int_float, "a");
   const auto b = PQPColumnExpression::from_table(*table_int_float2, "b");
 
-  const auto join_op = std::dynamic_pointer_cast<const JoinHash>(op);
+  const auto join_op = std::dynamic_pointer_cast<const JoinAdaptive>(op);
   ASSERT_TRUE(join_op);
 
   const auto predicate_op_left = std::dynamic_pointer_cast<const TableScan>(join_op->input_left());
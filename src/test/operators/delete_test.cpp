@@ -1,3 +1,5 @@
+#include <chrono>
+#include <future>
 #include <limits>
 #include <memory>
 #include <string>
@@ -141,6 +143,41 @@ TEST_F(OperatorsDeleteTest, DetectDirtyWrite) {
   EXPECT_TABLE_EQ_UNORDERED(validate->get_output(), expected_result->get_output());
 }
 
+TEST_F(OperatorsDeleteTest, WaitForLockHolder) {
+  TransactionManager::get().set_lock_wait_timeout(std::chrono::seconds{10});
+
+  for (const auto lock_holder_commits : {false, true}) {
+    auto t1_context = TransactionManager::get().new_transaction_context();
+    auto t2_context = TransactionManager::get().new_transaction_context();
+
+    auto table_scan1 = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "123");
+    auto table_scan2 = create_table_scan(_gt, ColumnID{0}, PredicateCondition::Equals, "123");
+    table_scan1->execute();
+    table_scan2->execute();
+
+    auto delete_op1 = std::make_shared<Delete>(table_scan1);
+    delete_op1->set_transaction_context(t1_context);
+    delete_op1->execute();
+    EXPECT_FALSE(delete_op1->execute_failed());
+
+    // The second delete blocks until the first transaction has finished
+    auto delete_op2 = std::make_shared<Delete>(table_scan2);
+    delete_op2->set_transaction_context(t2_context);
+    auto delete_op2_future = std::async(std::launch::async, [&]() { delete_op2->execute(); });
+
+    if (lock_holder_commits) {
+      t1_context->commit();
+    } else {
+      t1_context->rollback();
+    }
+    delete_op2_future.wait();
+
+    // If the lock holder has deleted the row, the second transaction fails. Otherwise, it acquires the lock.
+    EXPECT_EQ(delete_op2->execute_failed(), lock_holder_commits);
+    t2_context->rollback();
+  }
+}
+
 TEST_F(OperatorsDeleteTest, EmptyDelete) {
   auto tx_context_modification = TransactionManager::get().new_transaction_context();
 
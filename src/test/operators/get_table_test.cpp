@@ -4,6 +4,8 @@
 #include "gtest/gtest.h"
 
 #include "operators/get_table.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 
@@ -15,6 +17,20 @@ class OperatorsGetTableTest : public BaseTest {
     _test_table = std::make_shared<Table>(TableColumnDefinitions{}, TableType::Data, 2);
     auto& manager = StorageManager::get();
     manager.add_table("tableWithValues", load_table("resources/test_data/tbl/int_float2.tbl", 1u));
+
+    // Encoding the chunks creates the ChunkStatistics used by runtime filters
+    ChunkEncoder::encode_all_chunks(manager.get_table("tableWithValues"), EncodingType::Dictionary);
+  }
+
+  // Wraps a single int column with @param values, as the build side of a join would produce it
+  static std::shared_ptr<TableWrapper> make_join_keys(const std::vector<int32_t>& values) {
+    const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data);
+    for (const auto value : values) table->append({value});
+    table->append({NullValue{}});
+
+    const auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
   }
 
   std::shared_ptr<Table> _test_table;
@@ -52,4 +68,90 @@ TEST_F(OperatorsGetTableTest, ExcludedChunks) {
   EXPECT_EQ(table->get_value<int>(ColumnID(0), 1u), original_table->get_value<int>(ColumnID(0), 3u));
 }
 
+TEST_F(OperatorsGetTableTest, IncludedChunks) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->set_included_chunk_ids({ChunkID{2}, ChunkID{3}});
+  gt->set_excluded_chunk_ids({ChunkID{3}});
+
+  auto original_table = StorageManager::get().get_table("tableWithValues");
+  original_table->append({1, 1.0f});
+
+  // Neither the excluded chunk nor the appended one are read
+  gt->execute();
+  auto table = gt->get_output();
+  ASSERT_EQ(table->chunk_count(), ChunkID{1});
+  EXPECT_EQ(table->get_chunk(ChunkID{0}), original_table->get_chunk(ChunkID{2}));
+  EXPECT_EQ(gt->description(DescriptionMode::SingleLine),
+            "GetTable (tableWithValues) (2 Chunks included) (1 Chunks pruned)");
+
+  const auto copy = std::dynamic_pointer_cast<GetTable>(gt->deep_copy());
+  EXPECT_EQ(copy->included_chunk_ids(), gt->included_chunk_ids());
+
+  auto gt_without_chunks = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt_without_chunks->set_included_chunk_ids({});
+  gt_without_chunks->execute();
+  EXPECT_EQ(gt_without_chunks->get_output()->chunk_count(), ChunkID{0});
+  EXPECT_EQ(gt_without_chunks->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeFilterRange) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->add_runtime_filter(make_join_keys({123, 12}), ColumnID{0}, ColumnID{0});
+  EXPECT_EQ(gt->runtime_filter_count(), 1u);
+
+  // The chunks with 12345 are outside of [12, 123]
+  gt->execute();
+  auto original_table = StorageManager::get().get_table("tableWithValues");
+  auto table = gt->get_output();
+  ASSERT_EQ(table->chunk_count(), ChunkID(2));
+  EXPECT_EQ(table->get_chunk(ChunkID{0}), original_table->get_chunk(ChunkID{2}));
+  EXPECT_EQ(table->get_chunk(ChunkID{1}), original_table->get_chunk(ChunkID{3}));
+  EXPECT_EQ(gt->description(DescriptionMode::SingleLine),
+            "GetTable (tableWithValues) (1 Runtime Filters, 2 Chunks pruned)");
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeFilterDistinctValues) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->add_runtime_filter(make_join_keys({12, 12345}), ColumnID{0}, ColumnID{0});
+  gt->execute();
+
+  // All chunks are within [12, 12345], but the one with 123 contains none of the values
+  auto original_table = StorageManager::get().get_table("tableWithValues");
+  auto table = gt->get_output();
+  ASSERT_EQ(table->chunk_count(), ChunkID(3));
+  EXPECT_EQ(table->get_chunk(ChunkID{2}), original_table->get_chunk(ChunkID{3}));
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeFilterCombinedWithExcludedChunks) {
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->set_excluded_chunk_ids({ChunkID(3)});
+  gt->add_runtime_filter(make_join_keys({}), ColumnID{0}, ColumnID{0});
+  gt->execute();
+
+  // Without any join key, all chunks are pruned
+  EXPECT_EQ(gt->get_output()->chunk_count(), ChunkID(0));
+  EXPECT_EQ(gt->description(DescriptionMode::SingleLine),
+            "GetTable (tableWithValues) (1 Chunks pruned) (1 Runtime Filters, 3 Chunks pruned)");
+}
+
+TEST_F(OperatorsGetTableTest, RuntimeFilterDeepCopy) {
+  const auto join_keys = make_join_keys({123});
+  auto gt = std::make_shared<opossum::GetTable>("tableWithValues");
+  gt->add_runtime_filter(join_keys, ColumnID{0}, ColumnID{0});
+  gt->add_runtime_filter(join_keys, ColumnID{0}, ColumnID{0});
+  EXPECT_THROW(gt->add_runtime_filter(join_keys, ColumnID{0}, ColumnID{0}), std::logic_error);
+
+  const auto copy = std::dynamic_pointer_cast<GetTable>(gt->deep_copy());
+  ASSERT_TRUE(copy);
+  EXPECT_EQ(copy->runtime_filter_count(), 2u);
+  // Both filters share their source operator, which stays the case for the copy
+  ASSERT_TRUE(copy->input_left());
+  EXPECT_EQ(copy->input_left(), copy->input_right());
+  EXPECT_NE(copy->input_left(), join_keys);
+
+  copy->mutable_input_left()->execute();
+  copy->execute();
+  EXPECT_EQ(copy->get_output()->row_count(), 1u);
+}
+
 }  // namespace opossum
@@ -13,6 +13,14 @@
 #include "operators/projection.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "statistics/chunk_statistics/chunk_statistics.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_sketch.hpp"
+#include "storage/base_dictionary_segment.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -283,4 +291,110 @@ TEST_F(OperatorsInsertTest, InsertIntoEmptyTable) {
   EXPECT_TABLE_EQ_ORDERED(target_table, table_int_float)
 }
 
+TEST_F(OperatorsInsertTest, EncodeFullChunksOnCommit) {
+  // 3 Rows, chunk_size = 2
+  auto t = load_table("resources/test_data/tbl/int.tbl", 2u);
+  t->set_chunk_encoding_spec(ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}});
+  StorageManager::get().add_table("test1", t);
+
+  // 10 Rows
+  auto t2 = load_table("resources/test_data/tbl/10_ints.tbl");
+  StorageManager::get().add_table("test2", t2);
+
+  auto gt2 = std::make_shared<GetTable>("test2");
+  gt2->execute();
+
+  auto ins = std::make_shared<Insert>("test1", gt2);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+
+  // Chunks filled by the Insert are immutable right away, but only encoded once their rows are committed
+  ASSERT_EQ(t->chunk_count(), 7u);
+  EXPECT_FALSE(t->get_chunk(ChunkID{1})->is_mutable());
+  EXPECT_TRUE(t->get_chunk(ChunkID{6})->is_mutable());
+  EXPECT_EQ(std::dynamic_pointer_cast<const BaseDictionarySegment>(t->get_chunk(ChunkID{1})->get_segment(ColumnID{0})),
+            nullptr);
+
+  context->commit();
+
+  // Chunk 0 was not touched by the Insert and chunk 6 is not full yet
+  for (auto chunk_id = ChunkID{1}; chunk_id < ChunkID{6}; ++chunk_id) {
+    const auto chunk = t->get_chunk(chunk_id);
+    EXPECT_NE(std::dynamic_pointer_cast<const BaseDictionarySegment>(chunk->get_segment(ColumnID{0})), nullptr);
+    EXPECT_NE(chunk->statistics(), nullptr);
+  }
+  EXPECT_EQ(std::dynamic_pointer_cast<const BaseDictionarySegment>(t->get_chunk(ChunkID{0})->get_segment(ColumnID{0})),
+            nullptr);
+  EXPECT_EQ(std::dynamic_pointer_cast<const BaseDictionarySegment>(t->get_chunk(ChunkID{6})->get_segment(ColumnID{0})),
+            nullptr);
+
+  auto gt3 = std::make_shared<GetTable>("test1");
+  gt3->execute();
+  auto validate = std::make_shared<Validate>(gt3);
+  validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  validate->execute();
+  EXPECT_EQ(validate->get_output()->row_count(), 13u);
+}
+
+TEST_F(OperatorsInsertTest, UpdatesTableStatisticsInBackground) {
+  auto t = load_table("resources/test_data/tbl/int.tbl", 2u);
+  StorageManager::get().add_table("test1", t);
+  StorageManager::get().add_table("test2", load_table("resources/test_data/tbl/10_ints.tbl"));
+  ASSERT_EQ(t->table_statistics()->row_count(), 3.0f);
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto gt = std::make_shared<GetTable>("test2");
+  gt->execute();
+
+  auto ins = std::make_shared<Insert>("test1", gt);
+  auto context = TransactionManager::get().new_transaction_context();
+  ins->set_transaction_context(context);
+  ins->execute();
+  context->commit();
+
+  // Waits for the TableStatisticsUpdateTask scheduled by the commit
+  CurrentScheduler::set(nullptr);
+  EXPECT_EQ(t->table_statistics()->row_count(), 13.0f);
+}
+
+TEST_F(OperatorsInsertTest, TableStatisticsIgnoreChunksBeingWritten) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int}};
+  const auto target_table = std::make_shared<Table>(column_definitions, TableType::Data, 4, UseMvcc::Yes);
+  StorageManager::get().add_table("target_table", target_table);
+
+  auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({1});
+  values->append({2});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  // Both Inserts write into the first chunk. The second one fills it, so that it becomes immutable, while the rows of
+  // the first one are not committed yet.
+  const auto first_insert = std::make_shared<Insert>("target_table", table_wrapper);
+  const auto first_context = TransactionManager::get().new_transaction_context();
+  first_insert->set_transaction_context(first_context);
+  first_insert->execute();
+
+  const auto second_insert = std::make_shared<Insert>("target_table", table_wrapper);
+  const auto second_context = TransactionManager::get().new_transaction_context();
+  second_insert->set_transaction_context(second_context);
+  second_insert->execute();
+  ASSERT_EQ(target_table->chunk_count(), 1u);
+  ASSERT_FALSE(target_table->get_chunk(ChunkID{0})->is_mutable());
+
+  // The chunk might still change until all its rows are committed, so it is not merged into the statistics sketch
+  second_context->commit();
+  update_table_statistics(*target_table);
+  EXPECT_EQ(target_table->table_statistics_sketch()->merged_chunk_count(), ChunkID{0});
+  EXPECT_EQ(target_table->table_statistics()->row_count(), 4.0f);
+
+  first_context->commit();
+  update_table_statistics(*target_table);
+  EXPECT_EQ(target_table->table_statistics_sketch()->merged_chunk_count(), ChunkID{1});
+  EXPECT_EQ(target_table->table_statistics()->row_count(), 4.0f);
+}
+
 }  // namespace opossum
@@ -0,0 +1,92 @@
+#include "../base_test.hpp"
+
+#include "cost_model/cost_model_calibrated.hpp"
+#include "operators/join_adaptive.hpp"
+#include "operators/join_hash.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class JoinAdaptiveTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_small = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float.tbl", 2));
+    _table_wrapper_small->execute();
+
+    _table_wrapper_large = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+    _table_wrapper_large->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_small, _table_wrapper_large;
+};
+
+TEST_F(JoinAdaptiveTest, OperatorName) {
+  auto join = std::make_shared<JoinAdaptive>(_table_wrapper_small, _table_wrapper_large, JoinMode::Inner,
+                                             ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+
+  EXPECT_EQ(join->name(), "JoinAdaptive");
+}
+
+TEST_F(JoinAdaptiveTest, RecordsSelectedImplementation) {
+  auto join = std::make_shared<JoinAdaptive>(_table_wrapper_large, _table_wrapper_small, JoinMode::Inner,
+                                             ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join->execute();
+
+  const auto& performance_data = static_cast<const JoinAdaptive::PerformanceData&>(join->performance_data());
+  EXPECT_EQ(performance_data.join_implementation, OperatorType::JoinHash);
+
+  // The larger left input is probed
+  EXPECT_NE(performance_data.to_string().find("executed as JoinHash"), std::string::npos);
+  EXPECT_NE(performance_data.to_string().find("left input probed"), std::string::npos);
+
+  auto join_hash = std::make_shared<JoinHash>(_table_wrapper_large, _table_wrapper_small, JoinMode::Inner,
+                                              ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  join_hash->execute();
+  EXPECT_TABLE_EQ_UNORDERED(join->get_output(), join_hash->get_output());
+}
+
+TEST_F(JoinAdaptiveTest, SelectsImplementationByCost) {
+  // For small inputs, the nested loop join is the cheapest non-equi join
+  auto join = std::make_shared<JoinAdaptive>(_table_wrapper_small, _table_wrapper_large, JoinMode::Inner,
+                                             ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::LessThan);
+  EXPECT_EQ(join->select_join_implementation(), OperatorType::JoinNestedLoop);
+
+  auto coefficients = CostModelCoefficients::defaults();
+  coefficients.operators[OperatorType::JoinSortMerge] = CostFunctionCoefficients{};
+  const auto cost_model = std::make_shared<CostModelCalibrated>(coefficients);
+
+  auto join_sort_merge =
+      std::make_shared<JoinAdaptive>(_table_wrapper_small, _table_wrapper_large, JoinMode::Inner,
+                                     ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::LessThan,
+                                     std::nullopt, cost_model);
+  EXPECT_EQ(join_sort_merge->select_join_implementation(), OperatorType::JoinSortMerge);
+
+  // A copy keeps the cost model
+  const auto copy = std::static_pointer_cast<JoinAdaptive>(join_sort_merge->deep_copy());
+  copy->mutable_input_left()->execute();
+  copy->mutable_input_right()->execute();
+  EXPECT_EQ(copy->select_join_implementation(), OperatorType::JoinSortMerge);
+}
+
+TEST_F(JoinAdaptiveTest, IndexOnRightInput) {
+  const auto table = load_table("resources/test_data/tbl/int_float4.tbl", 2);
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    table->get_chunk(chunk_id)->create_index<GroupKeyIndex>(std::vector<ColumnID>{ColumnID{0}});
+  }
+  const auto table_wrapper_indexed = std::make_shared<TableWrapper>(table);
+  table_wrapper_indexed->execute();
+
+  auto join = std::make_shared<JoinAdaptive>(_table_wrapper_small, table_wrapper_indexed, JoinMode::Inner,
+                                             ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  EXPECT_EQ(join->select_join_implementation(), OperatorType::JoinIndex);
+
+  // The index is only used if it is on the right input
+  auto join_swapped =
+      std::make_shared<JoinAdaptive>(table_wrapper_indexed, _table_wrapper_small, JoinMode::Inner,
+                                     ColumnIDPair(ColumnID{0}, ColumnID{0}), PredicateCondition::Equals);
+  EXPECT_EQ(join_swapped->select_join_implementation(), OperatorType::JoinHash);
+}
+
+}  // namespace opossum
@@ -165,6 +165,9 @@ TEST_F(OperatorDeepCopyTest, DeepCopyTableScan) {
   copied_scan->mutable_input_left()->execute();
   copied_scan->execute();
   EXPECT_TABLE_EQ_UNORDERED(copied_scan->get_output(), expected_result);
+
+  // The predicate has no parameters, so it is shared with the copy instead of being copied as well
+  EXPECT_EQ(std::static_pointer_cast<TableScan>(copied_scan)->predicate(), scan->predicate());
 }
 
 TEST_F(OperatorDeepCopyTest, DiamondShape) {
@@ -9,8 +9,10 @@
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "operators/get_table.hpp"
+#include "operators/insert.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
@@ -82,4 +84,50 @@ TEST_F(OperatorsUpdateTest, UpdateNone) {
   helper(greater_than_(column_a, 100'000), expression_vector(1, 1.5f), "resources/test_data/tbl/int_float2.tbl");
 }
 
+TEST_F(OperatorsUpdateTest, UpdateOwnInserts) {
+  const auto values_to_insert = load_table("resources/test_data/tbl/int_float2.tbl");
+  const auto table = std::make_shared<Table>(values_to_insert->column_definitions(), TableType::Data, 2, UseMvcc::Yes);
+  StorageManager::get().add_table("own_inserts_table", table);
+
+  const auto transaction_context = TransactionManager::get().new_transaction_context();
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(values_to_insert);
+  table_wrapper->execute();
+  const auto insert = std::make_shared<Insert>("own_inserts_table", table_wrapper);
+  insert->set_transaction_context(transaction_context);
+  insert->execute();
+
+  const auto get_table = std::make_shared<GetTable>("own_inserts_table");
+  get_table->execute();
+  const auto validate = std::make_shared<Validate>(get_table);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+  const auto where_scan = std::make_shared<TableScan>(validate, greater_than_(column_a, 100));
+  where_scan->execute();
+  const auto updated_values_projection = std::make_shared<Projection>(where_scan, expression_vector(column_a, 7.5f));
+  updated_values_projection->execute();
+
+  const auto update = std::make_shared<Update>("own_inserts_table", where_scan, updated_values_projection);
+  update->set_transaction_context(transaction_context);
+  update->execute();
+  EXPECT_FALSE(update->execute_failed());
+  transaction_context->commit();
+
+  // The updated rows are appended as new row versions. Results that were computed before the Update, and that still
+  // reference the old rows, must not change.
+  EXPECT_EQ(table->row_count(), 7u);
+  for (auto row_idx = size_t{0}; row_idx < where_scan->get_output()->row_count(); ++row_idx) {
+    EXPECT_NE(where_scan->get_output()->get_value<float>(ColumnID{1}, row_idx), 7.5f);
+  }
+
+  const auto post_update_get_table = std::make_shared<GetTable>("own_inserts_table");
+  post_update_get_table->execute();
+  const auto post_update_validate = std::make_shared<Validate>(post_update_get_table);
+  post_update_validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+  post_update_validate->execute();
+
+  EXPECT_TABLE_EQ_UNORDERED(post_update_validate->get_output(),
+                            load_table("resources/test_data/tbl/int_float2_updated_0.tbl"));
+}
+
 }  // namespace opossum
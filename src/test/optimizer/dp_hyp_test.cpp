@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "optimizer/join_ordering/dp_hyp.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "testing_assert.hpp"
+
+/**
+ * DpHyp shares the placement of local, join and uncorrelated predicates with DpCcp, which is tested in dp_ccp_test.cpp.
+ * Here, we test what is specific to DpHyp: hyperedges connecting vertices and the enumeration budget.
+ */
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class DpHypTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    cost_estimator = std::make_shared<CostModelLogical>();
+
+    const auto column_statistics_a_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 50);
+    const auto column_statistics_b_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 40, 100);
+    const auto column_statistics_c_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 100);
+
+    const auto table_statistics_a = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_a_a});
+    const auto table_statistics_b = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_b_a});
+    const auto table_statistics_c = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_c_a});
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_a->set_statistics(table_statistics_a);
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    node_b->set_statistics(table_statistics_b);
+    node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "c");
+    node_c->set_statistics(table_statistics_c);
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  LQPColumnReference a_a, b_a, c_a;
+};
+
+TEST_F(DpHypTest, HyperEdgeConnectsVertices) {
+  /**
+   * C is only connected to A and B via the hyperedge "a + b = c". DpCcp, which only considers binary edges, would fail
+   * to join C in. DpHyp joins it as soon as A and B are joined.
+   */
+
+  const auto hyper_edge_predicate = equals_(add_(a_a, b_a), c_a);
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b111}, expression_vector(hyper_edge_predicate)};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_b_c}));
+  DpHyp dp_hyp{cost_estimator};
+
+  const auto actual_lqp = dp_hyp(join_graph);
+
+  // clang-format off
+  const auto expected_lqp =
+  PredicateNode::make(hyper_edge_predicate,
+    JoinNode::make(JoinMode::Cross,
+      JoinNode::make(JoinMode::Inner, equals_(a_a, b_a),
+        node_a,
+        node_b),
+      node_c));
+  // clang-format on
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(DpHypTest, BudgetExceeded) {
+  // A chain A <-> B <-> C has four csg-cmp-pairs: (A, B), (B, C), (A, BC), (AB, C)
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_b_c = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector(equals_(b_a, c_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_b_c}));
+
+  EXPECT_EQ(DpHyp(cost_estimator, 3)(join_graph), nullptr);
+  EXPECT_NE(DpHyp(cost_estimator, 4)(join_graph), nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include "gtest/gtest.h"
+
+#include "cost_model/cost_model_logical.hpp"
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "optimizer/join_ordering/join_graph.hpp"
+#include "optimizer/join_ordering/linearized_dp.hpp"
+#include "statistics/column_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class LinearizedDpTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    cost_estimator = std::make_shared<CostModelLogical>();
+
+    const auto column_statistics_a_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 50);
+    const auto column_statistics_b_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 40, 100);
+    const auto column_statistics_c_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 100);
+    const auto column_statistics_d_a = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 100);
+
+    const auto table_statistics_a = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_a_a});
+    const auto table_statistics_b = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_b_a});
+    const auto table_statistics_c = std::make_shared<TableStatistics>(
+        TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_c_a});
+    const auto table_statistics_d = std::make_shared<TableStatistics>(
+        TableType::Data, 200, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics_d_a});
+
+    node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "a");
+    node_a->set_statistics(table_statistics_a);
+    node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "b");
+    node_b->set_statistics(table_statistics_b);
+    node_c = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "c");
+    node_c->set_statistics(table_statistics_c);
+    node_d = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "d");
+    node_d->set_statistics(table_statistics_d);
+
+    a_a = node_a->get_column("a");
+    b_a = node_b->get_column("a");
+    c_a = node_c->get_column("a");
+    d_a = node_d->get_column("a");
+  }
+
+  std::shared_ptr<MockNode> node_a, node_b, node_c, node_d;
+  std::shared_ptr<AbstractCostEstimator> cost_estimator;
+  LQPColumnReference a_a, b_a, c_a, d_a;
+};
+
+TEST_F(LinearizedDpTest, AvoidsCrossJoins) {
+  /**
+   * The chain B <-> A <-> D <-> C is passed in an order where neighbouring vertices are not connected. The linear order
+   * needs to follow the edges, otherwise the dynamic programming could only build plans with cross joins.
+   */
+
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{4, 0b0011}, expression_vector(equals_(a_a, b_a))};
+  const auto join_edge_a_d = JoinGraphEdge{JoinGraphVertexSet{4, 0b1001}, expression_vector(equals_(a_a, d_a))};
+  const auto join_edge_c_d = JoinGraphEdge{JoinGraphVertexSet{4, 0b1100}, expression_vector(equals_(c_a, d_a))};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_c, node_d}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, join_edge_a_d, join_edge_c_d}));
+  LinearizedDp linearized_dp{cost_estimator};
+
+  const auto actual_lqp = linearized_dp(join_graph);
+
+  auto inner_join_count = size_t{0};
+  auto vertex_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) {
+      EXPECT_EQ(std::static_pointer_cast<JoinNode>(node)->join_mode, JoinMode::Inner);
+      ++inner_join_count;
+    } else if (node->type == LQPNodeType::Mock) {
+      ++vertex_count;
+    }
+    return LQPVisitation::VisitInputs;
+  });
+
+  EXPECT_EQ(inner_join_count, 3u);
+  EXPECT_EQ(vertex_count, 4u);
+}
+
+TEST_F(LinearizedDpTest, DisconnectedVertices) {
+  // D is only connected via a cross edge, so it has to be cross joined
+  const auto join_edge_a_b = JoinGraphEdge{JoinGraphVertexSet{3, 0b011}, expression_vector(equals_(a_a, b_a))};
+  const auto cross_edge_b_d = JoinGraphEdge{JoinGraphVertexSet{3, 0b110}, expression_vector()};
+
+  const auto join_graph = JoinGraph(std::vector<std::shared_ptr<AbstractLQPNode>>({node_a, node_b, node_d}),
+                                    std::vector<JoinGraphEdge>({join_edge_a_b, cross_edge_b_d}));
+  LinearizedDp linearized_dp{cost_estimator};
+
+  const auto actual_lqp = linearized_dp(join_graph);
+
+  ASSERT_EQ(actual_lqp->type, LQPNodeType::Join);
+  EXPECT_EQ(std::static_pointer_cast<JoinNode>(actual_lqp)->join_mode, JoinMode::Cross);
+}
+
+}  // namespace opossum
@@ -1,9 +1,15 @@
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #include "cost_model/cost_model_logical.hpp"
 #include "expression/expression_functional.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/mock_node.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "optimizer/strategy/join_ordering_rule.hpp"
@@ -87,4 +93,40 @@ TEST_F(JoinOrderingRuleTest, MultipleJoinGraphs) {
   EXPECT_LQP_EQ(actual_lqp, expected_lqp);
 }
 
+TEST_F(JoinOrderingRuleTest, LargeStarQueryFallsBackToLinearizedDp) {
+  // Star queries are the worst case for DpHyp: Each subset of the leaves joined with the center is a connected
+  // subgraph. With 24 leaves, DpHyp exhausts its budget and has to give up quickly instead of enumerating 2^24 subsets.
+  const auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(0.0f, 10.0f, 1, 50);
+  const auto table_statistics = std::make_shared<TableStatistics>(
+      TableType::Data, 20, std::vector<std::shared_ptr<const BaseColumnStatistics>>{column_statistics});
+
+  const auto center = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "center");
+  center->set_statistics(table_statistics);
+
+  constexpr auto LEAF_COUNT = size_t{24};
+  auto input_lqp = std::shared_ptr<AbstractLQPNode>{center};
+  for (auto leaf_idx = size_t{0}; leaf_idx < LEAF_COUNT; ++leaf_idx) {
+    const auto leaf =
+        MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}}, "leaf" + std::to_string(leaf_idx));
+    leaf->set_statistics(table_statistics);
+    input_lqp =
+        JoinNode::make(JoinMode::Inner, equals_(center->get_column("a"), leaf->get_column("a")), input_lqp, leaf);
+  }
+
+  const auto started = std::chrono::steady_clock::now();
+  const auto actual_lqp = apply_rule(rule, input_lqp);
+  const auto duration = std::chrono::steady_clock::now() - started;
+
+  auto join_count = size_t{0};
+  visit_lqp(actual_lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::Join) ++join_count;
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_EQ(join_count, LEAF_COUNT);
+
+  // Generous, so that the test does not fail on slow (e.g., sanitized) builds. Materializing all 2^24 subsets of the
+  // center's neighborhood before checking the budget takes far longer.
+  EXPECT_LT(duration, std::chrono::seconds{10});
+}
+
 }  // namespace opossum
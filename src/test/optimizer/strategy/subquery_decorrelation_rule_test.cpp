@@ -0,0 +1,235 @@
+#include "gtest/gtest.h"
+
+#include "strategy_base_test.hpp"
+#include "testing_assert.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/subquery_decorrelation_rule.hpp"
+#include "storage/storage_manager.hpp"
+#include "utils/load_table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class SubqueryDecorrelationRuleTest : public StrategyBaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_int2.tbl"));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl"));
+
+    node_table_a = StoredTableNode::make("table_a");
+    node_table_a_col_a = node_table_a->get_column("a");
+    node_table_a_col_b = node_table_a->get_column("b");
+
+    node_table_b = StoredTableNode::make("table_b");
+    node_table_b_col_a = node_table_b->get_column("a");
+    node_table_b_col_b = node_table_b->get_column("b");
+
+    parameter = correlated_parameter_(ParameterID{0}, node_table_a_col_a);
+
+    _rule = std::make_shared<SubqueryDecorrelationRule>();
+  }
+
+  std::shared_ptr<AbstractLQPNode> apply_decorrelation_rule(const std::shared_ptr<AbstractLQPNode>& lqp) {
+    auto copied_lqp = lqp->deep_copy();
+    StrategyBaseTest::apply_rule(_rule, copied_lqp);
+
+    return copied_lqp;
+  }
+
+  std::shared_ptr<SubqueryDecorrelationRule> _rule;
+
+  std::shared_ptr<StoredTableNode> node_table_a, node_table_b;
+  LQPColumnReference node_table_a_col_a, node_table_a_col_b, node_table_b_col_a, node_table_b_col_b;
+  std::shared_ptr<AbstractExpression> parameter;
+};
+
+TEST_F(SubqueryDecorrelationRuleTest, ScalarAggregateToJoin) {
+  // SELECT * FROM table_a WHERE table_a.b < (SELECT MAX(table_b.b) FROM table_b WHERE table_b.a = table_a.a)
+
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      ValidateNode::make(
+        node_table_b)));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(less_than_(node_table_a_col_b, max_(node_table_b_col_b)),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(max_(node_table_b_col_b)),
+          ValidateNode::make(
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, ScalarAggregateWithProjectionToJoin) {
+  // Shaped like TPC-H Q17:
+  // SELECT * FROM table_a WHERE table_a.b < (SELECT 0.2 * AVG(table_b.b) FROM table_b WHERE table_b.a = table_a.a)
+
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(mul_(0.2, avg_(node_table_b_col_b))),
+    AggregateNode::make(expression_vector(), expression_vector(avg_(node_table_b_col_b)),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(less_than_(node_table_a_col_b, mul_(0.2, avg_(node_table_b_col_b))),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        ProjectionNode::make(expression_vector(node_table_b_col_a, mul_(0.2, avg_(node_table_b_col_b))),
+          AggregateNode::make(expression_vector(node_table_b_col_a), expression_vector(avg_(node_table_b_col_b)),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, InToJoin) {
+  // SELECT * FROM table_a WHERE table_a.b IN (SELECT table_b.b FROM table_b WHERE table_a.a = table_b.a)
+
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_b),
+    PredicateNode::make(equals_(parameter, node_table_b_col_a),
+      node_table_b));
+
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(in_(node_table_a_col_b, subquery),
+    node_table_a);
+
+  const auto expected_lqp =
+  ProjectionNode::make(expression_vector(node_table_a_col_a, node_table_a_col_b),
+    PredicateNode::make(equals_(node_table_a_col_b, node_table_b_col_b),
+      JoinNode::make(JoinMode::Inner, equals_(node_table_a_col_a, node_table_b_col_a),
+        node_table_a,
+        AggregateNode::make(expression_vector(node_table_b_col_a, node_table_b_col_b), expression_vector(),
+          ProjectionNode::make(expression_vector(node_table_b_col_b, node_table_b_col_a),
+            node_table_b)))));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(_rule, input_lqp);
+
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+}
+
+/*
+  The following cases test whether subqueries we do not decorrelate are really not modified by the rule.
+*/
+TEST_F(SubqueryDecorrelationRuleTest, NoRewriteOfCount) {
+  // COUNT(*) returns 0 for outer rows without a join partner, so a join would drop rows like `WHERE 0 = (...)`
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(count_star_()),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(equals_(0, subquery),
+    node_table_a);
+  // clang-format on
+
+  EXPECT_LQP_EQ(this->apply_decorrelation_rule(input_lqp), input_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, NoRewriteOfNotIn) {
+  // clang-format off
+  const auto subquery_lqp =
+  ProjectionNode::make(expression_vector(node_table_b_col_b),
+    PredicateNode::make(equals_(node_table_b_col_a, parameter),
+      node_table_b));
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(not_in_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  EXPECT_LQP_EQ(this->apply_decorrelation_rule(input_lqp), input_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, NoRewriteOfInequalityCorrelation) {
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    PredicateNode::make(less_than_(node_table_b_col_a, parameter),
+      node_table_b));
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  EXPECT_LQP_EQ(this->apply_decorrelation_rule(input_lqp), input_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, NoRewriteOfParameterUsedMoreThanOnce) {
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    PredicateNode::make(less_than_(node_table_b_col_b, parameter),
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b)));
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  EXPECT_LQP_EQ(this->apply_decorrelation_rule(input_lqp), input_lqp);
+}
+
+TEST_F(SubqueryDecorrelationRuleTest, NoRewriteOfCorrelationBelowJoin) {
+  // Pulling the correlated predicate above the join would change the result of the (cross) join
+  // clang-format off
+  const auto subquery_lqp =
+  AggregateNode::make(expression_vector(), expression_vector(max_(node_table_b_col_b)),
+    JoinNode::make(JoinMode::Cross,
+      PredicateNode::make(equals_(node_table_b_col_a, parameter),
+        node_table_b),
+      node_table_a));
+  const auto subquery = lqp_subquery_(subquery_lqp, std::make_pair(ParameterID{0}, node_table_a_col_a));
+
+  const auto input_lqp =
+  PredicateNode::make(less_than_(node_table_a_col_b, subquery),
+    node_table_a);
+  // clang-format on
+
+  EXPECT_LQP_EQ(this->apply_decorrelation_rule(input_lqp), input_lqp);
+}
+
+}  // namespace opossum
@@ -1,4 +1,7 @@
+#include <chrono>
 #include <memory>
+#include <optional>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -8,10 +11,13 @@
 #include "expression/expression_functional.hpp"
 #include "operators/get_table.hpp"
 #include "operators/table_scan.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/resource_group.hpp"
+#include "scheduler/task_queue.hpp"
 #include "scheduler/topology.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -258,4 +264,138 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   CurrentScheduler::get()->finish();
 }
 
+TEST_F(SchedulerTest, TasksInheritQueryClass) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto subtask_query_class = std::optional<QueryClass>{};
+  auto task = std::make_shared<JobTask>([&]() {
+    auto subtask = std::make_shared<JobTask>([]() {});
+    subtask_query_class = subtask->query_class();
+
+    subtask->schedule();
+    CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{subtask});
+  });
+  EXPECT_EQ(task->query_class(), QueryClass::Analytical);
+  task->set_query_class(QueryClass::Transactional);
+
+  task->schedule();
+  CurrentScheduler::wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task});
+  EXPECT_EQ(subtask_query_class, QueryClass::Transactional);
+
+  // Outside of tasks, the default class applies again
+  EXPECT_EQ(AbstractTask::current_query_class(), QueryClass::Analytical);
+}
+
+TEST_F(SchedulerTest, CancelledQueriesSkipTheirRemainingTasks) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto executed_task_count = std::atomic_uint{0};
+  auto waiting_for_subtasks_threw = std::atomic_bool{false};
+
+  auto task = std::make_shared<JobTask>([&]() {
+    cancellation_token->cancel();
+
+    // The subtasks inherit the cancelled token
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto subtask_idx = 0; subtask_idx < 4; ++subtask_idx) {
+      subtasks.emplace_back(std::make_shared<JobTask>([&]() { ++executed_task_count; }));
+    }
+    CurrentScheduler::schedule_tasks(subtasks);
+
+    try {
+      CurrentScheduler::wait_for_tasks(subtasks);
+    } catch (const QueryCancelledException&) {
+      waiting_for_subtasks_threw = true;
+      throw;
+    }
+  });
+  auto successor = std::make_shared<JobTask>([&]() { ++executed_task_count; });
+  task->set_as_predecessor_of(successor);
+  task->set_cancellation_token(cancellation_token);
+  successor->set_cancellation_token(cancellation_token);
+
+  // The tasks are done nevertheless
+  CurrentScheduler::schedule_and_wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{task, successor});
+  EXPECT_EQ(executed_task_count, 0u);
+  EXPECT_TRUE(waiting_for_subtasks_threw);
+  EXPECT_EQ(AbstractTask::current_cancellation_token(), nullptr);
+}
+
+TEST_F(SchedulerTest, CancellationTokenTimesOut) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  cancellation_token->set_timeout(std::chrono::hours{1});
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+  EXPECT_NO_THROW(CancellationToken::check(cancellation_token));
+
+  cancellation_token->set_timeout(std::chrono::milliseconds{0});
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  EXPECT_THROW(CancellationToken::check(cancellation_token), QueryCancelledException);
+}
+
+TEST_F(SchedulerTest, TaskQueueServesQueryClassesByWeight) {
+  ResourceGroup::get(QueryClass::Transactional).set_weight(3);
+  ResourceGroup::get(QueryClass::Analytical).set_weight(1);
+
+  auto task_queue = TaskQueue{NodeID{0}};
+  for (auto task_idx = 0; task_idx < 8; ++task_idx) {
+    for (const auto query_class : {QueryClass::Analytical, QueryClass::Transactional}) {
+      auto task = std::make_shared<JobTask>([]() {});
+      task->set_query_class(query_class);
+      task_queue.push(task, static_cast<uint32_t>(SchedulePriority::Default));
+    }
+  }
+
+  // While both classes have tasks, three out of four tasks are Transactional
+  auto transactional_task_count = 0;
+  for (auto task_idx = 0; task_idx < 8; ++task_idx) {
+    if (task_queue.pull()->query_class() == QueryClass::Transactional) ++transactional_task_count;
+  }
+  EXPECT_EQ(transactional_task_count, 6);
+
+  // Afterwards, the remaining tasks are pulled without delay
+  for (auto task_idx = 0; task_idx < 8; ++task_idx) {
+    EXPECT_NE(task_queue.pull(), nullptr);
+  }
+  EXPECT_TRUE(task_queue.empty());
+}
+
+TEST_F(SchedulerTest, ResourceGroupLimitsConcurrentQueries) {
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+
+  auto& resource_group = ResourceGroup::get(QueryClass::Analytical);
+  resource_group.set_max_concurrent_queries(1);
+
+  auto first_query_may_finish = std::atomic_bool{false};
+  const auto first_query_tasks = std::vector<std::shared_ptr<AbstractTask>>{std::make_shared<JobTask>([&]() {
+    while (!first_query_may_finish) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  })};
+
+  auto second_query_executed = std::atomic_bool{false};
+  const auto second_query_tasks =
+      std::vector<std::shared_ptr<AbstractTask>>{std::make_shared<JobTask>([&]() { second_query_executed = true; })};
+
+  resource_group.schedule_query_tasks(first_query_tasks);
+  resource_group.schedule_query_tasks(second_query_tasks);
+
+  // The second query waits for the first one to be done
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(resource_group.running_query_count(), 1u);
+  EXPECT_EQ(resource_group.waiting_query_count(), 1u);
+  EXPECT_FALSE(second_query_executed);
+
+  first_query_may_finish = true;
+  CurrentScheduler::wait_for_tasks(second_query_tasks);
+  EXPECT_TRUE(second_query_executed);
+  EXPECT_EQ(resource_group.waiting_query_count(), 0u);
+
+  CurrentScheduler::get()->finish();
+  EXPECT_EQ(resource_group.running_query_count(), 0u);
+}
+
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "server/data_row_serializer.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class DataRowSerializerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Double, true},
+                                                            {"c", DataType::String}},
+                                     TableType::Data, 2);
+    _table->append({-12, 1.5, "x"});
+    _table->append({3, NULL_VALUE, "yz"});
+    _table->append({4, 2.0, ""});
+  }
+
+  static void append_int32(ByteBuffer& buffer, const uint32_t value) {
+    for (auto shift = 24; shift >= 0; shift -= 8) {
+      buffer.push_back(static_cast<char>((value >> shift) & 0xFF));
+    }
+  }
+
+  static void append_text(ByteBuffer& buffer, const std::string& value) {
+    append_int32(buffer, static_cast<uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(DataRowSerializerTest, TextFormat) {
+  auto data_row_serializer = DataRowSerializer{*_table};
+
+  // Each DataRow message consists of 'D', the message length (including itself), the column count, and the values
+  auto expected_batch = ByteBuffer{};
+  expected_batch.push_back('D');
+  append_int32(expected_batch, 4 + 2 + (4 + 3) + (4 + 8) + (4 + 1));
+  expected_batch.insert(expected_batch.end(), {0, 3});
+  append_text(expected_batch, "-12");
+  append_text(expected_batch, "1.500000");
+  append_text(expected_batch, "x");
+
+  expected_batch.push_back('D');
+  append_int32(expected_batch, 4 + 2 + (4 + 1) + 4 + (4 + 2));
+  expected_batch.insert(expected_batch.end(), {0, 3});
+  append_text(expected_batch, "3");
+  append_int32(expected_batch, static_cast<uint32_t>(-1));
+  append_text(expected_batch, "yz");
+
+  expected_batch.push_back('D');
+  append_int32(expected_batch, 4 + 2 + (4 + 1) + (4 + 8) + 4);
+  expected_batch.insert(expected_batch.end(), {0, 3});
+  append_text(expected_batch, "4");
+  append_text(expected_batch, "2.000000");
+  append_text(expected_batch, "");
+
+  EXPECT_EQ(data_row_serializer.serialize_next_batch(1'000), expected_batch);
+  EXPECT_TRUE(data_row_serializer.serialize_next_batch(1'000).empty());
+}
+
+TEST_F(DataRowSerializerTest, BinaryFormat) {
+  auto data_row_serializer = DataRowSerializer{*_table, {ResultFormat::Binary}};
+
+  // The first row only, as the batch is complete once it holds at least one byte
+  auto expected_batch = ByteBuffer{};
+  expected_batch.push_back('D');
+  append_int32(expected_batch, 4 + 2 + (4 + 4) + (4 + 8) + (4 + 1));
+  expected_batch.insert(expected_batch.end(), {0, 3});
+  append_int32(expected_batch, 4);
+  append_int32(expected_batch, static_cast<uint32_t>(-12));
+
+  // 1.5 as IEEE 754 double precision number
+  append_int32(expected_batch, 8);
+  append_int32(expected_batch, 0x3FF80000);
+  append_int32(expected_batch, 0);
+  append_text(expected_batch, "x");
+
+  EXPECT_EQ(data_row_serializer.serialize_next_batch(1), expected_batch);
+}
+
+TEST_F(DataRowSerializerTest, Batches) {
+  auto data_row_serializer = DataRowSerializer{*_table, {ResultFormat::Text, ResultFormat::Binary, ResultFormat::Text}};
+
+  // Batches end after the first row exceeding the minimum batch size, even across chunks
+  auto batch_sizes = std::vector<size_t>{};
+  for (auto batch = data_row_serializer.serialize_next_batch(30); !batch.empty();
+       batch = data_row_serializer.serialize_next_batch(30)) {
+    batch_sizes.emplace_back(batch.size());
+  }
+
+  const auto row_sizes = std::vector<size_t>{1 + 4 + 2 + (4 + 3) + (4 + 8) + (4 + 1), 1 + 4 + 2 + (4 + 1) + 4 + (4 + 2),
+                                             1 + 4 + 2 + (4 + 1) + (4 + 8) + 4};
+  EXPECT_EQ(batch_sizes, std::vector<size_t>({row_sizes[0], row_sizes[1] + row_sizes[2]}));
+}
+
+TEST_F(DataRowSerializerTest, ResolveResultFormats) {
+  EXPECT_EQ(DataRowSerializer::resolve_result_formats({}, 2),
+            std::vector<ResultFormat>({ResultFormat::Text, ResultFormat::Text}));
+  EXPECT_EQ(DataRowSerializer::resolve_result_formats({ResultFormat::Binary}, 2),
+            std::vector<ResultFormat>({ResultFormat::Binary, ResultFormat::Binary}));
+  EXPECT_EQ(DataRowSerializer::resolve_result_formats({ResultFormat::Text, ResultFormat::Binary}, 2),
+            std::vector<ResultFormat>({ResultFormat::Text, ResultFormat::Binary}));
+  EXPECT_THROW(DataRowSerializer::resolve_result_formats({ResultFormat::Text, ResultFormat::Binary}, 3),
+               std::logic_error);
+}
+
+}  // namespace opossum
@@ -7,8 +7,9 @@ namespace opossum {
 
 class MockConnection {
  public:
-  MOCK_METHOD0(receive_startup_packet_header, boost::future<uint32_t>());
-  MOCK_METHOD1(receive_startup_packet_body, boost::future<void>(uint32_t size));
+  MOCK_METHOD0(receive_startup_packet_header, boost::future<StartupPacketHeader>());
+  MOCK_METHOD1(receive_startup_packet_body, boost::future<StartupParameters>(uint32_t size));
+  MOCK_METHOD1(receive_cancel_request_body, boost::future<BackendKey>(uint32_t size));
 
   MOCK_METHOD0(receive_packet_header, boost::future<RequestHeader>());
   MOCK_METHOD1(receive_simple_query_packet_body, boost::future<std::string>(uint32_t size));
@@ -21,13 +22,14 @@ class MockConnection {
 
   MOCK_METHOD0(send_ssl_denied, boost::future<void>());
   MOCK_METHOD0(send_auth, boost::future<void>());
+  MOCK_METHOD1(send_backend_key_data, boost::future<void>(const BackendKey& backend_key));
   MOCK_METHOD2(send_parameter_status, boost::future<void>(const std::string& key, const std::string& value));
   MOCK_METHOD0(send_ready_for_query, boost::future<void>());
   MOCK_METHOD1(send_error, boost::future<void>(const std::string& message));
   MOCK_METHOD1(send_notice, boost::future<void>(const std::string& notice));
   MOCK_METHOD1(send_status_message, boost::future<void>(const NetworkMessageType& type));
   MOCK_METHOD1(send_row_description, boost::future<void>(const std::vector<ColumnDescription>& row_description));
-  MOCK_METHOD1(send_data_row, boost::future<void>(const std::vector<std::string>& row_strings));
+  MOCK_METHOD1(send_data_rows, boost::future<void>(const ByteBuffer& data_rows));
   MOCK_METHOD1(send_command_complete, boost::future<void>(const std::string& message));
 };
 
@@ -11,8 +11,10 @@
 #include "tasks/server/create_pipeline_task.hpp"
 #include "tasks/server/execute_server_prepared_statement_task.hpp"
 #include "tasks/server/execute_server_query_task.hpp"
+#include "tasks/server/fetch_server_result_chunks_task.hpp"
 #include "tasks/server/load_server_file_task.hpp"
 #include "tasks/server/parse_server_prepared_statement_task.hpp"
+#include "tasks/server/serialize_server_data_rows_task.hpp"
 
 namespace opossum {
 
@@ -27,7 +29,10 @@ class MockTaskRunner {
   MOCK_METHOD1(dispatch_server_task,
                boost::future<std::shared_ptr<const Table>>(std::shared_ptr<ExecuteServerPreparedStatementTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<ExecuteServerQueryTask>));
+  MOCK_METHOD1(dispatch_server_task,
+               boost::future<std::shared_ptr<const Table>>(std::shared_ptr<FetchServerResultChunksTask>));
   MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<LoadServerFileTask>));
+  MOCK_METHOD1(dispatch_server_task, boost::future<void>(std::shared_ptr<SerializeServerDataRowsTask>));
 };
 
 }  // namespace opossum
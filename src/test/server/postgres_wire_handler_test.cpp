@@ -54,8 +54,45 @@ TEST_F(PostgresWireHandlerTest, HandleStartupPackage) {
   _input_packet.data = buffer;
   _input_packet.offset = _input_packet.data.cbegin();
 
-  uint32_t result = postgres_wire_handler.handle_startup_package(_input_packet);
-  ASSERT_EQ(result, 92ul);  // 100 - 2 * sizeof(uint32_t)
+  const auto result = postgres_wire_handler.handle_startup_package(_input_packet);
+  ASSERT_EQ(result.request_type, StartupRequestType::Startup);
+  ASSERT_EQ(result.payload_length, 92ul);  // 100 - 2 * sizeof(uint32_t)
+}
+
+TEST_F(PostgresWireHandlerTest, HandleStartupPackageContent) {
+  const auto content = std::string{"user"} + '\0' + "postgres" + '\0' + "statement_timeout" + '\0' + "100" + '\0' +
+                       '\0';
+  _input_packet.data = ByteBuffer(content.begin(), content.end());
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto parameters = postgres_wire_handler.handle_startup_package_content(_input_packet);
+  ASSERT_EQ(parameters.size(), 2u);
+  EXPECT_EQ(parameters.at("user"), "postgres");
+  EXPECT_EQ(parameters.at("statement_timeout"), "100");
+}
+
+TEST_F(PostgresWireHandlerTest, HandleCancelRequest) {
+  ByteBuffer buffer = {};
+  const auto append_int32 = [&](const uint32_t value) {
+    const auto network_value = htonl(value);
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    buffer.insert(buffer.end(), chars, chars + sizeof(uint32_t));
+  };
+  append_int32(16);         // length
+  append_int32(80877102);   // cancel request code
+  append_int32(42);         // process id
+  append_int32(123456789);  // secret key
+  _input_packet.data = buffer;
+  _input_packet.offset = _input_packet.data.cbegin();
+
+  const auto header = postgres_wire_handler.handle_startup_package(_input_packet);
+  ASSERT_EQ(header.request_type, StartupRequestType::CancelRequest);
+  ASSERT_EQ(header.payload_length, 8ul);
+
+  _input_packet.offset = _input_packet.data.cbegin() + 2 * sizeof(uint32_t);
+  const auto backend_key = postgres_wire_handler.handle_cancel_request_packet(_input_packet);
+  EXPECT_EQ(backend_key.process_id, 42);
+  EXPECT_EQ(backend_key.secret_key, 123456789);
 }
 
 TEST_F(PostgresWireHandlerTest, WriteString) {
@@ -67,4 +104,70 @@ TEST_F(PostgresWireHandlerTest, WriteString) {
   // string should be terminated
   ASSERT_EQ(_output_packet.data[value.length()], '\0');
 }
+
+TEST_F(PostgresWireHandlerTest, HandleBindPacket) {
+  const auto append_int16 = [&](const uint16_t value) {
+    const auto network_value = htons(value);
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    _input_packet.data.insert(_input_packet.data.end(), chars, chars + sizeof(uint16_t));
+  };
+  const auto append_int32 = [&](const uint32_t value) {
+    const auto network_value = htonl(value);
+    const auto chars = reinterpret_cast<const char*>(&network_value);
+    _input_packet.data.insert(_input_packet.data.end(), chars, chars + sizeof(uint32_t));
+  };
+
+  // Portal and statement name
+  _input_packet.data = {'p', '\0', 's', '\0'};
+
+  // Format codes of the parameters: text, binary
+  append_int16(2);
+  append_int16(0);
+  append_int16(1);
+
+  // Parameter values: "12" and NULL
+  append_int16(2);
+  append_int32(2);
+  _input_packet.data.insert(_input_packet.data.end(), {'1', '2'});
+  append_int32(static_cast<uint32_t>(-1));
+
+  // A single result format code for all columns: binary
+  append_int16(1);
+  append_int16(1);
+
+  _input_packet.offset = _input_packet.data.cbegin();
+  const auto bind_packet = PostgresWireHandler::handle_bind_packet(_input_packet);
+
+  EXPECT_EQ(bind_packet.destination_portal, "p");
+  EXPECT_EQ(bind_packet.statement_name, "s");
+  EXPECT_EQ(bind_packet.params, std::vector<std::optional<ByteBuffer>>({ByteBuffer{'1', '2'}, std::nullopt}));
+  EXPECT_EQ(bind_packet.parameter_formats, std::vector<ResultFormat>({ResultFormat::Text, ResultFormat::Binary}));
+  EXPECT_EQ(bind_packet.result_formats, std::vector<ResultFormat>({ResultFormat::Binary}));
+}
+
+TEST_F(PostgresWireHandlerTest, DecodeParameter) {
+  const auto text = [](const std::string& value) { return std::optional<ByteBuffer>{{value.begin(), value.end()}}; };
+
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(text("-12"), ResultFormat::Text, 23), AllTypeVariant{int32_t{-12}});
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(text("1.5"), ResultFormat::Text, 701), AllTypeVariant{1.5});
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(text("abc"), ResultFormat::Text, 0),
+            AllTypeVariant{std::string{"abc"}});
+  EXPECT_TRUE(variant_is_null(PostgresWireHandler::decode_parameter(std::nullopt, ResultFormat::Binary, 23)));
+
+  // Binary values are in network byte order
+  const auto int4 = ByteBuffer{static_cast<char>(0xFF), static_cast<char>(0xFF), static_cast<char>(0xFF),
+                               static_cast<char>(0xF4)};
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(int4, ResultFormat::Binary, 23), AllTypeVariant{int32_t{-12}});
+
+  const auto int8 = ByteBuffer{0, 0, 0, 1, 0, 0, 0, 0};
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(int8, ResultFormat::Binary, 20), AllTypeVariant{int64_t{1} << 32});
+
+  // 1.5 as IEEE 754 double precision number
+  const auto float8 = ByteBuffer{0x3F, static_cast<char>(0xF8), 0, 0, 0, 0, 0, 0};
+  EXPECT_EQ(PostgresWireHandler::decode_parameter(float8, ResultFormat::Binary, 701), AllTypeVariant{1.5});
+
+  EXPECT_THROW(PostgresWireHandler::decode_parameter(int4, ResultFormat::Binary, 20), std::logic_error);
+  EXPECT_THROW(PostgresWireHandler::decode_parameter(int4, ResultFormat::Binary, 0), std::logic_error);
+}
+
 }  // namespace opossum
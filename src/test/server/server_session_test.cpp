@@ -6,6 +6,8 @@
 #include "base_test.hpp"
 #include "mock_connection.hpp"
 #include "mock_task_runner.hpp"
+#include "scheduler/cancellation_token.hpp"
+#include "server/cancellation_registry.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 
 namespace opossum {
@@ -41,12 +43,15 @@ class ServerSessionTest : public BaseTest {
     _configure_startup();
     _configure_termination();
     _configure_successful_sends();
+    _configure_data_row_serialization();
   }
 
   void _configure_startup() {
     ON_CALL(*_connection, receive_startup_packet_header())
-        .WillByDefault(Return(ByMove(boost::make_ready_future(uint32_t(32)))));
-    ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Return(ByMove(boost::make_ready_future())));
+        .WillByDefault(Return(ByMove(boost::make_ready_future(StartupPacketHeader{StartupRequestType::Startup, 32}))));
+    ON_CALL(*_connection, receive_startup_packet_body(_)).WillByDefault(Invoke([](uint32_t) {
+      return boost::make_ready_future(StartupParameters{});
+    }));
   }
 
   void _configure_termination() {
@@ -60,6 +65,9 @@ class ServerSessionTest : public BaseTest {
     // (i.e. don't throw an exception)
     ON_CALL(*_connection, send_ssl_denied()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
     ON_CALL(*_connection, send_auth()).WillByDefault(Invoke([]() { return boost::make_ready_future(); }));
+    ON_CALL(*_connection, send_backend_key_data(_)).WillByDefault(Invoke([](const BackendKey&) {
+      return boost::make_ready_future();
+    }));
     ON_CALL(*_connection, send_parameter_status(_, _)).WillByDefault(Invoke([](const std::string&, const std::string&) {
       return boost::make_ready_future();
     }));
@@ -76,7 +84,7 @@ class ServerSessionTest : public BaseTest {
     ON_CALL(*_connection, send_row_description(_)).WillByDefault(Invoke([](const std::vector<ColumnDescription>&) {
       return boost::make_ready_future();
     }));
-    ON_CALL(*_connection, send_data_row(_)).WillByDefault(Invoke([](const std::vector<std::string>&) {
+    ON_CALL(*_connection, send_data_rows(_)).WillByDefault(Invoke([](const ByteBuffer&) {
       return boost::make_ready_future();
     }));
     ON_CALL(*_connection, send_command_complete(_)).WillByDefault(Invoke([](const std::string&) {
@@ -84,6 +92,20 @@ class ServerSessionTest : public BaseTest {
     }));
   }
 
+  void _configure_data_row_serialization() {
+    // Fetch and serialize the query results right away instead of scheduling the tasks
+    ON_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<FetchServerResultChunksTask>>()))
+        .WillByDefault(Invoke([](const std::shared_ptr<FetchServerResultChunksTask>& task) {
+          task->execute();
+          return task->get_future();
+        }));
+    ON_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<SerializeServerDataRowsTask>>()))
+        .WillByDefault(Invoke([](const std::shared_ptr<SerializeServerDataRowsTask>& task) {
+          task->execute();
+          return task->get_future();
+        }));
+  }
+
   std::shared_ptr<SQLPipeline> _create_working_sql_pipeline() {
     // We don't mock the SQL Pipeline, so we have to provide a query that executes successfully
     auto t = load_table("resources/test_data/tbl/int.tbl", 10);
@@ -98,7 +120,7 @@ class ServerSessionTest : public BaseTest {
 
 TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Use this magic value to check if the session performs the correct calls
-  uint32_t startup_packet_header_length(42);
+  const auto startup_packet_header = StartupPacketHeader{StartupRequestType::Startup, 42};
 
   // This tells googlemock to check that the calls to the session are being made
   // in the same order that we specify below
@@ -107,14 +129,16 @@ TEST_F(ServerSessionTest, SessionPerformsStartup) {
   // Override the default mock implementation defined in _configure_startup by returning the magic value
   // as the header length.
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(startup_packet_header))));
 
   // Make sure receive_startup_packet_body is called with the magic value defined above
-  EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header_length));
+  EXPECT_CALL(*_connection, receive_startup_packet_body(startup_packet_header.payload_length));
 
-  // Expect that the session sends out an authentication response and an initial ReadyForQuery
+  // Expect that the session sends out an authentication response, its key for CancelRequests, and an initial
+  // ReadyForQuery
   EXPECT_CALL(*_connection, send_auth());
   EXPECT_CALL(*_connection, send_parameter_status(_, _)).Times(2);
+  EXPECT_CALL(*_connection, send_backend_key_data(_));
   EXPECT_CALL(*_connection, send_ready_for_query());
 
   // Actually run the session: googlemock will record which Connection methods are called in which order
@@ -130,19 +154,18 @@ TEST_F(ServerSessionTest, SessionHandlesConnectionErrorsDuringStartup) {
 
   auto exception = std::logic_error("Some connection problem");
   EXPECT_CALL(*_connection, receive_startup_packet_body(_))
-      .WillOnce(Return(ByMove(boost::make_exceptional_future<void>(boost::copy_exception(exception)))));
+      .WillOnce(Return(ByMove(boost::make_exceptional_future<StartupParameters>(boost::copy_exception(exception)))));
 
   EXPECT_NO_THROW(_session->start().wait());
 }
 
 TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
-  // 0 is what the connection reports as the header size when it receives an SSL request
-  uint32_t ssl_startup_packet_header_length(0);
+  const auto ssl_startup_packet_header = StartupPacketHeader{StartupRequestType::SslRequest, 0};
 
   InSequence s;
 
   EXPECT_CALL(*_connection, receive_startup_packet_header())
-      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header_length))));
+      .WillOnce(Return(ByMove(boost::make_ready_future(ssl_startup_packet_header))));
   EXPECT_CALL(*_connection, send_ssl_denied());
 
   EXPECT_CALL(*_connection, receive_startup_packet_header());
@@ -155,6 +178,60 @@ TEST_F(ServerSessionTest, SessionDeniesSslRequestDuringStartup) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionCancelsQueryOfOtherSession) {
+  // The session whose query is cancelled
+  const auto backend_key = CancellationRegistry::get().register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  CancellationRegistry::get().set_current_query(backend_key.process_id, cancellation_token);
+
+  InSequence s;
+
+  EXPECT_CALL(*_connection, receive_startup_packet_header())
+      .WillOnce(Return(ByMove(boost::make_ready_future(StartupPacketHeader{StartupRequestType::CancelRequest, 8}))));
+  EXPECT_CALL(*_connection, receive_cancel_request_body(8))
+      .WillOnce(Return(ByMove(boost::make_ready_future(backend_key))));
+
+  // The connection is closed right away
+  EXPECT_CALL(*_connection, send_auth()).Times(0);
+  EXPECT_CALL(*_connection, receive_packet_header()).Times(0);
+
+  _session->start().wait();
+
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  CancellationRegistry::get().unregister_session(backend_key.process_id);
+}
+
+TEST_F(ServerSessionTest, CancelRequestRequiresSecretKey) {
+  const auto backend_key = CancellationRegistry::get().register_session();
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  CancellationRegistry::get().set_current_query(backend_key.process_id, cancellation_token);
+
+  EXPECT_FALSE(CancellationRegistry::get().cancel_current_query({backend_key.process_id, backend_key.secret_key + 1}));
+  EXPECT_FALSE(cancellation_token->is_cancelled());
+
+  EXPECT_TRUE(CancellationRegistry::get().cancel_current_query(backend_key));
+  EXPECT_TRUE(cancellation_token->is_cancelled());
+  CancellationRegistry::get().unregister_session(backend_key.process_id);
+}
+
+TEST_F(ServerSessionTest, ParsesStatementTimeout) {
+  using namespace std::chrono_literals;  // NOLINT
+
+  EXPECT_EQ(statement_timeout_from({}), 0ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "100"}}), 100ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "100ms"}}), 100ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "5s"}}), 5'000ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "1.5 s"}}), 1'500ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "2min"}}), 120'000ms);
+  EXPECT_EQ(statement_timeout_from({{"statement_timeout", "1h"}}), 3'600'000ms);
+  EXPECT_EQ(statement_timeout_from({{"options", "-c statement_timeout=5s -c search_path=public"}}), 5'000ms);
+  EXPECT_EQ(statement_timeout_from({{"options", "-c search_path=public"}}), 0ms);
+
+  EXPECT_THROW(statement_timeout_from({{"statement_timeout", "5 seconds"}}), std::logic_error);
+  EXPECT_THROW(statement_timeout_from({{"options", "-c statement_timeout=5sec"}}), std::logic_error);
+  EXPECT_THROW(statement_timeout_from({{"statement_timeout", "-5"}}), std::logic_error);
+}
+
 TEST_F(ServerSessionTest, SessionShutsDownOnTerminationPacket) {
   InSequence s;
 
@@ -226,11 +303,18 @@ TEST_F(ServerSessionTest, SessionExecutesSimpleQueryCommand) {
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerQueryTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future())));
 
-  // It sends the result schema...
+  // The result is streamed. Once the first part is fetched, the session sends the result schema...
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<FetchServerResultChunksTask>>()));
   EXPECT_CALL(*_connection, send_row_description(_));
 
-  // ... as well as the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // ... as well as the row data, which is serialized by scheduled tasks (a single batch for the three rows, followed by
+  // an empty batch marking the end of the part)
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<SerializeServerDataRowsTask>>()));
+  EXPECT_CALL(*_connection, send_data_rows(_));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<SerializeServerDataRowsTask>>()));
+
+  // The table has a single chunk, so there is no further part
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<FetchServerResultChunksTask>>()));
 
   // Finally, the session completes the command...
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -296,8 +380,10 @@ TEST_F(ServerSessionTest, SessionHandlesExtendedProtocolFlow) {
   EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ExecuteServerPreparedStatementTask>>()))
       .WillOnce(Return(ByMove(boost::make_ready_future(sql_pipeline->get_result_table()))));
 
-  // It sends the row data (one message per row)
-  EXPECT_CALL(*_connection, send_data_row(_)).Times(3);
+  // It sends the row data (a single batch for the three rows, followed by an empty batch marking the end)
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<SerializeServerDataRowsTask>>()));
+  EXPECT_CALL(*_connection, send_data_rows(_));
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<SerializeServerDataRowsTask>>()));
 
   // ... and completes the command
   EXPECT_CALL(*_connection, send_command_complete(_));
@@ -378,6 +464,39 @@ TEST_F(ServerSessionTest, SessionSendsErrorWhenRedefiningNamedStatement) {
   _session->start().wait();
 }
 
+TEST_F(ServerSessionTest, SessionReusesStatementsOfRepeatedParseCommands) {
+  InSequence s;
+
+  EXPECT_CALL(*_connection, send_ready_for_query());
+
+  RequestHeader parse_request{NetworkMessageType::ParseCommand, 42};
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+
+  ParsePacket parse_packet = {"", "SELECT * FROM foo;"};
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  auto sql_pipeline = _create_working_sql_pipeline();
+  auto parse_server_prepared_plan_result =
+      std::make_unique<PreparedPlan>(sql_pipeline->get_optimized_logical_plans().front(), std::vector<ParameterID>{});
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>()))
+      .WillOnce(Return(ByMove(boost::make_ready_future(std::move(parse_server_prepared_plan_result)))));
+
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  // Parsing the same query again does not schedule another task
+  EXPECT_CALL(*_connection, receive_packet_header()).WillOnce(Return(ByMove(boost::make_ready_future(parse_request))));
+  EXPECT_CALL(*_connection, receive_parse_packet_body(42))
+      .WillOnce(Return(ByMove(boost::make_ready_future(parse_packet))));
+
+  EXPECT_CALL(*_task_runner, dispatch_server_task(An<std::shared_ptr<ParseServerPreparedStatementTask>>())).Times(0);
+  EXPECT_CALL(*_connection, send_status_message(NetworkMessageType::ParseComplete));
+
+  EXPECT_CALL(*_connection, receive_packet_header());
+
+  _session->start().wait();
+}
+
 TEST_F(ServerSessionTest, SessionSendsErrorWhenBindingUnknownNamedStatement) {
   InSequence s;
 
@@ -0,0 +1,47 @@
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/normalize_sql_literals.hpp"
+
+namespace opossum {
+
+class NormalizeSQLLiteralsTest : public BaseTest {};
+
+TEST_F(NormalizeSQLLiteralsTest, ReplacesLiterals) {
+  const auto normalized_sql =
+      normalize_sql_literals("SELECT * FROM t WHERE a = 5 AND b > 2.5 AND c = 'abc' AND d < 10000000000");
+
+  EXPECT_EQ(normalized_sql.sql, "SELECT * FROM t WHERE a = ? AND b > ? AND c = ? AND d < ?");
+  ASSERT_EQ(normalized_sql.literals.size(), 4u);
+  EXPECT_EQ(normalized_sql.literals[0], AllTypeVariant{int32_t{5}});
+  EXPECT_EQ(normalized_sql.literals[1], AllTypeVariant{2.5});
+  EXPECT_EQ(normalized_sql.literals[2], AllTypeVariant{std::string{"abc"}});
+  EXPECT_EQ(normalized_sql.literals[3], AllTypeVariant{int64_t{10'000'000'000}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, EscapedQuotes) {
+  const auto normalized_sql = normalize_sql_literals("SELECT * FROM t WHERE a = 'it''s'");
+
+  EXPECT_EQ(normalized_sql.sql, "SELECT * FROM t WHERE a = ?");
+  ASSERT_EQ(normalized_sql.literals.size(), 1u);
+  EXPECT_EQ(normalized_sql.literals[0], AllTypeVariant{std::string{"it's"}});
+}
+
+TEST_F(NormalizeSQLLiteralsTest, KeepsIdentifiersAndComments) {
+  const auto sql = std::string{
+      "SELECT t1.a2, \"col 3\" FROM t1 -- 42\n"
+      "WHERE b = -3 /* 'x' */"};
+  const auto normalized_sql = normalize_sql_literals(sql);
+
+  EXPECT_EQ(normalized_sql.sql, sql);
+  EXPECT_TRUE(normalized_sql.literals.empty());
+}
+
+TEST_F(NormalizeSQLLiteralsTest, EqualForDifferentLiterals) {
+  EXPECT_EQ(normalize_sql_literals("SELECT * FROM t WHERE a = 1").sql,
+            normalize_sql_literals("SELECT * FROM t WHERE a = 2").sql);
+  EXPECT_NE(normalize_sql_literals("SELECT * FROM t WHERE a = 1").sql,
+            normalize_sql_literals("SELECT * FROM t WHERE b = 1").sql);
+}
+
+}  // namespace opossum
@@ -16,6 +16,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/topology.hpp"
+#include "sql/physical_plan_leases.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_pipeline_statement.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -555,6 +556,43 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(cache.has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, ReuseCachedQueryPlan) {
+  {
+    auto first_statement = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+    first_statement.get_result_table();
+    EXPECT_TRUE(PhysicalPlanLeases::get().is_leased(first_statement.get_physical_plan()));
+  }
+
+  const auto cached_plan = SQLPhysicalPlanCache::get().get_entry(_select_query_a);
+  EXPECT_FALSE(PhysicalPlanLeases::get().is_leased(cached_plan));
+
+  // The plan is not executed by another statement, so it is not copied
+  auto second_statement = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  EXPECT_EQ(second_statement.get_physical_plan(), cached_plan);
+  EXPECT_TRUE(second_statement.metrics()->query_plan_cache_hit);
+  EXPECT_TABLE_EQ_UNORDERED(second_statement.get_result_table(), _table_a);
+
+  // The plan is leased by the second statement, so the third one executes a copy
+  auto third_statement = SQLPipelineBuilder{_select_query_a}.create_pipeline_statement();
+  EXPECT_NE(third_statement.get_physical_plan(), cached_plan);
+  EXPECT_TRUE(third_statement.metrics()->query_plan_cache_hit);
+  EXPECT_TABLE_EQ_UNORDERED(third_statement.get_result_table(), _table_a);
+}
+
+TEST_F(SQLPipelineStatementTest, CopyCachedQueryPlanWithState) {
+  // Aggregate keeps state from previous executions, and parameters are set on each execution
+  const auto queries = {"SELECT MAX(a) FROM table_int",
+                        "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)"};
+
+  for (const auto& query : queries) {
+    SQLPipelineBuilder{query}.create_pipeline_statement().get_result_table();
+
+    auto statement = SQLPipelineBuilder{query}.create_pipeline_statement();
+    EXPECT_NE(statement.get_physical_plan(), SQLPhysicalPlanCache::get().get_entry(query));
+    EXPECT_TRUE(statement.metrics()->query_plan_cache_hit);
+  }
+}
+
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   const auto subquery_query = "SELECT * FROM table_int WHERE a = (SELECT MAX(b) FROM table_int)";
 
@@ -579,4 +617,71 @@ TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
   EXPECT_TABLE_EQ_UNORDERED(second_subquery_result, expected_second_result);
 }
 
+TEST_F(SQLPipelineStatementTest, AutoParameterizationSharesPlans) {
+  auto first_statement = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 10"}
+                         .enable_auto_parameterization()
+                         .create_pipeline_statement();
+  const auto first_result = first_statement.get_result_table();
+  EXPECT_FALSE(first_statement.metrics()->query_plan_cache_hit);
+
+  auto expected_first_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_first_result->append({10, 10, 10});
+  EXPECT_TABLE_EQ_UNORDERED(first_result, expected_first_result);
+
+  // A statement with a different literal uses the plan of the first one
+  auto second_statement = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 11"}
+                          .enable_auto_parameterization()
+                          .create_pipeline_statement();
+  const auto second_result = second_statement.get_result_table();
+  EXPECT_TRUE(second_statement.metrics()->query_plan_cache_hit);
+
+  auto expected_second_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_second_result->append({11, 10, 11});
+  EXPECT_TABLE_EQ_UNORDERED(second_result, expected_second_result);
+
+  EXPECT_TRUE(SQLParameterizedPlanCache::get().has("SELECT * FROM table_int WHERE a = ?"));
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has("SELECT * FROM table_int WHERE a = 11"));
+}
+
+TEST_F(SQLPipelineStatementTest, AutoParameterizationReoptimizesOutsideOfOptimizedRange) {
+  StorageManager::get().add_table("table_equal", load_table("resources/test_data/tbl/int_equal_distribution.tbl", 20));
+
+  // The plan is optimized for a third of the rows (the estimation for `full < ?`), which `full < 2` matches
+  auto first_statement = SQLPipelineBuilder{"SELECT * FROM table_equal WHERE full < 2"}
+                             .enable_auto_parameterization()
+                             .create_pipeline_statement();
+  EXPECT_EQ(first_statement.get_result_table()->row_count(), 60u);
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has("SELECT * FROM table_equal WHERE full < 2"));
+
+  // No row is smaller than 0, so the statement is optimized on its own
+  auto second_statement = SQLPipelineBuilder{"SELECT * FROM table_equal WHERE full < 0"}
+                              .enable_auto_parameterization()
+                              .create_pipeline_statement();
+  EXPECT_EQ(second_statement.get_result_table()->row_count(), 0u);
+  EXPECT_FALSE(second_statement.metrics()->query_plan_cache_hit);
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has("SELECT * FROM table_equal WHERE full < 0"));
+
+  auto third_statement = SQLPipelineBuilder{"SELECT * FROM table_equal WHERE full < 3"}
+                             .enable_auto_parameterization()
+                             .create_pipeline_statement();
+  EXPECT_EQ(third_statement.get_result_table()->row_count(), 90u);
+  EXPECT_TRUE(third_statement.metrics()->query_plan_cache_hit);
+}
+
+TEST_F(SQLPipelineStatementTest, AutoParameterizationSkipsLiteralsOutsideOfPredicates) {
+  // The literal names the result column, so it cannot be replaced by a parameter
+  auto statement = SQLPipelineBuilder{"SELECT a + 1 FROM table_int WHERE b = 10"}
+                       .enable_auto_parameterization()
+                       .create_pipeline_statement();
+  const auto result = statement.get_result_table();
+
+  EXPECT_EQ(result->column_name(ColumnID{0}), "a + 1");
+  EXPECT_EQ(result->row_count(), 4u);
+
+  const auto cached_plan = SQLParameterizedPlanCache::get().try_get("SELECT a + ? FROM table_int WHERE b = ?");
+  ASSERT_TRUE(cached_plan);
+  EXPECT_EQ(*cached_plan, nullptr);
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has("SELECT a + 1 FROM table_int WHERE b = 10"));
+}
+
 }  // namespace opossum
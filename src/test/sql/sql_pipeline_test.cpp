@@ -11,6 +11,7 @@
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
+#include "scheduler/cancellation_token.hpp"
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
@@ -181,6 +182,37 @@ TEST_F(SQLPipelineTest, GetParsedSQLStatementsMultiple) {
   EXPECT_TRUE(parsed_sql_statements.back()->isValid());
 }
 
+TEST_F(SQLPipelineTest, ParseTreeCache) {
+  const auto multi_select_query = _select_query_a + "; SELECT * FROM table_b;";
+  auto first_pipeline = SQLPipelineBuilder{multi_select_query}.create_pipeline();
+  EXPECT_FALSE(first_pipeline.metrics().parse_tree_cache_hit);
+  EXPECT_TRUE(SQLParseTreeCache::get().has(multi_select_query));
+
+  // The second pipeline does not parse the SQL string again, but shares the parse results of the first one
+  auto second_pipeline = SQLPipelineBuilder{multi_select_query}.create_pipeline();
+  EXPECT_TRUE(second_pipeline.metrics().parse_tree_cache_hit);
+  EXPECT_EQ(second_pipeline.get_sql_strings(), first_pipeline.get_sql_strings());
+  EXPECT_EQ(second_pipeline.get_parsed_sql_statements(), first_pipeline.get_parsed_sql_statements());
+
+  EXPECT_TABLE_EQ_UNORDERED(second_pipeline.get_result_table(), _table_b);
+
+  // Invalid SQL strings are not cached
+  EXPECT_THROW(SQLPipelineBuilder{_invalid_sql}.create_pipeline(), InvalidInputException);
+  EXPECT_FALSE(SQLParseTreeCache::get().has(_invalid_sql));
+}
+
+TEST_F(SQLPipelineTest, ParseTreeCacheSkipsModifyingStatements) {
+  // Strings with statements other than SELECTs are parsed again on each execution
+  for (const auto& query : {_multi_statement_query, _multi_statement_dependent}) {
+    auto first_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    EXPECT_FALSE(first_pipeline.metrics().parse_tree_cache_hit);
+    EXPECT_FALSE(SQLParseTreeCache::get().has(query));
+
+    auto second_pipeline = SQLPipelineBuilder{query}.create_pipeline();
+    EXPECT_FALSE(second_pipeline.metrics().parse_tree_cache_hit);
+  }
+}
+
 TEST_F(SQLPipelineTest, GetUnoptimizedLQPs) {
   auto sql_pipeline = SQLPipelineBuilder{_select_query_a}.create_pipeline();
   const auto& lqps = sql_pipeline.get_unoptimized_logical_plans();
@@ -412,6 +444,46 @@ TEST_F(SQLPipelineTest, DisabledCleanupWithScheduler) {
   }
 }
 
+TEST_F(SQLPipelineTest, GetResultTablesConcurrently) {
+  const auto sql =
+      "SELECT * FROM table_b; INSERT INTO table_a VALUES (11, 11.11); SELECT * FROM table_a; SELECT * FROM table_b";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto& tables = sql_pipeline.get_result_tables();
+
+  // The results are in statement order and the SELECT on table_a sees the INSERT before it
+  ASSERT_EQ(tables.size(), 4u);
+  EXPECT_TABLE_EQ_UNORDERED(tables[0], _table_b);
+  EXPECT_EQ(tables[1], nullptr);
+  EXPECT_TABLE_EQ_UNORDERED(tables[2], _table_a_multi);
+  EXPECT_TABLE_EQ_UNORDERED(tables[3], _table_b);
+}
+
+TEST_F(SQLPipelineTest, GetResultTablesConcurrentlyBadQuery) {
+  const auto sql = "SELECT * FROM table_b; " + _fail_query + "; INSERT INTO table_a VALUES (11, 11.11);";
+  auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  EXPECT_THROW(sql_pipeline.get_result_tables(), std::exception);
+
+  // The INSERT after the failed statement was not executed
+  EXPECT_EQ(_table_a->row_count(), 3u);
+}
+
+TEST_F(SQLPipelineTest, GetResultTableCancelled) {
+  const auto cancellation_token = std::make_shared<CancellationToken>();
+  auto sql_pipeline = SQLPipelineBuilder{"INSERT INTO table_a VALUES (11, 11.11); SELECT * FROM table_a"}
+                          .with_cancellation_token(cancellation_token)
+                          .create_pipeline();
+
+  cancellation_token->cancel();
+  EXPECT_THROW(sql_pipeline.get_result_table(), QueryCancelledException);
+  EXPECT_EQ(_table_a->row_count(), 3u);
+}
+
 TEST_F(SQLPipelineTest, GetResultTableBadQuery) {
   auto sql = "SELECT a + not_a_column FROM table_a";
   auto sql_pipeline = SQLPipelineBuilder{sql}.create_pipeline();
@@ -431,6 +503,69 @@ TEST_F(SQLPipelineTest, GetResultTableNoOutput) {
   EXPECT_EQ(table2, nullptr);
 }
 
+TEST_F(SQLPipelineTest, GetResultStream) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a_multi WHERE a > 200"}.create_pipeline();
+  const auto result_stream = sql_pipeline.get_result_stream(1);
+
+  auto result_table = std::make_shared<Table>(_table_a_multi->column_definitions(), TableType::Data);
+  auto part_count = size_t{0};
+  while (const auto result_part = result_stream->next()) {
+    ++part_count;
+    for (auto row = size_t{0}; row < result_part->row_count(); ++row) {
+      result_table->append(
+          {result_part->get_value<int32_t>(ColumnID{0}, row), result_part->get_value<float>(ColumnID{1}, row)});
+    }
+  }
+
+  // Each of the two chunks of table_a_multi contains one of the qualifying rows and is returned on its own
+  EXPECT_EQ(part_count, 2u);
+
+  auto expected_table = std::make_shared<Table>(_table_a_multi->column_definitions(), TableType::Data);
+  expected_table->append({12345, 458.7f});
+  expected_table->append({1234, 457.7f});
+  EXPECT_TABLE_EQ_UNORDERED(result_table, expected_table);
+}
+
+TEST_F(SQLPipelineTest, GetResultStreamIgnoresAppendedChunks) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_a"}.create_pipeline();
+  const auto result_stream = sql_pipeline.get_result_stream(1);
+
+  auto row_count = result_stream->next()->row_count();
+
+  // The chunk is appended after the stream was created and is not part of the result
+  _table_a->append_mutable_chunk();
+  _table_a->append({1, 1.0f});
+
+  while (const auto result_part = result_stream->next()) {
+    row_count += result_part->row_count();
+  }
+  EXPECT_EQ(row_count, 3u);
+}
+
+TEST_F(SQLPipelineTest, GetResultStreamWithLimit) {
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT a FROM table_a_multi LIMIT 3"}.create_pipeline();
+
+  Topology::use_fake_numa_topology(8, 4);
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>());
+  const auto result_stream = sql_pipeline.get_result_stream(2);
+
+  auto row_count = size_t{0};
+  while (const auto result_part = result_stream->next()) {
+    EXPECT_EQ(result_part->column_count(), 1u);
+    row_count += result_part->row_count();
+  }
+  EXPECT_EQ(row_count, 3u);
+}
+
+TEST_F(SQLPipelineTest, GetResultStreamNotStreamable) {
+  auto sql_pipeline = SQLPipelineBuilder{_join_query}.create_pipeline();
+  const auto result_stream = sql_pipeline.get_result_stream();
+
+  // The result of the join is returned at once
+  EXPECT_TABLE_EQ_UNORDERED(result_stream->next(), _join_result);
+  EXPECT_EQ(result_stream->next(), nullptr);
+}
+
 TEST_F(SQLPipelineTest, GetTimes) {
   const auto& cache = SQLPhysicalPlanCache::get();
   EXPECT_EQ(cache.size(), 0u);
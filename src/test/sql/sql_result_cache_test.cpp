@@ -0,0 +1,115 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "sql/result_chunk_stream.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "sql/sql_pipeline_statement.hpp"
+#include "sql/sql_result_cache.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class SQLResultCacheTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_float2.tbl", 2));
+
+    SQLResultCache::get().resize(16);
+  }
+
+  // Executes @param sql and returns whether its result came from the SQLResultCache
+  static bool _execute(const std::string& sql, std::shared_ptr<const Table>* result_table = nullptr) {
+    auto statement = SQLPipelineBuilder{sql}.create_pipeline_statement();
+    const auto& table = statement.get_result_table();
+    if (result_table) *result_table = table;
+    return statement.metrics()->result_cache_hit;
+  }
+
+  const std::string _query_a = "SELECT * FROM table_a WHERE a > 1000";
+};
+
+TEST_F(SQLResultCacheTest, DisabledByDefault) {
+  SQLResultCache::get().resize(0);
+
+  EXPECT_FALSE(_execute(_query_a));
+  EXPECT_FALSE(_execute(_query_a));
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+}
+
+TEST_F(SQLResultCacheTest, CachesResultUntilTableIsModified) {
+  auto first_result = std::shared_ptr<const Table>{};
+  auto second_result = std::shared_ptr<const Table>{};
+  EXPECT_FALSE(_execute(_query_a, &first_result));
+  EXPECT_TRUE(_execute(_query_a, &second_result));
+  EXPECT_EQ(first_result, second_result);
+
+  // Modifying another table does not invalidate the result
+  _execute("INSERT INTO table_b VALUES (1, 1.0)");
+  EXPECT_TRUE(_execute(_query_a));
+
+  _execute("INSERT INTO table_a VALUES (5000, 1.0)");
+  auto third_result = std::shared_ptr<const Table>{};
+  EXPECT_FALSE(_execute(_query_a, &third_result));
+  EXPECT_EQ(third_result->row_count(), first_result->row_count() + 1);
+  EXPECT_TRUE(_execute(_query_a));
+
+  _execute("DELETE FROM table_a WHERE a = 5000");
+  EXPECT_FALSE(_execute(_query_a));
+}
+
+TEST_F(SQLResultCacheTest, RolledBackModificationsDoNotInvalidate) {
+  EXPECT_FALSE(_execute(_query_a));
+
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto statement = SQLPipelineBuilder{"INSERT INTO table_a VALUES (5000, 1.0)"}
+                       .with_transaction_context(transaction_context)
+                       .create_pipeline_statement();
+  statement.get_result_table();
+  transaction_context->rollback();
+
+  EXPECT_TRUE(_execute(_query_a));
+}
+
+TEST_F(SQLResultCacheTest, ModifiedSubqueryTableInvalidates) {
+  const auto query = "SELECT * FROM table_a WHERE a IN (SELECT a FROM table_b)";
+  EXPECT_FALSE(_execute(query));
+  EXPECT_TRUE(_execute(query));
+
+  _execute("INSERT INTO table_b VALUES (123, 1.0)");
+  EXPECT_FALSE(_execute(query));
+}
+
+TEST_F(SQLResultCacheTest, ReplacedTableInvalidates) {
+  EXPECT_FALSE(_execute(_query_a));
+
+  StorageManager::get().drop_table("table_a");
+  StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+  EXPECT_FALSE(_execute(_query_a));
+}
+
+TEST_F(SQLResultCacheTest, StatementsInTransactionsAreNotCached) {
+  auto transaction_context = TransactionManager::get().new_transaction_context();
+  auto statement =
+      SQLPipelineBuilder{_query_a}.with_transaction_context(transaction_context).create_pipeline_statement();
+  statement.get_result_table();
+  transaction_context->commit();
+
+  EXPECT_EQ(SQLResultCache::get().size(), 0u);
+}
+
+TEST_F(SQLResultCacheTest, StreamUsesCachedResult) {
+  auto first_result = std::shared_ptr<const Table>{};
+  EXPECT_FALSE(_execute(_query_a, &first_result));
+
+  auto statement = SQLPipelineBuilder{_query_a}.create_pipeline_statement();
+  const auto& result_stream = statement.get_result_stream(ResultChunkStream::DEFAULT_MAX_IN_FLIGHT_CHUNKS);
+  EXPECT_TRUE(statement.metrics()->result_cache_hit);
+  EXPECT_EQ(result_stream->next(), first_result);
+  EXPECT_EQ(result_stream->next(), nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#include "base_test.hpp"
+
+#include "logical_query_plan/lqp_translator.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "scheduler/operator_task.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "statistics/cardinality_feedback.hpp"
+#include "statistics/table_statistics.hpp"
+
+namespace opossum {
+
+class CardinalityFeedbackTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("table_a", load_table("resources/test_data/tbl/int_float.tbl", 2));
+    CardinalityFeedback::get().set_enabled(true);
+  }
+
+  // Builds a new LQP each time, so that equal plans do not share any nodes
+  static std::shared_ptr<AbstractLQPNode> make_lqp(const int32_t value) {
+    const auto stored_table_node = StoredTableNode::make("table_a");
+    return PredicateNode::make(greater_than_(stored_table_node->get_column("a"), value), stored_table_node);
+  }
+};
+
+TEST_F(CardinalityFeedbackTest, LQPHash) {
+  EXPECT_EQ(*make_lqp(1000), *make_lqp(1000));
+  EXPECT_EQ(make_lqp(1000)->hash(), make_lqp(1000)->hash());
+
+  EXPECT_NE(*make_lqp(1000), *make_lqp(2000));
+  EXPECT_NE(make_lqp(1000)->hash(), make_lqp(2000)->hash());
+}
+
+TEST_F(CardinalityFeedbackTest, RecordAndApply) {
+  const auto lqp = make_lqp(1000);
+  const auto estimated_row_count = lqp->get_statistics()->row_count();
+
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+  CurrentScheduler::schedule_and_wait_for_tasks(OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes));
+
+  const auto max_q_error = CardinalityFeedback::get().record(pqp);
+  EXPECT_FLOAT_EQ(max_q_error, std::max(estimated_row_count / 2.0f, 2.0f / estimated_row_count));
+  EXPECT_EQ(CardinalityFeedback::get().size(), 1u);
+
+  // An independently built, but equal, LQP uses the recorded row count
+  const auto entry = CardinalityFeedback::get().lookup(make_lqp(1000));
+  ASSERT_TRUE(entry);
+  EXPECT_EQ(entry->row_count, 2.0f);
+  EXPECT_GT(entry->walltime.count(), 0);
+  EXPECT_FLOAT_EQ(make_lqp(1000)->get_statistics()->row_count(), 2.0f);
+
+  EXPECT_FALSE(CardinalityFeedback::get().lookup(make_lqp(2000)));
+
+  // Disabling the feedback makes the optimizer fall back to the estimations
+  CardinalityFeedback::get().set_enabled(false);
+  EXPECT_FLOAT_EQ(make_lqp(1000)->get_statistics()->row_count(), estimated_row_count);
+}
+
+TEST_F(CardinalityFeedbackTest, MisestimatedPlansAreEvicted) {
+  const auto query = std::string{"SELECT * FROM table_a WHERE a > 1000"};
+  CardinalityFeedback::get().set_q_error_threshold(1.0f);
+
+  // The first execution is based on estimations, which are off. Thus, its plans are evicted.
+  SQLPipelineBuilder{query}.disable_mvcc().create_pipeline().get_result_table();
+  EXPECT_FALSE(SQLPhysicalPlanCache::get().has(query));
+  EXPECT_FALSE(SQLLogicalPlanCache::get().has(query));
+
+  // The second execution is based on the actual cardinalities, so its plans are kept
+  SQLPipelineBuilder{query}.disable_mvcc().create_pipeline().get_result_table();
+  EXPECT_TRUE(SQLPhysicalPlanCache::get().has(query));
+  EXPECT_TRUE(SQLLogicalPlanCache::get().has(query));
+}
+
+}  // namespace opossum
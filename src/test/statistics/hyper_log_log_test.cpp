@@ -0,0 +1,72 @@
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "statistics/hyper_log_log.hpp"
+
+namespace opossum {
+
+class HyperLogLogTest : public ::testing::Test {};
+
+TEST_F(HyperLogLogTest, ExactForFewValues) {
+  auto hyper_log_log = HyperLogLog{};
+  EXPECT_EQ(hyper_log_log.distinct_count(), 0.0f);
+
+  for (auto repetition = 0; repetition < 2; ++repetition) {
+    for (auto value = 0; value < 1'000; ++value) {
+      hyper_log_log.add(value);
+    }
+  }
+
+  EXPECT_EQ(hyper_log_log.distinct_count(), 1'000.0f);
+}
+
+TEST_F(HyperLogLogTest, EstimatesManyValues) {
+  auto int_hyper_log_log = HyperLogLog{};
+  auto string_hyper_log_log = HyperLogLog{};
+
+  for (auto value = 0; value < 100'000; ++value) {
+    int_hyper_log_log.add(value);
+    string_hyper_log_log.add(std::string{"value"} + std::to_string(value));
+  }
+
+  EXPECT_NEAR(int_hyper_log_log.distinct_count(), 100'000.0f, 5'000.0f);
+  EXPECT_NEAR(string_hyper_log_log.distinct_count(), 100'000.0f, 5'000.0f);
+}
+
+TEST_F(HyperLogLogTest, Merge) {
+  auto hyper_log_log_a = HyperLogLog{};
+  auto hyper_log_log_b = HyperLogLog{};
+  auto hyper_log_log_c = HyperLogLog{};
+
+  for (auto value = 0; value < 60'000; ++value) {
+    hyper_log_log_a.add(value);
+  }
+  for (auto value = 40'000; value < 100'000; ++value) {
+    hyper_log_log_b.add(value);
+  }
+  for (auto value = 100'000; value < 100'500; ++value) {
+    hyper_log_log_c.add(value);
+  }
+
+  // Merging the exact representation of c into the registers of a and b
+  hyper_log_log_a.merge(hyper_log_log_b);
+  hyper_log_log_a.merge(hyper_log_log_c);
+  EXPECT_NEAR(hyper_log_log_a.distinct_count(), 100'500.0f, 5'000.0f);
+
+  // Merging registers into the exact representation
+  hyper_log_log_c.merge(hyper_log_log_b);
+  EXPECT_NEAR(hyper_log_log_c.distinct_count(), 60'500.0f, 3'000.0f);
+
+  // Merging two exact representations stays exact
+  auto hyper_log_log_d = HyperLogLog{};
+  auto hyper_log_log_e = HyperLogLog{};
+  for (auto value = 0; value < 100; ++value) {
+    hyper_log_log_d.add(value);
+    hyper_log_log_e.add(value + 50);
+  }
+  hyper_log_log_d.merge(hyper_log_log_e);
+  EXPECT_EQ(hyper_log_log_d.distinct_count(), 150.0f);
+}
+
+}  // namespace opossum
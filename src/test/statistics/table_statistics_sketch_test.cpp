@@ -0,0 +1,101 @@
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "statistics/column_statistics.hpp"
+#include "statistics/column_statistics_sketch.hpp"
+#include "statistics/generate_table_statistics.hpp"
+#include "statistics/table_statistics.hpp"
+#include "statistics/table_statistics_sketch.hpp"
+#include "statistics_test_utils.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class TableStatisticsSketchTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int}}, TableType::Data, 10, UseMvcc::Yes);
+    for (auto value = 0; value < 25; ++value) {
+      _append_committed_row(value);
+    }
+  }
+
+  // Table::append() does not commit the row, so it is committed right away, like load_table() does
+  void _append_committed_row(const int32_t value) {
+    _table->append({value});
+    const auto last_chunk = _table->get_chunk(static_cast<ChunkID>(_table->chunk_count() - 1));
+    last_chunk->get_scoped_mvcc_data_lock()->begin_cids.back() = 0;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableStatisticsSketchTest, MergesImmutableChunks) {
+  auto sketch = TableStatisticsSketch{*_table};
+
+  // All chunks are mutable, so they are sketched on every update
+  auto table_statistics = sketch.update(*_table);
+  EXPECT_EQ(sketch.merged_chunk_count(), ChunkID{0});
+  EXPECT_EQ(table_statistics->row_count(), 25.0f);
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(0), 0.0f, 25, 0, 24);
+
+  _table->get_chunk(ChunkID{0})->mark_immutable();
+  _table->get_chunk(ChunkID{1})->mark_immutable();
+  table_statistics = sketch.update(*_table);
+  EXPECT_EQ(sketch.merged_chunk_count(), ChunkID{2});
+  EXPECT_EQ(table_statistics->row_count(), 25.0f);
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(0), 0.0f, 25, 0, 24);
+
+  // New rows are covered, but the merged chunks are not sketched again
+  for (auto value = 20; value < 35; ++value) {
+    _append_committed_row(value);
+  }
+  table_statistics = sketch.update(*_table);
+  EXPECT_EQ(sketch.merged_chunk_count(), ChunkID{2});
+  EXPECT_EQ(table_statistics->row_count(), 40.0f);
+  EXPECT_INT32_COLUMN_STATISTICS(table_statistics->column_statistics().at(0), 0.0f, 35, 0, 34);
+}
+
+TEST_F(TableStatisticsSketchTest, UpdateKeepsInvalidRowCount) {
+  update_table_statistics(*_table);
+  ASSERT_TRUE(_table->table_statistics_sketch());
+  _table->table_statistics()->increase_invalid_row_count(5);
+
+  _append_committed_row(100);
+  update_table_statistics(*_table);
+  EXPECT_EQ(_table->table_statistics()->row_count(), 26.0f);
+  EXPECT_EQ(_table->table_statistics()->approx_valid_row_count(), 21u);
+}
+
+TEST_F(TableStatisticsSketchTest, SamplesDictionarySegments) {
+  // Every tenth value is NULL, the others repeat the values from 1 to 999
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, true}}, TableType::Data,
+                                             100'000, UseMvcc::Yes);
+  for (auto row_id = 0; row_id < 100'000; ++row_id) {
+    table->append({row_id % 10 == 0 ? NULL_VALUE : AllTypeVariant{row_id % 1'000}});
+  }
+  ChunkEncoder::encode_all_chunks(table);
+
+  auto sketch = ColumnStatisticsSketch<int32_t>{};
+  sketch.add_segment(*table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}), 0);
+
+  // Ten blocks of 1'000 rows are sampled, of which 900 rows each are not NULL
+  EXPECT_DOUBLE_EQ(sketch.sample_rate(), 0.1);
+  auto sampled_row_count = HistogramCountType{0};
+  for (const auto& [value, count] : sketch.sampled_value_counts()) {
+    EXPECT_EQ(count, 10u);
+    sampled_row_count += count;
+  }
+  EXPECT_EQ(sampled_row_count, 9'000u);
+
+  // The distinct count and min/max are taken from the dictionary, the null value ratio from the sample
+  EXPECT_INT32_COLUMN_STATISTICS(sketch.to_column_statistics(), 0.1f, 900, 1, 999);
+  const auto column_statistics =
+      std::static_pointer_cast<const ColumnStatistics<int32_t>>(sketch.to_column_statistics());
+  ASSERT_TRUE(column_statistics->histogram());
+  EXPECT_EQ(column_statistics->histogram()->total_count(), 9'000u);
+}
+
+}  // namespace opossum
@@ -11,6 +11,8 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "statistics/base_column_statistics.hpp"
+#include "statistics/chunk_statistics/histograms/abstract_histogram.hpp"
+#include "statistics/column_statistics.hpp"
 #include "statistics/generate_table_statistics.hpp"
 #include "statistics/table_statistics.hpp"
 
@@ -279,4 +281,38 @@ TEST_F(TableStatisticsTest, TwoColumnScan) {
             post_predicate_statistics->column_statistics()[1]->distinct_count());
 }
 
+TEST_F(TableStatisticsTest, HistogramBasedEstimations) {
+  // Column a is skewed: Half of the rows have the value 1, the other half has the values 2 to 1001.
+  // Column b has 1500 values starting with "a" and 500 values starting with "b".
+  const auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::String}}, TableType::Data);
+  for (auto row_id = 0; row_id < 2000; ++row_id) {
+    const auto b = std::string{row_id < 1500 ? "a" : "b"} + std::to_string(10'000 + row_id);
+    table->append({row_id < 1000 ? 1 : row_id - 998, b});
+  }
+
+  const auto table_statistics = generate_table_statistics(*table);
+  const auto& column_statistics_a =
+      std::static_pointer_cast<const ColumnStatistics<int32_t>>(table_statistics.column_statistics()[0]);
+  ASSERT_TRUE(column_statistics_a->histogram());
+  EXPECT_EQ(column_statistics_a->histogram()->total_count(), 2000u);
+
+  // Without the histogram, we would assume a uniform distribution and estimate ~1000 rows
+  EXPECT_NEAR(table_statistics.estimate_predicate(ColumnID{0}, PredicateCondition::GreaterThan, 501).row_count(),
+              500.0f, 20.0f);
+  EXPECT_NEAR(table_statistics.estimate_predicate(ColumnID{0}, PredicateCondition::Between, 302, 801).row_count(),
+              500.0f, 20.0f);
+
+  // Without the histogram, we would use a magic number (i.e., 200 rows)
+  EXPECT_NEAR(table_statistics.estimate_predicate(ColumnID{1}, PredicateCondition::Like, "b%").row_count(), 500.0f,
+              50.0f);
+
+  // Without the histogram, we would estimate ~4000 rows. The correct result is 1'001'000 rows.
+  const auto join_statistics = table_statistics.estimate_predicated_join(table_statistics, JoinMode::Inner,
+                                                                         {ColumnID{0}, ColumnID{0}},
+                                                                         PredicateCondition::Equals);
+  EXPECT_GT(join_statistics.row_count(), 40'000.0f);
+  EXPECT_LE(join_statistics.row_count(), 1'001'000.0f);
+}
+
 }  // namespace opossum
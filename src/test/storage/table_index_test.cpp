@@ -0,0 +1,314 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "concurrency/transaction_manager.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "operators/insert.hpp"
+#include "operators/join_adaptive.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/update.hpp"
+#include "operators/validate.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/table_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class TableIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    TableColumnDefinitions column_definitions;
+    column_definitions.emplace_back("a", DataType::Int, true);
+    column_definitions.emplace_back("b", DataType::String);
+
+    // Three chunks: [5, 3, NULL], [8, 3, 1], [9]
+    _table = std::make_shared<Table>(column_definitions, TableType::Data, 3);
+    _table->append({5, "five"});
+    _table->append({3, "three"});
+    _table->append({NullValue{}, "null"});
+    _table->append({8, "eight"});
+    _table->append({3, "three"});
+    _table->append({1, "one"});
+    _table->append({9, "nine"});
+
+    _table->create_table_index(ColumnID{0});
+  }
+
+  // The matches ordered by their RowIDs, so that they can be compared independently of the order of equal values
+  PosList _lookup(const PredicateCondition predicate_condition, const AllTypeVariant& value,
+                  const AllTypeVariant& value2 = NullValue{}) const {
+    auto matches = PosList{};
+    _table->get_table_index(ColumnID{0})->append_matches(predicate_condition, value, matches, value2);
+    std::sort(matches.begin(), matches.end());
+    return matches;
+  }
+
+  // Table::append() does not commit the rows, so they are committed like load_table() does
+  static void _commit_appended_rows(const Table& table) {
+    for (auto chunk_id = ChunkID{0}; chunk_id < table.chunk_count(); ++chunk_id) {
+      auto mvcc_data = table.get_chunk(chunk_id)->get_scoped_mvcc_data_lock();
+      std::fill(mvcc_data->begin_cids.begin(), mvcc_data->begin_cids.end(), CommitID{0});
+    }
+  }
+
+  // The JoinAdaptive of the (single) join in @param physical_plan
+  static std::shared_ptr<const JoinAdaptive> _find_join_adaptive(
+      const std::shared_ptr<const AbstractOperator>& physical_plan) {
+    auto join_adaptive = std::shared_ptr<const JoinAdaptive>{};
+    const auto find_join_adaptive = [&](const auto& self, const std::shared_ptr<const AbstractOperator>& op) -> void {
+      if (!op) return;
+      if (const auto join = std::dynamic_pointer_cast<const JoinAdaptive>(op)) join_adaptive = join;
+      self(self, op->input_left());
+      self(self, op->input_right());
+    };
+    find_join_adaptive(find_join_adaptive, physical_plan);
+    return join_adaptive;
+  }
+
+  // table_right has no index on any chunk, so JoinIndex is only chosen because of the TableIndex
+  static void _add_join_tables() {
+    const auto table_right = std::make_shared<Table>(
+        TableColumnDefinitions{{"a", DataType::Int}, {"b", DataType::Int}}, TableType::Data, 100, UseMvcc::Yes);
+    for (auto value = 0; value < 1'000; ++value) {
+      table_right->append({value, value * 2});
+    }
+    _commit_appended_rows(*table_right);
+    table_right->create_table_index(ColumnID{0});
+    StorageManager::get().add_table("table_right", table_right);
+
+    const auto table_left =
+        std::make_shared<Table>(TableColumnDefinitions{{"x", DataType::Int}}, TableType::Data, 100, UseMvcc::Yes);
+    table_left->append({42});
+    table_left->append({500});
+    _commit_appended_rows(*table_left);
+    StorageManager::get().add_table("table_left", table_left);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(TableIndexTest, CreateAndGet) {
+  const auto table_index = _table->get_table_index(ColumnID{0});
+  ASSERT_NE(table_index, nullptr);
+  EXPECT_EQ(table_index->column_id(), ColumnID{0});
+  EXPECT_EQ(table_index->data_type(), DataType::Int);
+  EXPECT_EQ(table_index->row_count(), 6u);
+
+  EXPECT_EQ(_table->get_table_index(ColumnID{1}), nullptr);
+  EXPECT_THROW(_table->create_table_index(ColumnID{0}), std::logic_error);
+}
+
+TEST_F(TableIndexTest, Lookups) {
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3), (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 4), PosList{});
+  EXPECT_EQ(_lookup(PredicateCondition::NotEquals, 3),
+            (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}, RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(_lookup(PredicateCondition::LessThan, 3), (PosList{RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(_lookup(PredicateCondition::LessThanEquals, 3),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}, RowID{ChunkID{1}, 2}}));
+  EXPECT_EQ(_lookup(PredicateCondition::GreaterThan, 8), (PosList{RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(_lookup(PredicateCondition::GreaterThanEquals, 8), (PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 0}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Between, 3, 5),
+            (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+  EXPECT_EQ(_lookup(PredicateCondition::Between, 5, 3), PosList{});
+}
+
+TEST_F(TableIndexTest, MatchesAreOrderedByValue) {
+  auto matches = PosList{};
+  _table->get_table_index(ColumnID{0})->append_matches(PredicateCondition::GreaterThan, 3, matches);
+  EXPECT_EQ(matches, (PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}, RowID{ChunkID{2}, 0}}));
+}
+
+TEST_F(TableIndexTest, NullsNeverMatch) {
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, NullValue{}), PosList{});
+  EXPECT_EQ(_lookup(PredicateCondition::NotEquals, NullValue{}), PosList{});
+  EXPECT_EQ(_lookup(PredicateCondition::Between, 1, NullValue{}), PosList{});
+}
+
+TEST_F(TableIndexTest, IsApplicable) {
+  const auto table_index = _table->get_table_index(ColumnID{0});
+  EXPECT_TRUE(table_index->is_applicable(PredicateCondition::Equals, 3));
+  EXPECT_TRUE(table_index->is_applicable(PredicateCondition::Between, 3, 5));
+  EXPECT_FALSE(table_index->is_applicable(PredicateCondition::LessThan, 3.5f));
+  EXPECT_FALSE(table_index->is_applicable(PredicateCondition::Between, 3, int64_t{5}));
+  EXPECT_FALSE(table_index->is_applicable(PredicateCondition::IsNull, NullValue{}));
+  EXPECT_FALSE(table_index->is_applicable(PredicateCondition::Like, std::string{"3%"}));
+}
+
+TEST_F(TableIndexTest, AppendedRowsAreIndexed) {
+  _table->append({3, "three"});
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 1}}));
+
+  _table->append_chunk({std::make_shared<ValueSegment<int32_t>>(std::vector<int32_t>{7, 3}),
+                        std::make_shared<ValueSegment<std::string>>(std::vector<std::string>{"seven", "three"})});
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3),
+            (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}, RowID{ChunkID{2}, 1}, RowID{ChunkID{3}, 1}}));
+  EXPECT_EQ(_table->get_table_index(ColumnID{0})->row_count(), 9u);
+}
+
+TEST_F(TableIndexTest, EncodingRequiresNoMaintenance) {
+  ChunkEncoder::encode_all_chunks(_table);
+  EXPECT_EQ(_lookup(PredicateCondition::Equals, 3), (PosList{RowID{ChunkID{0}, 1}, RowID{ChunkID{1}, 1}}));
+}
+
+TEST_F(TableIndexTest, InsertedRowsAreIndexed) {
+  const auto table = load_table("resources/test_data/tbl/int_int_shuffled.tbl", 4);
+  table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("table_a", table);
+  StorageManager::get().add_table("table_b", load_table("resources/test_data/tbl/int_int3.tbl", 2));
+
+  const auto row_count = table->get_table_index(ColumnID{0})->row_count();
+
+  auto get_table = std::make_shared<GetTable>("table_b");
+  get_table->execute();
+
+  auto insert = std::make_shared<Insert>("table_a", get_table);
+  const auto context = TransactionManager::get().new_transaction_context();
+  insert->set_transaction_context(context);
+  insert->execute();
+  context->commit();
+
+  EXPECT_EQ(table->get_table_index(ColumnID{0})->row_count(), row_count + get_table->get_output()->row_count());
+}
+
+TEST_F(TableIndexTest, UpdatedRowsAreIndexed) {
+  const auto table = load_table("resources/test_data/tbl/int_float2.tbl", 2);
+  table->create_table_index(ColumnID{0});
+  StorageManager::get().add_table("table_a", table);
+
+  // UPDATE table_a SET a = 7 WHERE a = 123
+  const auto column_a = pqp_column_(ColumnID{0}, DataType::Int, false, "a");
+  const auto column_b = pqp_column_(ColumnID{1}, DataType::Float, false, "b");
+  auto get_table = std::make_shared<GetTable>("table_a");
+  get_table->execute();
+  auto where_scan = create_table_scan(get_table, ColumnID{0}, PredicateCondition::Equals, 123);
+  where_scan->execute();
+  auto updated_values = std::make_shared<Projection>(where_scan, expression_vector(7, column_b));
+  updated_values->execute();
+
+  auto update = std::make_shared<Update>("table_a", where_scan, updated_values);
+  const auto update_context = TransactionManager::get().new_transaction_context();
+  update->set_transaction_context(update_context);
+  update->execute();
+  update_context->commit();
+
+  // The Update invalidates the old row and inserts the new one, which the TableIndex points to
+  const auto validated_index_scan = [&](const int32_t value) {
+    auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::GroupKey,
+                                                  std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::Equals,
+                                                  std::vector<AllTypeVariant>{value});
+    index_scan->execute();
+    auto validate = std::make_shared<Validate>(index_scan);
+    validate->set_transaction_context(TransactionManager::get().new_transaction_context());
+    validate->execute();
+    return validate->get_output();
+  };
+
+  const auto new_value_rows = validated_index_scan(7);
+  ASSERT_EQ(new_value_rows->row_count(), 1u);
+  EXPECT_EQ(new_value_rows->get_value<int32_t>(ColumnID{0}, 0u), 7);
+  EXPECT_FLOAT_EQ(new_value_rows->get_value<float>(ColumnID{1}, 0u), 458.7f);
+  EXPECT_EQ(validated_index_scan(123)->row_count(), 0u);
+}
+
+TEST_F(TableIndexTest, IndexScanUsesTableIndex) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  // None of the chunks has an index, so the IndexScan can only succeed by using the TableIndex
+  auto index_scan = std::make_shared<IndexScan>(table_wrapper, SegmentIndexType::GroupKey,
+                                                std::vector<ColumnID>{ColumnID{0}}, PredicateCondition::GreaterThan,
+                                                std::vector<AllTypeVariant>{3});
+  index_scan->execute();
+
+  auto table_scan = create_table_scan(table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 3);
+  table_scan->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(index_scan->get_output(), table_scan->get_output());
+}
+
+TEST_F(TableIndexTest, JoinIndexUsesTableIndex) {
+  auto left = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float2.tbl", 2));
+  left->execute();
+
+  auto right_table = load_table("resources/test_data/tbl/int_float.tbl", 1);
+  right_table->create_table_index(ColumnID{0});
+  auto right = std::make_shared<TableWrapper>(right_table);
+  right->execute();
+
+  for (const auto predicate_condition : {PredicateCondition::Equals, PredicateCondition::LessThan}) {
+    for (const auto mode : {JoinMode::Inner, JoinMode::Outer}) {
+      auto join_index = std::make_shared<JoinIndex>(left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}),
+                                                    predicate_condition);
+      join_index->execute();
+
+      auto join_nested_loop = std::make_shared<JoinNestedLoop>(
+          left, right, mode, ColumnIDPair(ColumnID{0}, ColumnID{0}), predicate_condition);
+      join_nested_loop->execute();
+
+      EXPECT_TABLE_EQ_UNORDERED(join_index->get_output(), join_nested_loop->get_output());
+
+      const auto& performance_data = static_cast<const JoinIndex::PerformanceData&>(join_index->performance_data());
+      EXPECT_EQ(performance_data.chunks_scanned_with_index, static_cast<size_t>(right_table->chunk_count()));
+      EXPECT_EQ(performance_data.chunks_scanned_without_index, 0u);
+    }
+  }
+}
+
+TEST_F(TableIndexTest, SQLPipelineJoinUsesTableIndex) {
+  _add_join_tables();
+
+  auto sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_left JOIN table_right ON x = a"}.disable_mvcc().create_pipeline();
+  const auto result_table = sql_pipeline.get_result_table();
+  ASSERT_EQ(result_table->row_count(), 2u);
+
+  const auto join_adaptive = _find_join_adaptive(sql_pipeline.get_physical_plans().at(0));
+  ASSERT_TRUE(join_adaptive);
+  const auto& performance_data = static_cast<const JoinAdaptive::PerformanceData&>(join_adaptive->performance_data());
+  EXPECT_EQ(performance_data.join_implementation, OperatorType::JoinIndex);
+}
+
+TEST_F(TableIndexTest, SQLPipelineJoinUsesTableIndexWithMvcc) {
+  _add_join_tables();
+
+  // The TableIndex still holds the deleted row and the row of the uncommitted Insert. JoinIndex must not return them.
+  SQLPipelineBuilder{"DELETE FROM table_right WHERE a = 500"}.create_pipeline().get_result_table();
+  const auto insert_context = TransactionManager::get().new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO table_right VALUES (42, -1)"}
+      .with_transaction_context(insert_context)
+      .create_pipeline()
+      .get_result_table();
+
+  auto sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_left JOIN table_right ON x = a"}.create_pipeline();
+  const auto result_table = sql_pipeline.get_result_table();
+  ASSERT_EQ(result_table->row_count(), 1u);
+  EXPECT_EQ(result_table->get_value<int32_t>(ColumnID{2}, 0u), 84);
+
+  const auto join_adaptive = _find_join_adaptive(sql_pipeline.get_physical_plans().at(0));
+  ASSERT_TRUE(join_adaptive);
+  ASSERT_EQ(join_adaptive->input_right()->type(), OperatorType::Validate);
+  const auto& performance_data = static_cast<const JoinAdaptive::PerformanceData&>(join_adaptive->performance_data());
+  EXPECT_EQ(performance_data.join_implementation, OperatorType::JoinIndex);
+
+  insert_context->rollback();
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#include "base_test.hpp"
+
+#include "concurrency/transaction_manager.hpp"
+#include "operators/abstract_operator.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/operator_task.hpp"
+#include "server/server_prepared_statement.hpp"
+#include "sql/parameterized_plan.hpp"
+#include "storage/prepared_plan.hpp"
+#include "tasks/server/bind_server_prepared_statement_task.hpp"
+#include "tasks/server/parse_server_prepared_statement_task.hpp"
+#include "utils/load_table.hpp"
+
+namespace opossum {
+
+class BindServerPreparedStatementTaskTest : public BaseTest {
+ public:
+  void SetUp() override {
+    StorageManager::get().add_table("int_float", load_table("resources/test_data/tbl/int_float.tbl"));
+
+    auto parse_task = std::make_shared<ParseServerPreparedStatementTask>("SELECT * FROM int_float WHERE a > ?");
+    auto parse_future = parse_task->get_future();
+    parse_task->execute();
+
+    prepared_statement = std::make_shared<ServerPreparedStatement>(parse_future.get(), std::vector<uint32_t>{});
+  }
+
+  std::shared_ptr<const Table> bind_and_execute(const AllTypeVariant& param) {
+    auto bind_task = std::make_shared<BindServerPreparedStatementTask>(prepared_statement,
+                                                                       std::vector<AllTypeVariant>{param});
+    auto bind_future = bind_task->get_future();
+    bind_task->execute();
+    const auto pqp = bind_future.get();
+
+    pqp->set_transaction_context_recursively(TransactionManager::get().new_transaction_context());
+    const auto tasks = OperatorTask::make_tasks_from_operator(pqp, CleanupTemporaries::Yes);
+    CurrentScheduler::schedule_and_wait_for_tasks(tasks);
+    return pqp->get_output();
+  }
+
+  std::shared_ptr<ServerPreparedStatement> prepared_statement;
+};
+
+TEST_F(BindServerPreparedStatementTaskTest, ReusesParameterizedPlan) {
+  EXPECT_EQ(bind_and_execute(int32_t{100})->row_count(), 3u);
+
+  // The first Bind optimized the statement
+  const auto parameterized_plan = prepared_statement->parameterized_plan;
+  ASSERT_TRUE(parameterized_plan);
+
+  // Later Binds instantiate the same plan
+  EXPECT_EQ(bind_and_execute(int32_t{200})->row_count(), 2u);
+  EXPECT_EQ(prepared_statement->parameterized_plan, parameterized_plan);
+
+  // The plan does not cover parameters with a far lower selectivity, the statement is optimized for them instead
+  EXPECT_FALSE(parameterized_plan->covers({int32_t{12'000}}));
+  EXPECT_EQ(bind_and_execute(int32_t{12'000})->row_count(), 1u);
+  EXPECT_EQ(prepared_statement->parameterized_plan, parameterized_plan);
+}
+
+}  // namespace opossum